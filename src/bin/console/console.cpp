@@ -30,6 +30,7 @@ namespace filesystem = std::experimental::filesystem;
 #include "concurrency/transaction_manager.hpp"
 #include "operators/get_table.hpp"
 #include "operators/import_csv.hpp"
+#include "operators/maintenance/show_memory.hpp"
 #include "operators/print.hpp"
 #include "optimizer/optimizer.hpp"
 #include "pagination.hpp"
@@ -37,6 +38,7 @@ namespace filesystem = std::experimental::filesystem;
 #include "planviz/sql_query_plan_visualizer.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/scheduler_tracer.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
@@ -119,6 +121,7 @@ Console::Console()
   register_command("load", std::bind(&Console::load_table, this, std::placeholders::_1));
   register_command("script", std::bind(&Console::exec_script, this, std::placeholders::_1));
   register_command("print", std::bind(&Console::print_table, this, std::placeholders::_1));
+  register_command("memory", std::bind(&Console::print_memory_usage, this, std::placeholders::_1));
   register_command("visualize", std::bind(&Console::visualize, this, std::placeholders::_1));
   register_command("begin", std::bind(&Console::begin_transaction, this, std::placeholders::_1));
   register_command("rollback", std::bind(&Console::rollback_transaction, this, std::placeholders::_1));
@@ -356,6 +359,7 @@ int Console::help(const std::string&) {
       "TABLENAME\n");
   out("  script SCRIPTFILE                - Execute script specified by SCRIPTFILE\n");
   out("  print TABLENAME                  - Fully print the given table (including MVCC columns)\n");
+  out("  memory                           - Print the memory usage of all tables in bytes\n");
   out("  visualize [options] (noexec) SQL - Visualize a SQL query\n");
   out("                      <if set>        - does not execute the query (only supported with single statements)\n");
   out("             lqp                      - print the raw logical query plans\n");
@@ -370,7 +374,9 @@ int Console::help(const std::string&) {
   out("  quit                             - Exit the HYRISE Console\n");
   out("  help                             - Show this message\n\n");
   out("  setting [property] [value]       - Change a runtime setting\n\n");
-  out("           scheduler (on|off)      - Turn the scheduler on (default) or off\n\n");
+  out("           scheduler (on|off)      - Turn the scheduler on (default) or off\n");
+  out("           tracing (on|off)        - Turn the recording of a scheduler trace on or off (default)\n");
+  out("           tracing export [file]   - Write the scheduler trace to a file in the Chrome trace format\n\n");
   out("After TPC-C tables are generated, SQL queries can be executed.\n");
   out("Example:\n");
   out("SELECT * FROM DISTRICT\n");
@@ -478,6 +484,15 @@ int Console::print_table(const std::string& args) {
   return ReturnCode::Ok;
 }
 
+int Console::print_memory_usage(const std::string&) {
+  auto show_memory = std::make_shared<ShowMemory>();
+  show_memory->execute();
+
+  out(show_memory->get_output());
+
+  return ReturnCode::Ok;
+}
+
 int Console::visualize(const std::string& input) {
   std::vector<std::string> input_words;
   boost::algorithm::split(input_words, input, boost::is_any_of(" \n"));
@@ -611,6 +626,30 @@ int Console::change_runtime_setting(const std::string& input) {
     return 0;
   }
 
+  if (property == "tracing") {
+    auto& tracer = opossum::SchedulerTracer::get();
+    if (value == "on") {
+      tracer.enable();
+      out("Scheduler tracing turned on\n");
+    } else if (value == "off") {
+      tracer.disable();
+      out("Scheduler tracing turned off\n");
+    } else if (value.substr(0, value.find(' ')) == "export" && value.find(' ') != std::string::npos) {
+      const auto file_name = value.substr(value.find(' ') + 1);
+      try {
+        tracer.export_chrome_trace(file_name);
+      } catch (const std::exception& exception) {
+        out(std::string(exception.what()) + '\n');
+        return 1;
+      }
+      out("Scheduler trace written to " + file_name + "\n");
+    } else {
+      out("Usage: tracing (on|off|export [file])\n");
+      return 1;
+    }
+    return 0;
+  }
+
   out("Unknown property\n");
   return 1;
 }
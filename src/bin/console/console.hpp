@@ -112,6 +112,7 @@ class Console {
   int load_table(const std::string& args);
   int exec_script(const std::string& args);
   int print_table(const std::string& args);
+  int print_memory_usage(const std::string& args);
   int visualize(const std::string& input);
   int change_runtime_setting(const std::string& args);
 
@@ -1,5 +1,6 @@
 #include <boost/asio/io_service.hpp>
 
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 
@@ -19,6 +20,12 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(std::atoi(argv[1]));
     }
 
+    // Statements running for longer are cancelled, 0 disables the timeout
+    auto statement_timeout = std::chrono::milliseconds{0};
+    if (argc >= 3) {
+      statement_timeout = std::chrono::milliseconds{std::atoll(argv[2])};
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(
         std::make_shared<opossum::NodeQueueScheduler>(opossum::Topology::create_numa_topology()));
@@ -28,7 +35,7 @@ int main(int argc, char* argv[]) {
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
     // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    opossum::Server server{io_service, port, statement_timeout};
 
     io_service.run();
   } catch (std::exception& e) {
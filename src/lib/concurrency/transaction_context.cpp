@@ -2,8 +2,10 @@
 
 #include <future>
 #include <memory>
+#include <utility>
 
 #include "commit_context.hpp"
+#include "logging/redo_log.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "transaction_manager.hpp"
 #include "utils/assert.hpp"
@@ -79,7 +81,7 @@ bool TransactionContext::commit_async(std::function<void(TransactionID)> callbac
     op->commit_records(commit_id());
   }
 
-  _mark_as_pending_and_try_commit(callback);
+  _log_and_try_commit(callback);
 
   return true;
 }
@@ -142,6 +144,27 @@ bool TransactionContext::_prepare_commit() {
   return true;
 }
 
+void TransactionContext::add_redo_log_record(RedoLogRecord&& record) {
+  _redo_log_records.emplace_back(std::move(record));
+}
+
+void TransactionContext::_log_and_try_commit(std::function<void(TransactionID)> callback) {
+  // Read-only transactions have nothing to log
+  if (_redo_log_records.empty()) {
+    _mark_as_pending_and_try_commit(callback);
+    return;
+  }
+
+  const auto entry = RedoLogEntry{commit_id(), std::move(_redo_log_records)};
+  _redo_log_records.clear();
+
+  // The transaction becomes visible only once it is durable. If the log was closed in the meantime, nothing is logged.
+  const auto is_logged = RedoLog::get().log_commit(entry, [context = shared_from_this(), callback]() {
+    context->_mark_as_pending_and_try_commit(callback);
+  });
+  if (!is_logged) _mark_as_pending_and_try_commit(callback);
+}
+
 void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(TransactionID)> callback) {
   DebugAssert(([this]() {
                 for (const auto& op : _rw_operators) {
@@ -11,6 +11,7 @@ namespace opossum {
 
 class AbstractReadWriteOperator;
 class CommitContext;
+struct RedoLogRecord;
 
 /**
  * @brief Overview of the different transaction phases
@@ -112,6 +113,12 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
 
+  /**
+   * Called by the read/write operators while they commit their records if the RedoLog is open. The records are
+   * logged as one entry when the transaction commits.
+   */
+  void add_redo_log_record(RedoLogRecord&& record);
+
   /**
    * @defgroup Update the counter of active operators
    * @{
@@ -150,6 +157,12 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   bool _prepare_commit();
 
+  /**
+   * Writes the redo log records of the transaction, if any, and calls _mark_as_pending_and_try_commit() once they
+   * are durable.
+   */
+  void _log_and_try_commit(std::function<void(TransactionID)> callback);
+
   /**
    * Sets transaction phase to Pending.
    * Tries to commit transaction and all following
@@ -175,6 +188,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   const TransactionID _transaction_id;
   const CommitID _snapshot_commit_id;
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _rw_operators;
+  std::vector<RedoLogRecord> _redo_log_records;
 
   std::atomic<TransactionPhase> _phase;
   std::shared_ptr<CommitContext> _commit_context;
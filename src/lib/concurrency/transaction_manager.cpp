@@ -18,6 +18,9 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+
+  std::lock_guard<std::mutex> lock(manager._active_snapshots_mutex);
+  manager._active_snapshot_commit_ids.clear();
 }
 
 TransactionManager::TransactionManager()
@@ -27,8 +30,33 @@ TransactionManager::TransactionManager()
 
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
+CommitID TransactionManager::last_assigned_commit_id() const {
+  return std::atomic_load(&_last_commit_context)->commit_id();
+}
+
+void TransactionManager::set_last_commit_id(const CommitID commit_id) {
+  _last_commit_id = commit_id;
+  _last_commit_context = std::make_shared<CommitContext>(commit_id);
+}
+
+CommitID TransactionManager::oldest_active_snapshot_commit_id() const {
+  std::lock_guard<std::mutex> lock(_active_snapshots_mutex);
+  if (_active_snapshot_commit_ids.empty()) return _last_commit_id;
+  return *_active_snapshot_commit_ids.begin();
+}
+
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  // The snapshot is taken under the lock, so that it is not older than what oldest_active_snapshot_commit_id() returned
+  std::lock_guard<std::mutex> lock(_active_snapshots_mutex);
+  const auto snapshot_commit_id = _last_commit_id.load();
+  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+
+  return std::shared_ptr<TransactionContext>(new TransactionContext(_next_transaction_id++, snapshot_commit_id),
+                                             [](TransactionContext* context) {
+                                               TransactionManager::get()._release_snapshot(
+                                                   context->snapshot_commit_id());
+                                               delete context;
+                                             });
 }
 
 void TransactionManager::run_transaction(const std::function<void(std::shared_ptr<TransactionContext>)>& fn) {
@@ -97,4 +125,12 @@ void TransactionManager::_try_increment_last_commit_id(std::shared_ptr<CommitCon
   }
 }
 
+void TransactionManager::_release_snapshot(const CommitID snapshot_commit_id) {
+  std::lock_guard<std::mutex> lock(_active_snapshots_mutex);
+
+  // The snapshot is missing if the TransactionManager was reset in the meantime
+  const auto it = _active_snapshot_commit_ids.find(snapshot_commit_id);
+  if (it != _active_snapshot_commit_ids.end()) _active_snapshot_commit_ids.erase(it);
+}
+
 }  // namespace opossum
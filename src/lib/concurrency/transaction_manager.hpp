@@ -3,6 +3,8 @@
 #include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <set>
 
 #include "types.hpp"
 
@@ -52,6 +54,25 @@ class TransactionManager : private Noncopyable {
 
   CommitID last_commit_id() const;
 
+  /**
+   * The commit ID that was handed out last to a committing transaction. It can be higher than last_commit_id() while
+   * transactions commit.
+   */
+  CommitID last_assigned_commit_id() const;
+
+  /**
+   * The snapshot commit ID of the oldest TransactionContext created by new_transaction_context() that still exists, or
+   * the last commit ID if there is none. Rows that were deleted with a commit ID of at most this are invisible to all
+   * running and future transactions.
+   */
+  CommitID oldest_active_snapshot_commit_id() const;
+
+  /**
+   * Continues assigning commit IDs after commit_id, e.g., once data that was committed in an earlier run has been
+   * recovered. Must not be called while transactions are running.
+   */
+  void set_last_commit_id(const CommitID commit_id);
+
   /**
    * Creates a new transaction context
    */
@@ -80,6 +101,9 @@ class TransactionManager : private Noncopyable {
   std::shared_ptr<CommitContext> _new_commit_context();
   void _try_increment_last_commit_id(std::shared_ptr<CommitContext> context);
 
+  // Called when a TransactionContext created by new_transaction_context() is destroyed
+  void _release_snapshot(const CommitID snapshot_commit_id);
+
  private:
   std::atomic<TransactionID> _next_transaction_id;
   // TransactionID = 0 means "not set" in the MVCC columns
@@ -91,5 +115,9 @@ class TransactionManager : private Noncopyable {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  // Snapshot commit IDs of the existing TransactionContexts, see oldest_active_snapshot_commit_id()
+  mutable std::mutex _active_snapshots_mutex;
+  std::multiset<CommitID> _active_snapshot_commit_ids;
 };
 }  // namespace opossum
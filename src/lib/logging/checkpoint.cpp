@@ -0,0 +1,619 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/export_binary.hpp"
+#include "operators/import_binary.hpp"
+#include "optimizer/chunk_statistics/chunk_column_statistics.hpp"
+#include "optimizer/chunk_statistics/chunk_statistics.hpp"
+#include "redo_log.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/parallel_for.hpp"
+#include "storage/base_encoded_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/column_encoding_utils.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/materialize.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto CHECKPOINT_MAGIC_NUMBER = uint32_t{0x48434B50};  // "HCKP"
+
+const auto MANIFEST_FILE_NAME = std::string{"checkpoint.bin"};
+
+template <typename T>
+void write_value(std::ofstream& file, const T& value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write_string(std::ofstream& file, const std::string& string) {
+  write_value(file, static_cast<uint32_t>(string.size()));
+  file.write(string.data(), string.size());
+}
+
+template <typename T>
+T read_value(std::ifstream& file) {
+  auto value = T{};
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+std::string read_string(std::ifstream& file) {
+  auto string = std::string(read_value<uint32_t>(file), '\0');
+  file.read(string.data(), string.size());
+  return string;
+}
+
+std::ofstream open_for_writing(const std::string& file_name) {
+  std::ofstream file;
+  file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+  file.open(file_name, std::ios::binary | std::ios::trunc);
+  return file;
+}
+
+std::ifstream open_for_reading(const std::string& file_name) {
+  std::ifstream file;
+  file.open(file_name, std::ios::binary);
+  Assert(file.is_open(), "Cannot open checkpoint file " + file_name);
+  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  return file;
+}
+
+// Flushes a file (or directory) to disk, which std::ofstream cannot do
+void sync_file(const std::string& file_name) {
+  const auto file_descriptor = ::open(file_name.c_str(), O_RDONLY);
+  Assert(file_descriptor != -1, "Cannot open " + file_name + ": " + std::strerror(errno));
+  const auto result = ::fsync(file_descriptor);
+  const auto error = errno;
+  ::close(file_descriptor);
+  Assert(result == 0, "Cannot sync " + file_name + ": " + std::strerror(error));
+}
+
+std::string table_file_name(const std::string& directory, const uint32_t checkpoint_number, const size_t table_idx) {
+  return directory + "/" + std::to_string(checkpoint_number) + "_" + std::to_string(table_idx) + ".bin";
+}
+
+std::string chunk_file_name(const std::string& directory, const uint32_t checkpoint_number, const size_t table_idx,
+                            const ChunkID chunk_id) {
+  return directory + "/" + std::to_string(checkpoint_number) + "_" + std::to_string(table_idx) + "_" +
+         std::to_string(chunk_id) + ".bin";
+}
+
+std::optional<VectorCompressionType> vector_compression_type(const CompressedVectorType compressed_vector_type) {
+  switch (compressed_vector_type) {
+    case CompressedVectorType::FixedSize4ByteAligned:
+    case CompressedVectorType::FixedSize2ByteAligned:
+    case CompressedVectorType::FixedSize1ByteAligned:
+      return VectorCompressionType::FixedSizeByteAligned;
+    case CompressedVectorType::SimdBp128:
+      return VectorCompressionType::SimdBp128;
+    case CompressedVectorType::Invalid:
+      return std::nullopt;
+  }
+  Fail("Unknown CompressedVectorType");
+}
+
+/**
+ * Returns a column with the rows of column that ExportBinary can write, and the encoding that the column gets when it
+ * is loaded. Only the values of the rows in rows_to_copy are copied from a ValueColumn, the others get default values.
+ */
+std::pair<std::shared_ptr<BaseColumn>, ColumnEncodingSpec> exportable_column(
+    const std::shared_ptr<BaseColumn>& column, const DataType data_type, const bool nullable,
+    const std::vector<bool>& rows_to_copy) {
+  auto exportable_column = std::shared_ptr<BaseColumn>{};
+  auto encoding_spec = ColumnEncodingSpec{EncodingType::Unencoded};
+  const auto row_count = rows_to_copy.size();
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Inserts might append to a ValueColumn and write the values of their rows concurrently
+    if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<ColumnDataType>>(column)) {
+      const auto& values = value_column->values();
+      auto copied_values = pmr_concurrent_vector<ColumnDataType>(row_count);
+      auto copied_null_values = pmr_concurrent_vector<bool>(value_column->is_nullable() ? row_count : 0);
+      for (auto chunk_offset = size_t{0}; chunk_offset < row_count; ++chunk_offset) {
+        if (!rows_to_copy[chunk_offset]) continue;
+        copied_values[chunk_offset] = values[chunk_offset];
+        if (value_column->is_nullable()) copied_null_values[chunk_offset] = value_column->null_values()[chunk_offset];
+      }
+
+      if (value_column->is_nullable()) {
+        exportable_column =
+            std::make_shared<ValueColumn<ColumnDataType>>(std::move(copied_values), std::move(copied_null_values));
+      } else {
+        exportable_column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(copied_values));
+      }
+      return;
+    }
+
+    // Encoded columns belong to completed chunks, which do not change anymore and are written completely
+    Assert(column->size() == row_count, "Encoded column does not have the size of its chunk");
+
+    const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<ColumnDataType>>(column);
+    if (dictionary_column && vector_compression_type(dictionary_column->compressed_vector_type()) ==
+                                 VectorCompressionType::FixedSizeByteAligned) {
+      exportable_column = column;
+      return;
+    }
+
+    const auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(column);
+    Assert(encoded_column, "Cannot write column of unknown type to a checkpoint");
+
+    auto values_and_nulls = std::vector<std::pair<bool, ColumnDataType>>{};
+    values_and_nulls.reserve(column->size());
+    materialize_values_and_nulls(*column, values_and_nulls);
+
+    auto values = pmr_concurrent_vector<ColumnDataType>(values_and_nulls.size());
+    auto null_values = pmr_concurrent_vector<bool>(values_and_nulls.size());
+    for (auto chunk_offset = size_t{0}; chunk_offset < values_and_nulls.size(); ++chunk_offset) {
+      null_values[chunk_offset] = values_and_nulls[chunk_offset].first;
+      values[chunk_offset] = std::move(values_and_nulls[chunk_offset].second);
+    }
+
+    if (nullable) {
+      exportable_column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values));
+    } else {
+      exportable_column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values));
+    }
+
+    encoding_spec.encoding_type = encoded_column->encoding_type();
+    encoding_spec.vector_compression_type = vector_compression_type(encoded_column->compressed_vector_type());
+  });
+
+  return {exportable_column, encoding_spec};
+}
+
+}  // namespace
+
+namespace opossum {
+
+CommitID Checkpoint::create(const std::string& directory) {
+  const auto previous_manifest = _read_manifest(directory);
+
+  auto manifest = Manifest{};
+  manifest.checkpoint_number = previous_manifest ? previous_manifest->checkpoint_number + 1 : 0;
+
+  // Entries that are logged later belong to transactions that get their commit ID later, so that recover() reads the
+  // log only from here. If the log is closed, the offset is 0 and recover() reads all of it.
+  manifest.redo_log_offset = RedoLog::get().end_offset();
+
+  // Transactions that get their commit ID later are not part of the checkpoint, their redo log entries are replayed on
+  // recovery. The ones that already got a commit ID are committed completely before their rows are written.
+  manifest.commit_id = TransactionManager::get().last_assigned_commit_id();
+  while (TransactionManager::get().last_commit_id() < manifest.commit_id) {
+    std::this_thread::yield();
+  }
+
+  struct ChunkToWrite {
+    size_t table_idx;
+    std::shared_ptr<const Table> table;
+    ChunkID chunk_id;
+    ChunkOffset row_count;
+  };
+  auto chunks_to_write = std::vector<ChunkToWrite>{};
+
+  const auto table_names = StorageManager::get().table_names();
+  for (auto table_idx = size_t{0}; table_idx < table_names.size(); ++table_idx) {
+    const auto table = StorageManager::get().get_table(table_names[table_idx]);
+
+    auto& table_manifest = manifest.tables.emplace_back();
+    table_manifest.name = table_names[table_idx];
+    table_manifest.indexes = table->get_indexes();
+    if (const auto primary_key_index = table->primary_key_index()) {
+      table_manifest.primary_key_column_id = primary_key_index->column_id();
+    }
+
+    const auto file_name = table_file_name(directory, manifest.checkpoint_number, table_idx);
+    auto file = open_for_writing(file_name);
+    {
+      // Rows that are appended later were not committed at the checkpoint's commit ID
+      const auto append_lock = table->acquire_append_mutex();
+      table_manifest.chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < table_manifest.chunk_count; ++chunk_id) {
+        chunks_to_write.push_back(
+            {table_idx, table, chunk_id, static_cast<ChunkOffset>(table->chunk_size(chunk_id))});
+      }
+      ExportBinary::_write_header(table, file);
+    }
+    file.close();
+    sync_file(file_name);
+  }
+
+  parallel_for_offsets(chunks_to_write.size(), [&](const size_t chunk_idx) {
+    const auto& chunk_to_write = chunks_to_write[chunk_idx];
+    const auto& table = chunk_to_write.table;
+    const auto file_name =
+        chunk_file_name(directory, manifest.checkpoint_number, chunk_to_write.table_idx, chunk_to_write.chunk_id);
+    _write_chunk(table, *table->get_chunk(chunk_to_write.chunk_id), chunk_to_write.row_count, manifest.commit_id,
+                 file_name);
+  });
+
+  _write_manifest(manifest, directory);
+  if (previous_manifest) _remove_files(*previous_manifest, directory);
+
+  return manifest.commit_id;
+}
+
+bool Checkpoint::exists(const std::string& directory) {
+  return std::ifstream{directory + "/" + MANIFEST_FILE_NAME}.good();
+}
+
+CommitID Checkpoint::recover(const std::string& directory, const std::optional<std::string>& redo_log_file_name) {
+  const auto manifest = _read_manifest(directory);
+  Assert(manifest, "There is no checkpoint in " + directory);
+
+  auto tables = std::vector<std::shared_ptr<Table>>{};
+  auto chunks = std::vector<std::vector<std::shared_ptr<Chunk>>>{};
+  auto chunks_to_read = std::vector<std::pair<size_t, ChunkID>>{};
+
+  for (auto table_idx = size_t{0}; table_idx < manifest->tables.size(); ++table_idx) {
+    auto file = open_for_reading(table_file_name(directory, manifest->checkpoint_number, table_idx));
+    tables.emplace_back(ImportBinary::_read_header(file).first);
+
+    const auto chunk_count = manifest->tables[table_idx].chunk_count;
+    chunks.emplace_back(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      chunks_to_read.emplace_back(table_idx, chunk_id);
+    }
+  }
+
+  parallel_for_offsets(chunks_to_read.size(), [&](const size_t chunk_idx) {
+    const auto [table_idx, chunk_id] = chunks_to_read[chunk_idx];
+    const auto file_name = chunk_file_name(directory, manifest->checkpoint_number, table_idx, chunk_id);
+    chunks[table_idx][chunk_id] = _read_chunk(*tables[table_idx], manifest->tables[table_idx].indexes, file_name);
+  });
+
+  auto tables_by_name = std::unordered_map<std::string, std::shared_ptr<Table>>{};
+  for (auto table_idx = size_t{0}; table_idx < tables.size(); ++table_idx) {
+    const auto& table = tables[table_idx];
+    for (const auto& chunk : chunks[table_idx]) {
+      table->append_chunk(chunk);
+    }
+    for (const auto& index_info : manifest->tables[table_idx].indexes) {
+      table->register_index(index_info);
+    }
+    tables_by_name.emplace(manifest->tables[table_idx].name, table);
+  }
+
+  auto last_commit_id = manifest->commit_id;
+  if (redo_log_file_name) {
+    last_commit_id = _replay(RedoLog::read_entries(*redo_log_file_name, manifest->redo_log_offset),
+                             manifest->commit_id, tables_by_name);
+  }
+
+  for (auto table_idx = size_t{0}; table_idx < tables.size(); ++table_idx) {
+    const auto& table_manifest = manifest->tables[table_idx];
+
+    // Created only now, so that it covers the replayed rows
+    if (table_manifest.primary_key_column_id != INVALID_COLUMN_ID) {
+      tables[table_idx]->create_primary_key_index(table_manifest.primary_key_column_id);
+    }
+    StorageManager::get().add_table(table_manifest.name, tables[table_idx]);
+  }
+
+  TransactionManager::get().set_last_commit_id(last_commit_id);
+  return last_commit_id;
+}
+
+void Checkpoint::_write_manifest(const Manifest& manifest, const std::string& directory) {
+  // The manifest is written to a temporary file that replaces the previous one, so that the replacement is atomic
+  const auto file_name = directory + "/" + MANIFEST_FILE_NAME;
+  const auto temporary_file_name = file_name + ".tmp";
+
+  auto file = open_for_writing(temporary_file_name);
+  write_value(file, CHECKPOINT_MAGIC_NUMBER);
+  write_value(file, manifest.checkpoint_number);
+  write_value(file, manifest.commit_id);
+  write_value(file, manifest.redo_log_offset);
+  write_value(file, static_cast<uint32_t>(manifest.tables.size()));
+
+  for (const auto& table_manifest : manifest.tables) {
+    write_string(file, table_manifest.name);
+    write_value(file, table_manifest.chunk_count);
+    write_value(file, table_manifest.primary_key_column_id);
+    write_value(file, static_cast<uint32_t>(table_manifest.indexes.size()));
+
+    for (const auto& index_info : table_manifest.indexes) {
+      write_value(file, index_info.type);
+      write_string(file, index_info.name);
+      write_value(file, static_cast<uint16_t>(index_info.column_ids.size()));
+      for (const auto& column_id : index_info.column_ids) {
+        write_value(file, column_id);
+      }
+    }
+  }
+  file.close();
+  sync_file(temporary_file_name);
+
+  Assert(std::rename(temporary_file_name.c_str(), file_name.c_str()) == 0,
+         "Cannot replace checkpoint manifest " + file_name + ": " + std::strerror(errno));
+  sync_file(directory);
+}
+
+std::optional<Checkpoint::Manifest> Checkpoint::_read_manifest(const std::string& directory) {
+  if (!exists(directory)) return std::nullopt;
+
+  auto file = open_for_reading(directory + "/" + MANIFEST_FILE_NAME);
+  Assert(read_value<uint32_t>(file) == CHECKPOINT_MAGIC_NUMBER, "Not a checkpoint manifest in " + directory);
+
+  auto manifest = Manifest{};
+  manifest.checkpoint_number = read_value<uint32_t>(file);
+  manifest.commit_id = read_value<CommitID>(file);
+  manifest.redo_log_offset = read_value<uint64_t>(file);
+
+  const auto table_count = read_value<uint32_t>(file);
+  for (auto table_idx = uint32_t{0}; table_idx < table_count; ++table_idx) {
+    auto& table_manifest = manifest.tables.emplace_back();
+    table_manifest.name = read_string(file);
+    table_manifest.chunk_count = read_value<ChunkID>(file);
+    table_manifest.primary_key_column_id = read_value<ColumnID>(file);
+
+    const auto index_count = read_value<uint32_t>(file);
+    for (auto index_idx = uint32_t{0}; index_idx < index_count; ++index_idx) {
+      auto& index_info = table_manifest.indexes.emplace_back();
+      index_info.type = read_value<ColumnIndexType>(file);
+      index_info.name = read_string(file);
+
+      const auto column_count = read_value<uint16_t>(file);
+      for (auto column_idx = uint16_t{0}; column_idx < column_count; ++column_idx) {
+        index_info.column_ids.emplace_back(read_value<ColumnID>(file));
+      }
+    }
+  }
+
+  return manifest;
+}
+
+void Checkpoint::_remove_files(const Manifest& manifest, const std::string& directory) {
+  for (auto table_idx = size_t{0}; table_idx < manifest.tables.size(); ++table_idx) {
+    std::remove(table_file_name(directory, manifest.checkpoint_number, table_idx).c_str());
+    for (auto chunk_id = ChunkID{0}; chunk_id < manifest.tables[table_idx].chunk_count; ++chunk_id) {
+      std::remove(chunk_file_name(directory, manifest.checkpoint_number, table_idx, chunk_id).c_str());
+    }
+  }
+}
+
+void Checkpoint::_write_chunk(const std::shared_ptr<const Table>& table, const Chunk& chunk,
+                              const ChunkOffset row_count, const CommitID commit_id, const std::string& file_name) {
+  // The ChunkEncoder might replace the columns concurrently, so all of them are taken at once
+  auto columns = ChunkColumns{};
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    columns.emplace_back(chunk.get_mutable_column(column_id));
+  }
+
+  // Chunks are encoded only once all of their rows are committed or rolled back, so that the values of the rows that
+  // were appended after row_count was taken are final. These rows are written as well, as replaying their Inserts
+  // cannot append to the loaded chunk, which is immutable.
+  const auto is_completed = std::any_of(columns.cbegin(), columns.cend(), [](const auto& column) {
+    return !std::dynamic_pointer_cast<const BaseValueColumn>(column);
+  });
+  const auto exported_row_count = is_completed ? static_cast<ChunkOffset>(columns.front()->size()) : row_count;
+
+  // Rows that were not committed at the checkpoint's commit ID become invisible, rows deleted later visible. The values
+  // of rows that are not committed yet might still be written, so they are only copied from completed chunks.
+  auto begin_cids = std::vector<CommitID>(exported_row_count);
+  auto end_cids = std::vector<CommitID>(exported_row_count);
+  auto rows_to_copy = std::vector<bool>(exported_row_count, is_completed);
+  {
+    const auto mvcc_columns = chunk.mvcc_columns();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < exported_row_count; ++chunk_offset) {
+      // Rows appended after row_count was taken were committed after the checkpoint's commit ID
+      if (chunk_offset >= row_count) continue;
+
+      const auto begin_cid = mvcc_columns->begin_cids[chunk_offset];
+      // Rolled back Inserts write the end commit ID before the begin commit ID, committed ones their values before it
+      std::atomic_thread_fence(std::memory_order_acquire);
+      const auto end_cid = mvcc_columns->end_cids[chunk_offset];
+
+      if (begin_cid > commit_id) continue;
+      begin_cids[chunk_offset] = begin_cid;
+      end_cids[chunk_offset] = end_cid > commit_id ? MvccColumns::MAX_COMMIT_ID : end_cid;
+      rows_to_copy[chunk_offset] = true;
+    }
+  }
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    auto [column, encoding_spec] = exportable_column(columns[column_id], table->column_data_type(column_id),
+                                                     table->column_is_nullable(column_id), rows_to_copy);
+    columns[column_id] = std::move(column);
+    chunk_encoding_spec.emplace_back(encoding_spec);
+  }
+
+  auto file = open_for_writing(file_name);
+  for (const auto& encoding_spec : chunk_encoding_spec) {
+    write_value(file, encoding_spec.encoding_type);
+    write_value(file, encoding_spec.vector_compression_type.value_or(VectorCompressionType::Invalid));
+  }
+  ExportBinary::_write_chunk(table, file, Chunk{columns});
+  file.write(reinterpret_cast<const char*>(begin_cids.data()), begin_cids.size() * sizeof(CommitID));
+  file.write(reinterpret_cast<const char*>(end_cids.data()), end_cids.size() * sizeof(CommitID));
+  file.close();
+  sync_file(file_name);
+}
+
+std::shared_ptr<Chunk> Checkpoint::_read_chunk(const Table& table, const std::vector<IndexInfo>& indexes,
+                                               const std::string& file_name) {
+  auto file = open_for_reading(file_name);
+
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    auto& encoding_spec = chunk_encoding_spec.emplace_back(read_value<EncodingType>(file));
+    const auto vector_compression_type = read_value<VectorCompressionType>(file);
+    if (vector_compression_type != VectorCompressionType::Invalid) {
+      encoding_spec.vector_compression_type = vector_compression_type;
+    }
+  }
+
+  const auto columns = ImportBinary::_import_columns(file, table);
+  const auto row_count = columns.empty() ? size_t{0} : columns.front()->size();
+
+  auto begin_cids = std::vector<CommitID>(row_count);
+  auto end_cids = std::vector<CommitID>(row_count);
+  file.read(reinterpret_cast<char*>(begin_cids.data()), begin_cids.size() * sizeof(CommitID));
+  file.read(reinterpret_cast<char*>(end_cids.data()), end_cids.size() * sizeof(CommitID));
+
+  auto mvcc_columns = std::make_shared<MvccColumns>(row_count);
+  std::copy(begin_cids.cbegin(), begin_cids.cend(), mvcc_columns->begin_cids.begin());
+  std::copy(end_cids.cbegin(), end_cids.cend(), mvcc_columns->end_cids.begin());
+
+  auto chunk = std::make_shared<Chunk>(columns, mvcc_columns);
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    const auto& encoding_spec = chunk_encoding_spec[column_id];
+    if (encoding_spec.encoding_type == EncodingType::Unencoded) continue;
+
+    const auto value_column = std::dynamic_pointer_cast<const BaseValueColumn>(chunk->get_column(column_id));
+    chunk->replace_column(column_id, encode_column(encoding_spec.encoding_type, table.column_data_type(column_id),
+                                                   value_column, encoding_spec.vector_compression_type));
+  }
+
+  // Like the ChunkEncoder, create zone maps for immutable chunks. Mutable chunks have none after recovery.
+  if (!chunk->is_mutable()) {
+    auto column_statistics = std::vector<std::shared_ptr<ChunkColumnStatistics>>{};
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto data_type = table.column_data_type(column_id);
+      column_statistics.emplace_back(
+          ChunkColumnStatistics::build_statistics(data_type, chunk->get_mutable_column(column_id)));
+    }
+    chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
+  }
+
+  for (const auto& index_info : indexes) {
+    if (chunk->columns_are_indexable(index_info.column_ids)) {
+      chunk->create_index(index_info.type, index_info.column_ids);
+    }
+  }
+
+  return chunk;
+}
+
+CommitID Checkpoint::_replay(std::vector<RedoLogEntry> entries, const CommitID commit_id,
+                             const std::unordered_map<std::string, std::shared_ptr<Table>>& tables) {
+  // Entries are written in the order in which transactions committed their records, not by commit ID. A row that is
+  // deleted by one transaction must have been inserted by one with a lower commit ID.
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.commit_id < rhs.commit_id; });
+
+  auto last_commit_id = commit_id;
+  for (const auto& entry : entries) {
+    // The changes of this transaction are part of the checkpoint
+    if (entry.commit_id <= commit_id) continue;
+
+    for (const auto& record : entry.records) {
+      const auto table_it = tables.find(record.table_name);
+      Assert(table_it != tables.end(), "Redo log refers to unknown table " + record.table_name);
+      auto& table = *table_it->second;
+
+      switch (record.type) {
+        case RedoLogRecordType::Insert:
+          for (auto row_idx = size_t{0}; row_idx < record.row_ids.size(); ++row_idx) {
+            _replay_insert(table, record.row_ids[row_idx], record.rows[row_idx], entry.commit_id);
+          }
+          break;
+
+        case RedoLogRecordType::Delete:
+          for (const auto& row_id : record.row_ids) {
+            Assert(row_id.chunk_id < table.chunk_count() && row_id.chunk_offset < table.chunk_size(row_id.chunk_id),
+                   "Redo log deletes a row that does not exist in " + record.table_name);
+            table.get_chunk(row_id.chunk_id)->mvcc_columns()->end_cids[row_id.chunk_offset] = entry.commit_id;
+          }
+          break;
+      }
+    }
+
+    last_commit_id = entry.commit_id;
+  }
+
+  return last_commit_id;
+}
+
+void Checkpoint::_replay_insert(Table& table, const RowID& row_id, const std::vector<AllTypeVariant>& row,
+                                const CommitID commit_id) {
+  DebugAssert(row.size() == table.column_count(), "Inserted row does not match the table");
+
+  while (table.chunk_count() <= row_id.chunk_id) {
+    table.append_mutable_chunk();
+  }
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  auto mvcc_columns = chunk->mvcc_columns();
+
+  // The row was reserved before the checkpoint, but committed after its commit ID. The chunk was encoded before it was
+  // written, which requires all of its rows to be committed, so the checkpoint contains the row's values already.
+  if (!chunk->is_mutable()) {
+    Assert(row_id.chunk_offset < chunk->size(), "Redo log inserts into an immutable chunk");
+    mvcc_columns->begin_cids[row_id.chunk_offset] = commit_id;
+    mvcc_columns->end_cids[row_id.chunk_offset] = MvccColumns::MAX_COMMIT_ID;
+    return;
+  }
+
+  // Rows that precede the inserted row have not been replayed yet, as they are inserted by a transaction with a higher
+  // commit ID, or were never committed. Until then, they are invisible, like the rows of a rolled back Insert.
+  const auto old_size = chunk->size();
+  if (row_id.chunk_offset >= old_size) {
+    const auto new_size = row_id.chunk_offset + 1;
+
+    mvcc_columns->grow_by(new_size - old_size, CommitID{0});
+    for (auto chunk_offset = old_size; chunk_offset < new_size; ++chunk_offset) {
+      mvcc_columns->end_cids[chunk_offset] = CommitID{0};
+    }
+
+    for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        auto& value_column = static_cast<ValueColumn<ColumnDataType>&>(*chunk->get_mutable_column(column_id));
+        value_column.values().grow_to_at_least(new_size);
+        if (value_column.is_nullable()) value_column.null_values().grow_to_at_least(new_size);
+      });
+    }
+  }
+
+  for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      auto& value_column = static_cast<ValueColumn<ColumnDataType>&>(*chunk->get_mutable_column(column_id));
+      const auto& value = row[column_id];
+
+      if (variant_is_null(value)) {
+        Assert(value_column.is_nullable(), "Redo log inserts NULL into a column that is not nullable");
+        value_column.null_values()[row_id.chunk_offset] = true;
+        return;
+      }
+
+      value_column.values()[row_id.chunk_offset] = type_cast<ColumnDataType>(value);
+      if (value_column.is_nullable()) value_column.null_values()[row_id.chunk_offset] = false;
+    });
+  }
+
+  mvcc_columns->begin_cids[row_id.chunk_offset] = commit_id;
+  mvcc_columns->end_cids[row_id.chunk_offset] = MvccColumns::MAX_COMMIT_ID;
+  chunk->set_ordered_by(std::nullopt);
+}
+
+}  // namespace opossum
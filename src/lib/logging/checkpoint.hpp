@@ -0,0 +1,117 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "redo_log_record.hpp"
+#include "storage/index/index_info.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * Consistent snapshot of all tables of the StorageManager that, together with the RedoLog, is used to recover the
+ * database after a restart or a crash.
+ *
+ * create() takes the last assigned commit ID as the checkpoint's commit ID and writes every table as of that commit ID
+ * while transactions keep running. Rows keep their RowIDs, so that the log entries of later commits, which refer to
+ * rows by their RowIDs, can be replayed on top of the checkpoint. Rows that were not committed at the checkpoint's
+ * commit ID are written as invisible rows, like rolled back ones. Their values are written nonetheless: If their chunk
+ * was encoded in the meantime, replaying their Insert only restores their commit IDs.
+ *
+ * recover() loads the chunks of all tables in parallel (see parallel_for()), so that the time to restart scales with
+ * the number of CPUs instead of the data size. Encoded chunks keep their encoding and the chunk indices of
+ * Table::get_indexes() are recreated, the primary key index as well. Afterwards, the entries of the redo log with a
+ * higher commit ID are replayed and commit IDs continue after the last recovered commit.
+ *
+ * A checkpoint consists of the following files in its directory:
+ *  - checkpoint.bin, the manifest: The commit ID, the redo log offset after which all entries with a higher commit ID
+ *    were logged, and, per table, its name, chunk count, and indices. It is replaced atomically once all other files
+ *    are written, so that a crash during create() leaves the previous checkpoint intact. The files of the previous
+ *    checkpoint are removed afterwards.
+ *  - <checkpoint number>_<table number>.bin: The header of a table in the format of ExportBinary
+ *  - <checkpoint number>_<table number>_<chunk id>.bin: A chunk, with the following layout:
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Column encodings      | (EncodingType, VectorCompressionType) |   Column count * 2
+ *                       | array                                 |
+ * Chunk                 | see ExportBinary                      |   variable
+ * Begin commit IDs      | CommitID array                        |   Row count * 4
+ * End commit IDs        | CommitID array                        |   Row count * 4
+ *
+ * ExportBinary writes ValueColumns and DictionaryColumns with fixed-size byte-aligned attribute vectors, which are
+ * loaded as they are (their encoding is EncodingType::Unencoded in the file). Columns with other encodings are written
+ * as ValueColumns and encoded again when they are loaded.
+ *
+ * create() does not truncate the redo log. recover() reads it from the manifest's offset on and skips the remaining
+ * entries that are part of the checkpoint.
+ */
+class Checkpoint {
+ public:
+  /**
+   * Writes a checkpoint of all tables to the (existing) directory, replacing the checkpoint that might be stored
+   * there. Chunks are written in parallel.
+   *
+   * @return the commit ID of the checkpoint
+   */
+  static CommitID create(const std::string& directory);
+
+  // Returns whether the directory contains a checkpoint
+  static bool exists(const std::string& directory);
+
+  /**
+   * Loads the checkpoint in the directory into the StorageManager, which must not contain any of its tables yet, and
+   * replays the entries of the redo log that were committed after the checkpoint.
+   *
+   * @return the last commit ID, after which the TransactionManager continues
+   */
+  static CommitID recover(const std::string& directory, const std::optional<std::string>& redo_log_file_name);
+
+ protected:
+  struct TableManifest {
+    std::string name;
+    ChunkID chunk_count{0};
+    ColumnID primary_key_column_id{INVALID_COLUMN_ID};
+    std::vector<IndexInfo> indexes;
+  };
+
+  struct Manifest {
+    uint32_t checkpoint_number{0};
+    CommitID commit_id{0};
+    uint64_t redo_log_offset{0};
+    std::vector<TableManifest> tables;
+  };
+
+  static void _write_manifest(const Manifest& manifest, const std::string& directory);
+  static std::optional<Manifest> _read_manifest(const std::string& directory);
+
+  // Removes the table and chunk files of a checkpoint that was replaced
+  static void _remove_files(const Manifest& manifest, const std::string& directory);
+
+  /**
+   * Writes the first row_count rows of the chunk as of commit_id, or all of its rows if it was encoded in the meantime.
+   * Columns that ExportBinary cannot write are materialized.
+   */
+  static void _write_chunk(const std::shared_ptr<const Table>& table, const Chunk& chunk, const ChunkOffset row_count,
+                           const CommitID commit_id, const std::string& file_name);
+
+  // Reads a chunk, encodes the columns that were materialized, and creates the chunk indices
+  static std::shared_ptr<Chunk> _read_chunk(const Table& table, const std::vector<IndexInfo>& indexes,
+                                            const std::string& file_name);
+
+  // Applies the entries committed after commit_id to the tables, returns the last commit ID
+  static CommitID _replay(std::vector<RedoLogEntry> entries, const CommitID commit_id,
+                          const std::unordered_map<std::string, std::shared_ptr<Table>>& tables);
+
+  static void _replay_insert(Table& table, const RowID& row_id, const std::vector<AllTypeVariant>& row,
+                             const CommitID commit_id);
+};
+
+}  // namespace opossum
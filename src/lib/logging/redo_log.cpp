@@ -0,0 +1,338 @@
+#include "redo_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+#include "utils/murmur_hash.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto CHECKSUM_SEED = 0u;
+
+// Size of the entry size and the checksum
+constexpr auto ENTRY_HEADER_SIZE = sizeof(uint32_t) + sizeof(uint32_t);
+
+template <typename T>
+void write_value(std::vector<char>& buffer, const T& value) {
+  const auto* bytes = reinterpret_cast<const char*>(&value);
+  buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+void write_string(std::vector<char>& buffer, const std::string& string) {
+  write_value(buffer, static_cast<uint32_t>(string.size()));
+  buffer.insert(buffer.end(), string.begin(), string.end());
+}
+
+void write_variant(std::vector<char>& buffer, const AllTypeVariant& variant) {
+  const auto data_type = data_type_from_all_type_variant(variant);
+  write_value(buffer, data_type);
+  if (data_type == DataType::Null) return;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+      write_string(buffer, boost::get<std::string>(variant));
+    } else {
+      write_value(buffer, boost::get<ColumnDataType>(variant));
+    }
+  });
+}
+
+// Reads from a buffer, throws if the buffer ends before the value
+class BufferReader {
+ public:
+  BufferReader(const char* begin, const char* end) : _position(begin), _end(end) {}
+
+  template <typename T>
+  T read_value() {
+    Assert(static_cast<size_t>(_end - _position) >= sizeof(T), "Redo log entry is truncated");
+    auto value = T{};
+    std::memcpy(static_cast<void*>(&value), _position, sizeof(T));
+    _position += sizeof(T);
+    return value;
+  }
+
+  std::string read_string() {
+    const auto length = read_value<uint32_t>();
+    Assert(static_cast<size_t>(_end - _position) >= length, "Redo log entry is truncated");
+    auto string = std::string(_position, length);
+    _position += length;
+    return string;
+  }
+
+  AllTypeVariant read_variant() {
+    const auto data_type = read_value<DataType>();
+    if (data_type == DataType::Null) return NULL_VALUE;
+
+    auto variant = AllTypeVariant{};
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        variant = read_string();
+      } else {
+        variant = read_value<ColumnDataType>();
+      }
+    });
+    return variant;
+  }
+
+ private:
+  const char* _position;
+  const char* _end;
+};
+
+std::vector<char> serialize_entry(const RedoLogEntry& entry) {
+  auto buffer = std::vector<char>(ENTRY_HEADER_SIZE);
+
+  write_value(buffer, entry.commit_id);
+  write_value(buffer, static_cast<uint32_t>(entry.records.size()));
+
+  for (const auto& record : entry.records) {
+    DebugAssert(record.type == RedoLogRecordType::Delete || record.rows.size() == record.row_ids.size(),
+                "Inserted rows need values");
+
+    write_value(buffer, record.type);
+    write_string(buffer, record.table_name);
+    write_value(buffer, static_cast<uint32_t>(record.row_ids.size()));
+
+    for (const auto& row_id : record.row_ids) {
+      write_value(buffer, row_id.chunk_id);
+      write_value(buffer, row_id.chunk_offset);
+    }
+
+    for (const auto& row : record.rows) {
+      write_value(buffer, static_cast<uint16_t>(row.size()));
+      for (const auto& value : row) {
+        write_variant(buffer, value);
+      }
+    }
+  }
+
+  const auto entry_size = static_cast<uint32_t>(buffer.size() - ENTRY_HEADER_SIZE);
+  const auto checksum = murmur_hash2(buffer.data() + ENTRY_HEADER_SIZE, static_cast<int>(entry_size), CHECKSUM_SEED);
+  std::memcpy(buffer.data(), &entry_size, sizeof(entry_size));
+  std::memcpy(buffer.data() + sizeof(entry_size), &checksum, sizeof(checksum));
+
+  return buffer;
+}
+
+RedoLogEntry deserialize_entry(const char* begin, const char* end) {
+  auto reader = BufferReader{begin, end};
+  auto entry = RedoLogEntry{};
+
+  entry.commit_id = reader.read_value<CommitID>();
+  const auto record_count = reader.read_value<uint32_t>();
+
+  for (auto record_idx = uint32_t{0}; record_idx < record_count; ++record_idx) {
+    auto record = RedoLogRecord{};
+    record.type = reader.read_value<RedoLogRecordType>();
+    record.table_name = reader.read_string();
+
+    const auto row_count = reader.read_value<uint32_t>();
+    for (auto row_idx = uint32_t{0}; row_idx < row_count; ++row_idx) {
+      const auto chunk_id = reader.read_value<ChunkID>();
+      const auto chunk_offset = reader.read_value<ChunkOffset>();
+      record.row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+
+    if (record.type == RedoLogRecordType::Insert) {
+      for (auto row_idx = uint32_t{0}; row_idx < row_count; ++row_idx) {
+        const auto column_count = reader.read_value<uint16_t>();
+        auto& row = record.rows.emplace_back();
+        for (auto column_idx = uint16_t{0}; column_idx < column_count; ++column_idx) {
+          row.emplace_back(reader.read_variant());
+        }
+      }
+    }
+
+    entry.records.emplace_back(std::move(record));
+  }
+
+  return entry;
+}
+
+}  // namespace
+
+namespace opossum {
+
+RedoLog& RedoLog::get() {
+  static RedoLog instance;
+  return instance;
+}
+
+void RedoLog::reset() { get().close(); }
+
+RedoLog::~RedoLog() { close(); }
+
+void RedoLog::open(const std::string& file_name, const std::chrono::microseconds group_commit_delay) {
+  Assert(!is_open(), "The redo log is already open");
+
+  const auto file_descriptor = ::open(file_name.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(file_descriptor != -1, "Cannot open redo log " + file_name + ": " + std::strerror(errno));
+
+  const auto file_size = ::lseek(file_descriptor, 0, SEEK_END);
+  if (file_size == -1) {
+    const auto error = errno;
+    ::close(file_descriptor);
+    Fail("Cannot open redo log " + file_name + ": " + std::strerror(error));
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _file_descriptor = file_descriptor;
+    _end_offset = static_cast<uint64_t>(file_size);
+    _group_commit_delay = group_commit_delay;
+    _shutdown = false;
+    _flush_requested = false;
+  }
+
+  _thread = std::thread(&RedoLog::_write_batches, this);
+}
+
+void RedoLog::close() {
+  if (!_thread.joinable()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _shutdown = true;
+  }
+  _pending_condition_variable.notify_one();
+  _thread.join();
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  ::close(_file_descriptor);
+  _file_descriptor = -1;
+  _end_offset = 0;
+}
+
+bool RedoLog::is_open() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _file_descriptor != -1 && !_shutdown;
+}
+
+bool RedoLog::log_commit(const RedoLogEntry& entry, std::function<void()> on_durable) {
+  // Serialize outside of the lock, so that committing transactions only contend for appending the bytes
+  const auto serialized_entry = serialize_entry(entry);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_file_descriptor == -1 || _shutdown) return false;
+
+    _pending_entries.insert(_pending_entries.end(), serialized_entry.begin(), serialized_entry.end());
+    _end_offset += serialized_entry.size();
+    _pending_callbacks.emplace_back(std::move(on_durable));
+    ++_logged_entry_count;
+  }
+  _pending_condition_variable.notify_one();
+  return true;
+}
+
+void RedoLog::flush() {
+  std::unique_lock<std::mutex> lock(_mutex);
+  const auto logged_entry_count = _logged_entry_count;
+  if (_durable_entry_count >= logged_entry_count) return;
+
+  _flush_requested = true;
+  _pending_condition_variable.notify_one();
+  _durable_condition_variable.wait(lock, [&]() { return _durable_entry_count >= logged_entry_count; });
+}
+
+size_t RedoLog::flush_count() const { return _flush_count; }
+
+uint64_t RedoLog::end_offset() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _end_offset;
+}
+
+std::vector<RedoLogEntry> RedoLog::read_entries(const std::string& file_name, const uint64_t offset) {
+  std::ifstream file(file_name, std::ios::binary);
+  Assert(file.good(), "Cannot open redo log " + file_name);
+
+  // The entries before the offset are not needed, e.g., because they are part of a checkpoint
+  file.seekg(0, std::ios::end);
+  Assert(static_cast<uint64_t>(file.tellg()) >= offset, "Redo log " + file_name + " ends before offset");
+  file.seekg(static_cast<std::streamoff>(offset));
+
+  const auto content = std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+  auto entries = std::vector<RedoLogEntry>{};
+  auto position = size_t{0};
+
+  // Stop at the first incomplete or corrupt entry, which was being written when the process terminated
+  while (content.size() - position >= ENTRY_HEADER_SIZE) {
+    auto entry_size = uint32_t{0};
+    auto checksum = uint32_t{0};
+    std::memcpy(&entry_size, content.data() + position, sizeof(entry_size));
+    std::memcpy(&checksum, content.data() + position + sizeof(entry_size), sizeof(checksum));
+
+    const auto* entry_begin = content.data() + position + ENTRY_HEADER_SIZE;
+    if (content.size() - position - ENTRY_HEADER_SIZE < entry_size) break;
+    if (murmur_hash2(entry_begin, static_cast<int>(entry_size), CHECKSUM_SEED) != checksum) break;
+
+    entries.emplace_back(deserialize_entry(entry_begin, entry_begin + entry_size));
+    position += ENTRY_HEADER_SIZE + entry_size;
+  }
+
+  return entries;
+}
+
+void RedoLog::_write_batches() {
+  while (true) {
+    auto batch = std::vector<char>{};
+    auto callbacks = std::vector<std::function<void()>>{};
+
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _pending_condition_variable.wait(lock, [&]() { return _shutdown || !_pending_callbacks.empty(); });
+
+      // Wait for more entries to share the fsync with
+      if (_group_commit_delay.count() > 0 && !_shutdown) {
+        _pending_condition_variable.wait_for(lock, _group_commit_delay,
+                                             [&]() { return _shutdown || _flush_requested; });
+      }
+
+      if (_pending_callbacks.empty()) return;
+
+      std::swap(batch, _pending_entries);
+      std::swap(callbacks, _pending_callbacks);
+      _flush_requested = false;
+    }
+
+    auto bytes_written = size_t{0};
+    while (bytes_written < batch.size()) {
+      const auto result = ::write(_file_descriptor, batch.data() + bytes_written, batch.size() - bytes_written);
+      if (result == -1 && errno == EINTR) continue;
+      Assert(result != -1, std::string{"Cannot write redo log: "} + std::strerror(errno));
+      bytes_written += static_cast<size_t>(result);
+    }
+
+    Assert(::fdatasync(_file_descriptor) == 0, std::string{"Cannot sync redo log: "} + std::strerror(errno));
+    ++_flush_count;
+
+    for (const auto& callback : callbacks) {
+      if (callback) callback();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _durable_entry_count += callbacks.size();
+    }
+    _durable_condition_variable.notify_all();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "redo_log_record.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Write-ahead redo log that makes committed transactions durable.
+ *
+ * When a transaction that modified tables commits, the Inserts and Deletes add RedoLogRecords to its
+ * TransactionContext, which hands them to the log as one RedoLogEntry. The transaction only becomes visible and its
+ * commit callback is only called once the entry is on disk.
+ *
+ * Entries are written by a background thread with group commit: All entries that arrive while the thread writes and
+ * syncs a batch are written with the next batch, so that concurrently committing transactions share a single fsync.
+ * Optionally, the thread waits for group_commit_delay after the first entry of a batch to collect more entries.
+ *
+ * The log is closed by default, in which case nothing is logged and commits are not delayed.
+ *
+ * Records identify rows by their RowIDs. Thus, rows must not be moved while the log is open, which is why chunks
+ * cannot be sorted by the ChunkCompressionTask then.
+ *
+ * Each entry is stored as follows:
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Entry size            | uint32_t                              |   4
+ * Checksum              | uint32_t (murmur2 of the following)   |   4
+ * Commit ID             | CommitID                              |   4
+ * Record count          | uint32_t                              |   4
+ * Records               | see below                             |   Entry size - 8
+ *
+ * Record:
+ * Type                  | RedoLogRecordType                     |   1
+ * Table name length     | uint32_t                              |   4
+ * Table name            | char array                            |   Table name length
+ * Row count             | uint32_t                              |   4
+ * Row IDs               | (ChunkID, ChunkOffset) array          |   Row count * 8
+ * Inserts only, per row:
+ * Column count          | uint16_t                              |   2
+ * Values                | DataType followed by the value, for   |
+ *                       | strings the length (uint32_t) first   |
+ *
+ * An entry that was written only partially, i.e., during a crash, is detected by its size and checksum.
+ */
+class RedoLog final : private Noncopyable {
+ public:
+  static RedoLog& get();
+
+  // Closes the log, must not be called while transactions commit
+  static void reset();
+
+  /**
+   * Opens the log file, entries are appended to existing ones.
+   */
+  void open(const std::string& file_name,
+            const std::chrono::microseconds group_commit_delay = std::chrono::microseconds{0});
+
+  // Writes all pending entries and closes the log file
+  void close();
+
+  bool is_open() const;
+
+  /**
+   * Appends the entry of a committing transaction. on_durable is called from the log's thread once the entry is on
+   * disk. If an entry cannot be written, the process is terminated, as the transaction could not be made durable.
+   *
+   * @return false if the log is not open, in which case on_durable is not called
+   */
+  bool log_commit(const RedoLogEntry& entry, std::function<void()> on_durable);
+
+  // Blocks until all entries logged before are on disk, without waiting for the group commit delay
+  void flush();
+
+  // The number of batches written, i.e., the number of fsyncs
+  size_t flush_count() const;
+
+  /**
+   * The offset in the log file at which the next logged entry starts, i.e., the file size once all pending entries
+   * are written. 0 if the log is closed.
+   */
+  uint64_t end_offset() const;
+
+  // Reads the complete entries of a log file that start at offset or later, in the order in which they were written
+  static std::vector<RedoLogEntry> read_entries(const std::string& file_name, const uint64_t offset = 0);
+
+ protected:
+  RedoLog() = default;
+  ~RedoLog();
+
+  void _write_batches();
+
+  mutable std::mutex _mutex;
+  std::condition_variable _pending_condition_variable;
+  std::condition_variable _durable_condition_variable;
+
+  int _file_descriptor{-1};
+  std::chrono::microseconds _group_commit_delay{0};
+  std::thread _thread;
+  bool _shutdown{false};
+  bool _flush_requested{false};
+
+  // Entries that wait to be written, serialized, and the callbacks of their transactions
+  std::vector<char> _pending_entries;
+  std::vector<std::function<void()>> _pending_callbacks;
+
+  // File offset after the logged entries, including the pending ones
+  uint64_t _end_offset{0};
+  uint64_t _logged_entry_count{0};
+  uint64_t _durable_entry_count{0};
+  std::atomic<size_t> _flush_count{0};
+};
+
+}  // namespace opossum
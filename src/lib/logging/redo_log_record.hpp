@@ -0,0 +1,34 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+enum class RedoLogRecordType : uint8_t { Insert, Delete };
+
+/**
+ * The rows a committed Insert or Delete (also as part of an Update) wrote to a table. Rows are identified by their
+ * RowIDs, so that replaying the log restores the same positions that later records refer to.
+ */
+struct RedoLogRecord {
+  RedoLogRecordType type;
+  std::string table_name;
+  std::vector<RowID> row_ids;
+
+  // Insert only: The values of each inserted row
+  std::vector<std::vector<AllTypeVariant>> rows;
+};
+
+/**
+ * All records of a committed transaction
+ */
+struct RedoLogEntry {
+  CommitID commit_id;
+  std::vector<RedoLogRecord> records;
+};
+
+}  // namespace opossum
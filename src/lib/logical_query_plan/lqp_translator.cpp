@@ -29,6 +29,7 @@
 #include "operators/maintenance/show_columns.hpp"
 #include "operators/maintenance/show_tables.hpp"
 #include "operators/pqp_expression.hpp"
+#include "operators/primary_key_lookup.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
@@ -143,6 +144,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(predicate_node->left_input());
   const auto table_name = stored_table_node->table_name();
   const auto table = StorageManager::get().get_table(table_name);
+
+  // The primary key index covers all chunks, so no TableScan is needed for the remaining ones
+  if (PrimaryKeyLookup::is_applicable(*table, column_id, predicate_node->predicate_condition(), value)) {
+    return std::make_shared<PrimaryKeyLookup>(input_operator, column_id, value_variant);
+  }
+
   std::vector<ChunkID> indexed_chunks;
 
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
@@ -3,10 +3,12 @@
 #include <chrono>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
@@ -23,6 +25,9 @@ OperatorType AbstractOperator::type() const { return _type; }
 void AbstractOperator::execute() {
   DebugAssert(!_output, "Operator has already been executed");
 
+  // Do not start operators of a cancelled query
+  CancellationToken::check_this_thread();
+
   auto start = std::chrono::high_resolution_clock::now();
 
   auto transaction_context = this->transaction_context();
@@ -37,7 +42,13 @@ void AbstractOperator::execute() {
       return;
     }
     transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
+    try {
+      _output = _on_execute(transaction_context);
+    } catch (...) {
+      // E.g., the query was cancelled. A rollback waits for all active operators to finish.
+      transaction_context->on_operator_finished();
+      throw;
+    }
     transaction_context->on_operator_finished();
   } else {
     _output = _on_execute(nullptr);
@@ -76,6 +87,24 @@ std::shared_ptr<AbstractOperator> AbstractOperator::recreate(const std::vector<A
   return _recreate_impl(recreated_ops, args);
 }
 
+std::shared_ptr<AbstractOperator> AbstractOperator::recreate_with_inputs(
+    const std::shared_ptr<AbstractOperator>& left, const std::shared_ptr<AbstractOperator>& right) const {
+  return _on_recreate({}, left, right);
+}
+
+bool AbstractOperator::is_chunkwise() const { return false; }
+
+void AbstractOperator::restrict_input_chunks(const ChunkID begin, const ChunkID end) {
+  DebugAssert(is_chunkwise(), "Only chunk-wise operators can be restricted to chunks of their input");
+  DebugAssert(begin <= end, "Invalid chunk range");
+  _restricted_input_chunks = std::make_pair(begin, end);
+}
+
+std::pair<ChunkID, ChunkID> AbstractOperator::_input_chunk_range() const {
+  if (_restricted_input_chunks) return *_restricted_input_chunks;
+  return {ChunkID{0}, input_table_left()->chunk_count()};
+}
+
 std::shared_ptr<const Table> AbstractOperator::input_table_left() const { return _input_left->get_output(); }
 
 std::shared_ptr<const Table> AbstractOperator::input_table_right() const { return _input_right->get_output(); }
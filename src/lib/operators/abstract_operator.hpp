@@ -1,8 +1,10 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
@@ -10,6 +12,7 @@
 
 namespace opossum {
 
+class OperatorPipeline;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -31,6 +34,7 @@ enum class OperatorType {
   JoinSortMerge,
   JoinMPSM,
   Limit,
+  PrimaryKeyLookup,
   Print,
   Product,
   Projection,
@@ -44,6 +48,7 @@ enum class OperatorType {
   CreateView,
   DropView,
   ShowColumns,
+  ShowMemory,
   ShowTables,
 
   Mock  // for Tests that need to Mock operators
@@ -96,6 +101,20 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // An operator needs to implement this method in order to be cacheable.
   virtual std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const;
 
+  // Returns a new instance of the same operator with the same configuration (see recreate()) that reads from the given
+  // input operators, which are not recreated.
+  std::shared_ptr<AbstractOperator> recreate_with_inputs(const std::shared_ptr<AbstractOperator>& left,
+                                                         const std::shared_ptr<AbstractOperator>& right = nullptr) const;
+
+  // Chunk-wise operators process each chunk of their left input independently of the other chunks and produce the
+  // output chunks in the order of the input chunks (e.g., TableScan, Validate). Instead of materializing their output,
+  // chains of them can be executed chunk by chunk, see OperatorPipeline.
+  virtual bool is_chunkwise() const;
+
+  // Restricts a chunk-wise operator to the chunks [begin, end) of its left input, so that it only produces the output
+  // for these chunks. Used by OperatorPipeline.
+  void restrict_input_chunks(const ChunkID begin, const ChunkID end);
+
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
   std::shared_ptr<const AbstractOperator> input_right() const;
@@ -139,6 +158,9 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
       const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const = 0;
 
+  // The chunks [first, second) of the left input that a chunk-wise operator processes, see restrict_input_chunks()
+  std::pair<ChunkID, ChunkID> _input_chunk_range() const;
+
   const OperatorType _type;
 
   // Shared pointers to input operators, can be nullptr.
@@ -154,6 +176,12 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   PerformanceData _performance_data;
 
   std::weak_ptr<OperatorTask> _operator_task;
+
+  // Set by restrict_input_chunks(), all chunks are processed otherwise
+  std::optional<std::pair<ChunkID, ChunkID>> _restricted_input_chunks;
+
+  // Executes pipelined operators in place of their execute() and thus sets the output of the last one
+  friend class OperatorPipeline;
 };
 
 }  // namespace opossum
@@ -5,15 +5,16 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/parallel_for.hpp"
+#include "storage/base_dictionary_column.hpp"
 #include "storage/create_iterable_from_column.hpp"
+#include "storage/dictionary_column/dictionary_column_builder.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 
@@ -281,32 +282,41 @@ void Aggregate::_aggregate_column(ChunkID chunk_id, ColumnID column_index, const
   auto& results = *context.results;
   auto& hash_keys = _keys_per_chunk[chunk_id];
 
-  resolve_column_type<ColumnDataType>(base_column, [&results, &hash_keys, aggregator](const auto& typed_column) {
+  resolve_column_type<ColumnDataType>(base_column, [&results, &hash_keys, chunk_id,
+                                                    aggregator](const auto& typed_column) {
     auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
 
     ChunkOffset chunk_offset{0};
 
+    // If the input is sorted by the group key, all rows of a group are adjacent. By remembering the group of the
+    // previous row, each group is looked up in the result map only once and the groups are effectively streamed.
+    const AggregateKey* current_key = nullptr;
+    AggregateResult<AggregateType, ColumnDataType>* current_result = nullptr;
+
     // Now that all relevant types have been resolved, we can iterate over the column and build the aggregations.
     iterable.for_each([&, aggregator](const auto& value) {
-      if (value.is_null()) {
+      const auto& hash_key = (*hash_keys)[chunk_offset];
+      if (!current_key || hash_key != *current_key) {
         /**
          * If the value is NULL, the current aggregate value does not change.
          * However, if we do not have a result entry for the current hash key, i.e., group value,
-         * we need to insert an empty AggregateResult into the results.
-         * Hence, the try_emplace with no constructing arguments.
+         * we need to insert an empty AggregateResult into the results, which operator[] does.
          */
-        results.try_emplace((*hash_keys)[chunk_offset]);
-      } else {
+        current_key = &hash_key;
+        current_result = &results[hash_key];
+        if (current_result->row_id == NULL_ROW_ID) current_result->row_id = RowID{chunk_id, chunk_offset};
+      }
+
+      if (!value.is_null()) {
         // If we have a value, use the aggregator lambda to update the current aggregate value for this group
-        results[(*hash_keys)[chunk_offset]].current_aggregate =
-            aggregator(value.value(), results[(*hash_keys)[chunk_offset]].current_aggregate);
+        current_result->current_aggregate = aggregator(value.value(), current_result->current_aggregate);
 
         // increase value counter
-        ++results[(*hash_keys)[chunk_offset]].aggregate_count;
+        ++current_result->aggregate_count;
 
         if (function == AggregateFunction::CountDistinct) {
           // for the case of CountDistinct, insert this value into the set to keep track of distinct values
-          results[(*hash_keys)[chunk_offset]].distinct_values.insert(value.value());
+          current_result->distinct_values.insert(value.value());
         }
       }
 
@@ -315,6 +325,28 @@ void Aggregate::_aggregate_column(ChunkID chunk_id, ColumnID column_index, const
   });
 }
 
+namespace {
+
+// Returns true if all values of the column are stored in DictionaryColumns, possibly behind ReferenceColumns
+bool is_dictionary_encoded(const Table& table, const ColumnID column_id) {
+  if (table.chunk_count() == 0) return false;
+
+  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+    const auto column = table.get_chunk(chunk_id)->get_column(column_id);
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      if (!is_dictionary_encoded(*reference_column->referenced_table(), reference_column->referenced_column_id())) {
+        return false;
+      }
+    } else if (!std::dynamic_pointer_cast<const BaseDictionaryColumn>(column)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
 std::shared_ptr<const Table> Aggregate::_on_execute() {
   auto input_table = input_table_left();
 
@@ -338,43 +370,54 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
   */
   _keys_per_chunk = std::vector<std::shared_ptr<std::vector<AggregateKey>>>(input_table->chunk_count());
 
-  std::vector<std::shared_ptr<AbstractTask>> jobs;
-  jobs.reserve(input_table->chunk_count());
-
+  auto chunk_sizes = std::vector<size_t>(input_table->chunk_count());
   for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
-    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, this]() {
-      auto chunk_in = input_table->get_chunk(chunk_id);
+    chunk_sizes[chunk_id] = input_table->chunk_size(chunk_id);
+  }
 
-      auto hash_keys = std::make_shared<std::vector<AggregateKey>>(chunk_in->size());
+  // The keys are allocated upfront, so that the morsels of a chunk can fill them concurrently
+  parallel_for(ChunkID{0}, input_table->chunk_count(), [&](const ChunkID chunk_id) {
+    _keys_per_chunk[chunk_id] = std::make_shared<std::vector<AggregateKey>>(chunk_sizes[chunk_id]);
+  });
 
-      // Partition by group columns
-      for (const auto column_id : _groupby_column_ids) {
-        auto base_column = chunk_in->get_column(column_id);
+  // Only chunks of data tables are split into morsels, as ReferenceColumns cannot be iterated in ranges
+  const auto split_chunks = input_table->type() == TableType::Data;
 
-        resolve_data_and_column_type(*base_column, [&](auto type, auto& typed_column) {
-          using ColumnDataType = typename decltype(type)::type;
+  parallel_for_morsels(chunk_sizes, split_chunks, [&](const size_t chunk_index, const size_t begin, const size_t end) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
+    auto chunk_in = input_table->get_chunk(chunk_id);
 
-          auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+    auto& hash_keys = *_keys_per_chunk[chunk_id];
 
-          ChunkOffset chunk_offset{0};
-          iterable.for_each([&](const auto& value) {
-            if (value.is_null()) {
-              (*hash_keys)[chunk_offset].emplace_back(NULL_VALUE);
-            } else {
-              (*hash_keys)[chunk_offset].emplace_back(value.value());
-            }
+    // Partition by group columns
+    for (const auto column_id : _groupby_column_ids) {
+      auto base_column = chunk_in->get_column(column_id);
 
-            ++chunk_offset;
-          });
-        });
-      }
+      resolve_data_and_column_type(*base_column, [&](auto type, auto& typed_column) {
+        using ColumnDataType = typename decltype(type)::type;
+        using ColumnType = std::decay_t<decltype(typed_column)>;
 
-      _keys_per_chunk[chunk_id] = hash_keys;
-    }));
-    jobs.back()->schedule();
-  }
+        auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
 
-  CurrentScheduler::wait_for_tasks(jobs);
+        auto chunk_offset = static_cast<ChunkOffset>(begin);
+        const auto add_to_key = [&](const auto& value) {
+          if (value.is_null()) {
+            hash_keys[chunk_offset].emplace_back(NULL_VALUE);
+          } else {
+            hash_keys[chunk_offset].emplace_back(value.value());
+          }
+
+          ++chunk_offset;
+        };
+
+        if constexpr (std::is_same_v<ColumnType, ReferenceColumn>) {
+          iterable.for_each(add_to_key);
+        } else {
+          iterable.for_each(static_cast<ChunkOffset>(begin), static_cast<ChunkOffset>(end), add_to_key);
+        }
+      });
+    }
+  });
 
   /*
   AGGREGATION PHASE
@@ -441,11 +484,15 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
       auto context = std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType>>(
           _contexts_per_column[0]);
       auto& results = *context->results;
-      for (auto& chunk : _keys_per_chunk) {
-        for (auto& keys : *chunk) {
-          // insert dummy value to make sure we have the key in our map
-          results[keys] = AggregateResult<DistinctAggregateType, DistinctColumnType>();
-        }
+      const auto& keys_of_chunk = *_keys_per_chunk[chunk_id];
+      const AggregateKey* previous_keys = nullptr;
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < keys_of_chunk.size(); ++chunk_offset) {
+        const auto& keys = keys_of_chunk[chunk_offset];
+        // insert dummy value to make sure we have the key in our map, skipping runs of equal keys
+        if (previous_keys && keys == *previous_keys) continue;
+        const auto [result_it, inserted] = results.try_emplace(keys);
+        if (inserted) result_it->second.row_id = RowID{chunk_id, chunk_offset};
+        previous_keys = &keys;
       }
     } else {
       ColumnID column_index{0};
@@ -475,9 +522,17 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
 
           auto& results = *context->results;
 
-          // count occurrences for each group key
-          for (const auto& hash_key : *hash_keys) {
-            ++results[hash_key].aggregate_count;
+          // count occurrences for each group key, looking up each run of equal keys only once (see _aggregate_column)
+          const AggregateKey* current_key = nullptr;
+          AggregateResult<CountAggregateType, CountColumnType>* current_result = nullptr;
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < hash_keys->size(); ++chunk_offset) {
+            const auto& hash_key = (*hash_keys)[chunk_offset];
+            if (!current_key || hash_key != *current_key) {
+              current_key = &hash_key;
+              current_result = &results[hash_key];
+              if (current_result->row_id == NULL_ROW_ID) current_result->row_id = RowID{chunk_id, chunk_offset};
+            }
+            ++current_result->aggregate_count;
           }
 
           ++column_index;
@@ -546,6 +601,7 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
       for (size_t group_column_index = 0; group_column_index < map.first.size(); ++group_column_index) {
         _groupby_columns[group_column_index]->append(map.first[group_column_index]);
       }
+      _groupby_row_ids.push_back(map.second.row_id);
     }
   }
 
@@ -565,6 +621,27 @@ std::shared_ptr<const Table> Aggregate::_on_execute() {
     ++column_index;
   }
 
+  // Group-by columns that are dictionary-encoded in the input are dictionary-encoded in the output as well. The group
+  // keys are taken from the first row of each group, so that the output shares the input dictionary if there is only
+  // one, and long strings flowing through the aggregation are not copied and sorted again.
+  for (auto groupby_column_index = size_t{0}; groupby_column_index < _groupby_column_ids.size();
+       ++groupby_column_index) {
+    const auto column_id = _groupby_column_ids[groupby_column_index];
+    if (!is_dictionary_encoded(*input_table, column_id)) continue;
+
+    resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto builder = DictionaryColumnBuilder<ColumnDataType>{_groupby_row_ids.size()};
+      for (const auto& row_id : _groupby_row_ids) {
+        const auto appended =
+            builder.append(input_table->get_chunk(row_id.chunk_id)->get_column(column_id), row_id.chunk_offset);
+        Assert(appended, "Group-by column was expected to be dictionary-encoded");
+      }
+      _output_columns[groupby_column_index] = builder.build();
+    });
+  }
+
   // Write the output
   _output = std::make_shared<Table>(_output_column_definitions, TableType::Data);
   _output->append_chunk(_output_columns);
@@ -723,6 +800,7 @@ void Aggregate::write_aggregate_output(ColumnID column_index) {
       for (size_t group_column_index = 0; group_column_index < map.first.size(); ++group_column_index) {
         _groupby_columns[group_column_index]->append(map.first[group_column_index]);
       }
+      _groupby_row_ids.push_back(map.second.row_id);
     }
   }
 
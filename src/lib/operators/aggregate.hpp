@@ -49,12 +49,14 @@ For implementation details, please check the wiki: https://github.com/hyrise/hyr
 /*
 Current aggregated value and the number of rows that were used.
 The latter is used for AVG and COUNT.
+The position of the first row of the group is used to take the group key from the input columns.
 */
 template <typename AggregateType, typename ColumnDataType>
 struct AggregateResult {
   std::optional<AggregateType> current_aggregate;
   size_t aggregate_count = 0;
   std::set<ColumnDataType> distinct_values;
+  RowID row_id = NULL_ROW_ID;
 };
 
 /*
@@ -129,6 +131,8 @@ class Aggregate : public AbstractReadOnlyOperator {
   ChunkColumns _output_columns;
 
   ChunkColumns _groupby_columns;
+  // Positions of the first rows of the groups in the input, in the order of the output
+  std::vector<RowID> _groupby_row_ids;
   std::vector<std::shared_ptr<ColumnVisitableContext>> _contexts_per_column;
   std::vector<std::shared_ptr<std::vector<AggregateKey>>> _keys_per_chunk;
 };
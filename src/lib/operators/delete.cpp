@@ -2,8 +2,11 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/redo_log.hpp"
 #include "optimizer/table_statistics.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
@@ -63,6 +66,14 @@ void Delete::_on_commit_records(const CommitID cid) {
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
   }
+
+  if (!RedoLog::get().is_open()) return;
+
+  auto record = RedoLogRecord{RedoLogRecordType::Delete, _table_name, {}, {}};
+  for (const auto& pos_list : _pos_lists) {
+    record.row_ids.insert(record.row_ids.end(), pos_list->begin(), pos_list->end());
+  }
+  transaction_context()->add_redo_log_record(std::move(record));
 }
 
 void Delete::_finish_commit() {
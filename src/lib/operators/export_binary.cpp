@@ -160,15 +160,19 @@ void ExportBinary::_write_header(const std::shared_ptr<const Table>& table, std:
 
 void ExportBinary::_write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream,
                                 const ChunkID& chunk_id) {
-  const auto chunk = table->get_chunk(chunk_id);
+  _write_chunk(table, ofstream, *table->get_chunk(chunk_id));
+}
+
+void ExportBinary::_write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream,
+                                const Chunk& chunk) {
   const auto context = std::make_shared<ExportContext>(ofstream);
 
-  _export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+  _export_value(ofstream, static_cast<ChunkOffset>(chunk.size()));
 
   // Iterating over all columns of this chunk and exporting them
-  for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); column_id++) {
     auto visitor = make_unique_by_data_type<ColumnVisitable, ExportBinaryVisitor>(table->column_data_type(column_id));
-    chunk->get_column(column_id)->visit(*visitor, context);
+    chunk.get_column(column_id)->visit(*visitor, context);
   }
 }
 
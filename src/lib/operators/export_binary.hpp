@@ -40,6 +40,9 @@ class ExportBinary : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
 
  private:
+  // Writes tables and chunks of checkpoints
+  friend class Checkpoint;
+
   // Path of the binary file
   const std::string _filename;
 
@@ -79,6 +82,9 @@ class ExportBinary : public AbstractReadOnlyOperator {
    */
   static void _write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream, const ChunkID& chunk_id);
 
+  // Writes the given chunk of the table, which does not need to be part of the table, in the format described above
+  static void _write_chunk(const std::shared_ptr<const Table>& table, std::ofstream& ofstream, const Chunk& chunk);
+
   template <typename T>
   class ExportBinaryVisitor;
 
@@ -123,14 +123,18 @@ std::pair<std::shared_ptr<Table>, ChunkID> ImportBinary::_read_header(std::ifstr
 }
 
 void ImportBinary::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+  table->append_chunk(_import_columns(file, *table));
+}
+
+ChunkColumns ImportBinary::_import_columns(std::ifstream& file, const Table& table) {
   const auto row_count = _read_value<ChunkOffset>(file);
 
   ChunkColumns output_columns;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
     output_columns.push_back(
-        _import_column(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
+        _import_column(file, row_count, table.column_data_type(column_id), table.column_is_nullable(column_id)));
   }
-  table->append_chunk(output_columns);
+  return output_columns;
 }
 
 std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, ChunkOffset row_count, DataType data_type,
@@ -80,6 +80,9 @@ class ImportBinary : public AbstractReadOnlyOperator {
    */
   static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
 
+  // Reads a chunk in the format described above and returns its columns, without adding them to the table
+  static ChunkColumns _import_columns(std::ifstream& file, const Table& table);
+
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
   static std::shared_ptr<BaseColumn> _import_column(std::ifstream& file, ChunkOffset row_count, DataType data_type,
                                                     bool is_nullable);
@@ -153,6 +156,9 @@ class ImportBinary : public AbstractReadOnlyOperator {
   static T _read_value(std::ifstream& file);
 
  private:
+  // Reads tables and chunks of checkpoints
+  friend class Checkpoint;
+
   // Name of the import file
   const std::string _filename;
   // Name for adding the table to the StorageManager
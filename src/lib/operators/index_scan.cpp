@@ -1,13 +1,23 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
 
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "operators/table_scan/like_table_scan_impl.hpp"
+#include "resolve_type.hpp"
+#include "type_cast.hpp"
 
+#include "scheduler/parallel_for.hpp"
+
+#include "storage/dictionary_column.hpp"
 #include "storage/index/base_index.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
 
 #include "utils/assert.hpp"
 
@@ -25,8 +35,21 @@ IndexScan::IndexScan(const std::shared_ptr<const AbstractOperator> in, const Col
 
 const std::string IndexScan::name() const { return "IndexScan"; }
 
+const std::vector<ColumnID>& IndexScan::left_column_ids() const { return _left_column_ids; }
+
+PredicateCondition IndexScan::predicate_condition() const { return _predicate_condition; }
+
+const std::vector<AllTypeVariant>& IndexScan::right_values() const { return _right_values; }
+
+const std::vector<AllTypeVariant>& IndexScan::right_values2() const { return _right_values2; }
+
 void IndexScan::set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids) { _included_chunk_ids = chunk_ids; }
 
+void IndexScan::set_ordered_output(const std::optional<size_t>& limit) {
+  _ordered_output = true;
+  _limit = limit;
+}
+
 std::shared_ptr<const Table> IndexScan::_on_execute() {
   _in_table = input_table_left();
 
@@ -34,59 +57,151 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  if (_ordered_output) {
+    auto chunk_ids = _included_chunk_ids;
+    if (chunk_ids.empty()) {
+      chunk_ids.resize(_in_table->chunk_count());
+      std::iota(chunk_ids.begin(), chunk_ids.end(), ChunkID{0u});
+    }
+
+    _scan_ordered(chunk_ids);
+    return _out_table;
+  }
+
   std::mutex output_mutex;
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   if (_included_chunk_ids.empty()) {
-    jobs.reserve(_in_table->chunk_count());
-    for (auto chunk_id = ChunkID{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-      jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
-    }
+    parallel_for(ChunkID{0u}, _in_table->chunk_count(),
+                 [&](const ChunkID chunk_id) { _scan_chunk_into_output(chunk_id, output_mutex); });
   } else {
-    jobs.reserve(_included_chunk_ids.size());
-    for (auto chunk_id : _included_chunk_ids) {
-      jobs.push_back(_create_job_and_schedule(chunk_id, output_mutex));
-    }
+    parallel_for(size_t{0}, _included_chunk_ids.size(), [&](const size_t chunk_index) {
+      _scan_chunk_into_output(_included_chunk_ids[chunk_index], output_mutex);
+    });
   }
 
-  CurrentScheduler::wait_for_tasks(jobs);
-
   return _out_table;
 }
 
 std::shared_ptr<AbstractOperator> IndexScan::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
-  return std::make_shared<IndexScan>(recreated_input_left, _index_type, _left_column_ids, _predicate_condition,
-                                     _right_values, _right_values2);
+  auto index_scan = std::make_shared<IndexScan>(recreated_input_left, _index_type, _left_column_ids,
+                                                _predicate_condition, _right_values, _right_values2);
+  if (_ordered_output) index_scan->set_ordered_output(_limit);
+  return index_scan;
+}
+
+void IndexScan::_scan_chunk_into_output(const ChunkID chunk_id, std::mutex& output_mutex) {
+  const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
+
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  // The output chunk is allocated on the same NUMA node as the input chunk. Also, the ChunkAccessCounter is
+  // reused to track accesses of the output chunk. Accesses of derived chunks are counted towards the
+  // original chunk.
+
+  ChunkColumns columns;
+
+  for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+    auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
+    columns.push_back(ref_column_out);
+  }
+
+  std::lock_guard<std::mutex> lock(output_mutex);
+  _out_table->append_chunk(columns, chunk->get_allocator(), chunk->access_counter());
+}
+
+void IndexScan::_scan_ordered(const std::vector<ChunkID>& chunk_ids) {
+  auto matches_per_chunk = std::vector<PosList>(chunk_ids.size());
+
+  parallel_for(size_t{0}, chunk_ids.size(), [&](const size_t chunk_index) {
+    auto& matches = matches_per_chunk[chunk_index];
+    matches = _scan_chunk(chunk_ids[chunk_index]);
+
+    // The matches are in index order, so no chunk contributes more than its first limit rows
+    if (_limit && matches.size() > *_limit) matches.resize(*_limit);
+  });
+
+  const auto matches_out = std::make_shared<PosList>(_merge_ordered(chunk_ids, matches_per_chunk));
+
+  ChunkColumns columns;
+  for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+    columns.push_back(std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out));
+  }
+
+  _out_table->append_chunk(columns);
+  _out_table->get_chunk(ChunkID{0})->set_ordered_by(
+      std::make_pair(_left_column_ids.front(), OrderByMode::AscendingNullsLast));
 }
 
-std::shared_ptr<JobTask> IndexScan::_create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex) {
-  auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-    const auto matches_out = std::make_shared<PosList>(_scan_chunk(chunk_id));
+PosList IndexScan::_merge_ordered(const std::vector<ChunkID>& chunk_ids,
+                                  const std::vector<PosList>& matches_per_chunk) const {
+  const auto column_id = _left_column_ids.front();
 
-    const auto chunk = _in_table->get_chunk(chunk_id);
-    // The output chunk is allocated on the same NUMA node as the input chunk. Also, the ChunkAccessCounter is
-    // reused to track accesses of the output chunk. Accesses of derived chunks are counted towards the
-    // original chunk.
+  auto row_count = size_t{0};
+  for (const auto& matches : matches_per_chunk) row_count += matches.size();
+  if (_limit) row_count = std::min(row_count, *_limit);
 
-    ChunkColumns columns;
+  auto merged_matches = PosList{};
+  merged_matches.reserve(row_count);
 
-    for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-      auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
-      columns.push_back(ref_column_out);
+  resolve_data_type(_in_table->column_data_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Keys are compared by looking up the ValueIDs of the current match of each chunk in the chunk's dictionary
+    auto dictionaries = std::vector<std::shared_ptr<const pmr_vector<ColumnDataType>>>{};
+    auto null_value_ids = std::vector<ValueID>{};
+    auto decoders = std::vector<std::unique_ptr<BaseVectorDecompressor>>{};
+    for (const auto chunk_id : chunk_ids) {
+      const auto column = std::dynamic_pointer_cast<const DictionaryColumn<ColumnDataType>>(
+          _in_table->get_chunk(chunk_id)->get_column(column_id));
+      Assert(column, "Ordered IndexScan requires the first indexed column to be dictionary-encoded");
+
+      dictionaries.push_back(column->dictionary());
+      null_value_ids.push_back(column->null_value_id());
+      decoders.push_back(column->attribute_vector()->create_base_decoder());
     }
 
-    std::lock_guard<std::mutex> lock(output_mutex);
-    _out_table->append_chunk(columns, chunk->get_allocator(), chunk->access_counter());
+    auto positions = std::vector<size_t>(chunk_ids.size(), 0u);
+    const auto value_id_at = [&](const size_t chunk_index) {
+      return ValueID{decoders[chunk_index]->get(matches_per_chunk[chunk_index][positions[chunk_index]].chunk_offset)};
+    };
+
+    // Returns true if the current key of the left chunk is greater than the one of the right chunk, i.e., if the
+    // right chunk's match has to be emitted first. NULLs are greater than all values, ties are broken by the chunk.
+    const auto greater = [&](const size_t left_chunk_index, const size_t right_chunk_index) {
+      const auto left_value_id = value_id_at(left_chunk_index);
+      const auto right_value_id = value_id_at(right_chunk_index);
+      const auto left_is_null = left_value_id == null_value_ids[left_chunk_index];
+      const auto right_is_null = right_value_id == null_value_ids[right_chunk_index];
+
+      if (left_is_null != right_is_null) return left_is_null;
+      if (!left_is_null) {
+        const auto& left_value = (*dictionaries[left_chunk_index])[left_value_id];
+        const auto& right_value = (*dictionaries[right_chunk_index])[right_value_id];
+        if (left_value < right_value) return false;
+        if (right_value < left_value) return true;
+      }
+      return left_chunk_index > right_chunk_index;
+    };
+
+    auto queue = std::priority_queue<size_t, std::vector<size_t>, decltype(greater)>{greater};
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_ids.size(); ++chunk_index) {
+      if (!matches_per_chunk[chunk_index].empty()) queue.push(chunk_index);
+    }
+
+    while (!queue.empty() && merged_matches.size() < row_count) {
+      const auto chunk_index = queue.top();
+      queue.pop();
+
+      merged_matches.push_back(matches_per_chunk[chunk_index][positions[chunk_index]]);
+      if (++positions[chunk_index] < matches_per_chunk[chunk_index].size()) queue.push(chunk_index);
+    }
   });
 
-  job_task->schedule();
-  return job_task;
+  return merged_matches;
 }
 
 void IndexScan::_validate_input() {
-  Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
 
   Assert(_left_column_ids.size() == _right_values.size(),
@@ -96,6 +211,12 @@ void IndexScan::_validate_input() {
            "Count mismatch: left column IDs and right values don’t have same size.");
   }
 
+  if (_predicate_condition == PredicateCondition::Like) {
+    Assert(_left_column_ids.size() == 1u && _in_table->column_data_type(_left_column_ids.front()) == DataType::String &&
+               LikeTableScanImpl::extract_prefix(type_cast<std::string>(_right_values.front())),
+           "IndexScan only supports LIKE with a prefix pattern (e.g., 'abc%') on a single string column.");
+  }
+
   Assert(_in_table->type() == TableType::Data, "IndexScan only supports persistent tables right now.");
 }
 
@@ -155,6 +276,33 @@ PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
       range_end = index->upper_bound(_right_values2);
       break;
     }
+    case PredicateCondition::Like: {
+      // LIKE is case insensitive, so a prefix can match multiple ranges. They are in index order, the last one is
+      // handled below.
+      const auto prefix = *LikeTableScanImpl::extract_prefix(type_cast<std::string>(_right_values.front()));
+      const auto lower_bound = [&](const std::string& value) { return index->lower_bound({value}); };
+
+      // NULLs have the largest ValueID and thus come last in the index. Ranges without an upper bound (e.g., for an
+      // empty prefix) have to end before them.
+      const auto& column = static_cast<const BaseDictionaryColumn&>(*chunk->get_column(_left_column_ids.front()));
+      const auto null_value_id = column.null_value_id();
+      const auto decompressor = column.attribute_vector()->create_base_decoder();
+      auto values_end = index->cend();
+      while (values_end != index->cbegin() && decompressor->get(*std::prev(values_end)) == null_value_id) {
+        --values_end;
+      }
+
+      const auto ranges = LikeTableScanImpl::find_prefix_ranges(prefix, index->cbegin(), values_end, lower_bound);
+      if (ranges.empty()) return matches_out;
+
+      for (auto range_index = size_t{0}; range_index + 1 < ranges.size(); ++range_index) {
+        std::transform(ranges[range_index].first, ranges[range_index].second, std::back_inserter(matches_out),
+                       to_row_id);
+      }
+      range_begin = ranges.back().first;
+      range_end = ranges.back().second;
+      break;
+    }
     default:
       Fail("Unsupported comparison type encountered");
   }
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
 
 #include "abstract_read_only_operator.hpp"
 
@@ -11,11 +14,12 @@
 namespace opossum {
 
 class Table;
-class JobTask;
 
 /**
  * Operator that performs a predicate search using indices
  *
+ * LIKE is only supported for prefix patterns (e.g., 'abc%'), which are answered as index range scans.
+ *
  * Note: Scans only the set of chunks passed to the constructor
  */
 class IndexScan : public AbstractReadOnlyOperator {
@@ -28,6 +32,11 @@ class IndexScan : public AbstractReadOnlyOperator {
 
   const std::string name() const final;
 
+  const std::vector<ColumnID>& left_column_ids() const;
+  PredicateCondition predicate_condition() const;
+  const std::vector<AllTypeVariant>& right_values() const;
+  const std::vector<AllTypeVariant>& right_values2() const;
+
   /**
    * @brief If set, only the specified chunks will be scanned.
    *
@@ -35,6 +44,18 @@ class IndexScan : public AbstractReadOnlyOperator {
    */
   void set_included_chunk_ids(const std::vector<ChunkID>& chunk_ids);
 
+  /**
+   * @brief If set, the output is a single chunk whose rows are ordered by the first indexed column across all scanned
+   *        chunks (ascending, NULLs last). The chunk is marked accordingly, see Chunk::ordered_by().
+   *
+   * The chunks are scanned in parallel as usual. Since the matches of each chunk are in index order, they are then
+   * combined using a k-way merge. Rows with equal keys are ordered by their chunk. With a limit, only the first limit
+   * rows are emitted, so that ORDER BY key LIMIT n can be answered without sorting.
+   *
+   * Requires the first indexed column to be dictionary-encoded, which is the case for all current index types.
+   */
+  void set_ordered_output(const std::optional<size_t>& limit = std::nullopt);
+
  protected:
   std::shared_ptr<const Table> _on_execute() final;
 
@@ -43,8 +64,10 @@ class IndexScan : public AbstractReadOnlyOperator {
       const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
 
   void _validate_input();
-  std::shared_ptr<JobTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
+  void _scan_chunk_into_output(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  void _scan_ordered(const std::vector<ChunkID>& chunk_ids);
+  PosList _merge_ordered(const std::vector<ChunkID>& chunk_ids, const std::vector<PosList>& matches_per_chunk) const;
 
  private:
   const ColumnIndexType _index_type;
@@ -54,6 +77,8 @@ class IndexScan : public AbstractReadOnlyOperator {
   const std::vector<AllTypeVariant> _right_values2;
 
   std::vector<ChunkID> _included_chunk_ids;
+  bool _ordered_output = false;
+  std::optional<size_t> _limit;
 
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<Table> _out_table;
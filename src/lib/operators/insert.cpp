@@ -2,12 +2,17 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "logging/redo_log.hpp"
+#include "optimizer/chunk_statistics/chunk_statistics.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_column.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_column.hpp"
 #include "type_cast.hpp"
@@ -21,6 +26,13 @@ class AbstractTypedColumnProcessor {
   virtual void resize_vector(std::shared_ptr<BaseColumn> column, size_t new_size) = 0;
   virtual void copy_data(std::shared_ptr<const BaseColumn> source, size_t source_start_index,
                          std::shared_ptr<BaseColumn> target, size_t target_start_index, size_t length) = 0;
+
+  // Determines the smallest and the largest non-NULL value of a column of the table that is inserted
+  virtual void determine_value_range(const Table& source_table, ColumnID column_id) = 0;
+
+  // Returns statistics that cover the given statistics of a target column and the value range of the inserted values
+  virtual std::shared_ptr<ChunkColumnStatistics> extend_statistics(
+      const std::shared_ptr<ChunkColumnStatistics>& statistics) = 0;
 };
 
 template <typename T>
@@ -88,6 +100,44 @@ class TypedColumnProcessor : public AbstractTypedColumnProcessor {
       }
     }
   }
+
+  void determine_value_range(const Table& source_table, ColumnID column_id) override {
+    const auto add_value = [&](const T& value) {
+      if (!_value_range) {
+        _value_range.emplace(value, value);
+      } else {
+        _value_range->first = std::min(_value_range->first, value);
+        _value_range->second = std::max(_value_range->second, value);
+      }
+    };
+
+    for (ChunkID chunk_id{0}; chunk_id < source_table.chunk_count(); ++chunk_id) {
+      const auto source = source_table.get_chunk(chunk_id)->get_column(column_id);
+
+      if (auto casted_source = std::dynamic_pointer_cast<const ValueColumn<T>>(source)) {
+        const auto& values = casted_source->values();
+        for (auto i = size_t{0}; i < values.size(); ++i) {
+          if (casted_source->is_nullable() && casted_source->null_values()[i]) continue;
+          add_value(values[i]);
+        }
+      } else {
+        // Same slow path as in copy_data(), which also covers the single NULL value of the Dummy table
+        for (auto i = ChunkOffset{0}; i < source->size(); ++i) {
+          const auto value = (*source)[i];
+          if (!variant_is_null(value)) add_value(type_cast<T>(value));
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<ChunkColumnStatistics> extend_statistics(
+      const std::shared_ptr<ChunkColumnStatistics>& statistics) override {
+    if (!_value_range) return statistics ? statistics : std::make_shared<ChunkColumnStatistics>();
+    return ChunkColumnStatistics::extend_statistics(statistics, _value_range->first, _value_range->second);
+  }
+
+ protected:
+  std::optional<std::pair<T, T>> _value_range;
 };
 
 Insert::Insert(const std::string& target_table_name, const std::shared_ptr<AbstractOperator>& values_to_insert)
@@ -109,6 +159,10 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
   auto total_rows_to_insert = static_cast<uint32_t>(input_table_left()->row_count());
 
+  for (ColumnID column_id{0}; column_id < _target_table->column_count(); ++column_id) {
+    typed_column_processors[column_id]->determine_value_range(*input_table_left(), column_id);
+  }
+
   // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
   // modifying the table's size simultaneously.
   auto start_index = 0u;
@@ -132,6 +186,23 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       auto current_chunk = _target_table->get_chunk(static_cast<ChunkID>(_target_table->chunk_count() - 1));
       auto rows_to_insert_this_loop = std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
 
+      // The inserted rows are not necessarily in order.
+      current_chunk->set_ordered_by(std::nullopt);
+
+      // Extend the zone maps of the chunk before the rows are written, so that concurrent scans never skip them. All
+      // target chunks are extended by the value range of all inserted rows. A chunk that was filled without
+      // statistics (e.g., by Table::append()) keeps none, as they would not cover its existing rows.
+      const auto chunk_statistics = current_chunk->statistics();
+      if (chunk_statistics || current_chunk->size() == 0) {
+        auto column_statistics = std::vector<std::shared_ptr<ChunkColumnStatistics>>{};
+        column_statistics.reserve(current_chunk->column_count());
+        for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
+          const auto statistics = chunk_statistics ? chunk_statistics->statistics()[column_id] : nullptr;
+          column_statistics.emplace_back(typed_column_processors[column_id]->extend_statistics(statistics));
+        }
+        current_chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
+      }
+
       // Resize MVCC vectors.
       current_chunk->mvcc_columns()->grow_by(rows_to_insert_this_loop, MvccColumns::MAX_COMMIT_ID);
 
@@ -154,6 +225,7 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
   // Then, actually insert the data.
+  const auto primary_key_index = _target_table->primary_key_index();
   auto input_offset = 0u;
   auto source_chunk_id = ChunkID{0};
   auto source_chunk_start_index = 0u;
@@ -189,6 +261,13 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
 
+    // The new rows are not visible to other transactions yet, so they can be added to the index right away. Lookups
+    // that find them are filtered by the Validate operator.
+    if (primary_key_index) {
+      primary_key_index->insert(*target_chunk->get_column(primary_key_index->column_id()), target_chunk_id,
+                                start_index, start_index + current_num_rows_to_insert);
+    }
+
     for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
       // we do not need to check whether other operators have locked the rows, we have just created them
       // and they are not visible for other operators.
@@ -214,11 +293,33 @@ void Insert::_on_commit_records(const CommitID cid) {
     mvcc_columns->begin_cids[row_id.chunk_offset] = cid;
     mvcc_columns->tids[row_id.chunk_offset] = 0u;
   }
+  if (!RedoLog::get().is_open()) return;
+
+  auto record = RedoLogRecord{RedoLogRecordType::Insert, _target_table_name,
+                              std::vector<RowID>(_inserted_rows.begin(), _inserted_rows.end()), {}};
+  record.rows.reserve(_inserted_rows.size());
+  for (const auto& row_id : _inserted_rows) {
+    const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+
+    auto& row = record.rows.emplace_back();
+    row.reserve(chunk->column_count());
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      row.emplace_back((*chunk->get_column(column_id))[row_id.chunk_offset]);
+    }
+  }
+  transaction_context()->add_redo_log_record(std::move(record));
 }
 
 void Insert::_on_rollback_records() {
+  const auto primary_key_index = _target_table->primary_key_index();
+
   for (auto row_id : _inserted_rows) {
     auto chunk = _target_table->get_chunk(row_id.chunk_id);
+
+    if (primary_key_index) {
+      const auto key = (*chunk->get_column(primary_key_index->column_id()))[row_id.chunk_offset];
+      primary_key_index->erase(key, row_id);
+    }
     // We set the begin and end cids to 0 (effectively making it invisible for everyone) so that the ChunkCompression
     // does not think that this row is still incomplete. We need to make sure that the end is written before the begin.
     chunk->mvcc_columns()->end_cids[row_id.chunk_offset] = 0u;
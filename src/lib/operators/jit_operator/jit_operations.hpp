@@ -6,7 +6,7 @@
 #include <cmath>
 
 #include "jit_types.hpp"
-#include "operators/table_scan/like_table_scan_impl.hpp"
+#include "operators/table_scan/like_matcher.hpp"
 #include "resolve_type.hpp"
 
 namespace opossum {
@@ -68,17 +68,9 @@ const auto jit_less_than_equals = [](const auto a, const auto b) -> decltype(a <
 const auto jit_greater_than = [](const auto a, const auto b) -> decltype(a > b) { return a > b; };
 const auto jit_greater_than_equals = [](const auto a, const auto b) -> decltype(a >= b) { return a >= b; };
 
-const auto jit_like = [](const std::string a, const std::string b) -> bool {
-  const auto regex_string = LikeTableScanImpl::sqllike_to_regex(b);
-  const auto regex = std::regex{regex_string, std::regex_constants::icase};
-  return std::regex_match(a, regex);
-};
+const auto jit_like = [](const std::string a, const std::string b) -> bool { return LikeMatcher{b}.matches(a); };
 
-const auto jit_not_like = [](const std::string a, const std::string b) -> bool {
-  const auto regex_string = LikeTableScanImpl::sqllike_to_regex(b);
-  const auto regex = std::regex{regex_string, std::regex_constants::icase};
-  return !std::regex_match(a, regex);
-};
+const auto jit_not_like = [](const std::string a, const std::string b) -> bool { return !LikeMatcher{b}.matches(a); };
 
 // The InvalidTypeCatcher acts as a fallback implementation, if template specialization
 // fails for a type combination.
@@ -10,9 +10,7 @@
 
 #include "join_hash/hash_traits.hpp"
 #include "resolve_type.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "scheduler/parallel_for.hpp"
 #include "storage/column_visitable.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "type_cast.hpp"
@@ -177,6 +175,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     size_t mask = static_cast<uint32_t>(pow(2, _radix_bits * (pass + 1)) - 1);
 
     auto chunk_offsets = std::vector<size_t>(in_table->chunk_count());
+    auto chunk_sizes = std::vector<size_t>(in_table->chunk_count());
 
     // fill work queue
     size_t output_offset = 0;
@@ -184,87 +183,83 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       auto column = in_table->get_chunk(chunk_id)->get_column(column_id);
 
       chunk_offsets[chunk_id] = output_offset;
+      chunk_sizes[chunk_id] = column->size();
       output_offset += column->size();
     }
 
-    // create histograms per chunk
+    // create histograms per chunk, including empty chunks, which are skipped below
     histograms = std::vector<std::shared_ptr<std::vector<size_t>>>();
     histograms.resize(chunk_offsets.size());
+    for (auto& histogram : histograms) {
+      histogram = std::make_shared<std::vector<size_t>>(num_partitions);
+    }
 
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
-    jobs.reserve(in_table->chunk_count());
-
-    for (ChunkID chunk_id{0}; chunk_id < in_table->chunk_count(); ++chunk_id) {
-      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
-        // Get information from work queue
-        auto output_offset = chunk_offsets[chunk_id];
-        auto column = in_table->get_chunk(chunk_id)->get_column(column_id);
-        auto& output = static_cast<Partition<T>&>(*elements);
-
-        // prepare histogram
-        histograms[chunk_id] = std::make_shared<std::vector<size_t>>(num_partitions);
-
-        auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
-
-        auto materialized_chunk = std::vector<std::pair<RowID, T>>();
+    // Histograms and offsets are per chunk, so morsels consist of whole chunks. Still, small chunks are grouped.
+    parallel_for_morsels(chunk_sizes, false, [&](const size_t chunk_index, const size_t, const size_t) {
+      const auto chunk_id = static_cast<ChunkID>(chunk_index);
 
-        // Materialize the chunk
-        resolve_column_type<T>(*column, [&, chunk_id, keep_nulls](auto& typed_column) {
-          auto iterable = create_iterable_from_column<T>(typed_column);
+      // Get information from work queue
+      auto output_offset = chunk_offsets[chunk_id];
+      auto column = in_table->get_chunk(chunk_id)->get_column(column_id);
+      auto& output = static_cast<Partition<T>&>(*elements);
 
-          iterable.for_each([&, chunk_id, keep_nulls](const auto& value) {
-            if (!value.is_null() || keep_nulls) {
-              materialized_chunk.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
-            } else {
-              // We need to add this to avoid gaps in the list of offsets when we iterate later on
-              materialized_chunk.emplace_back(NULL_ROW_ID, T{});
-            }
-          });
-        });
+      auto& histogram = static_cast<std::vector<size_t>&>(*histograms[chunk_id]);
 
-        size_t row_id = output_offset;
+      auto materialized_chunk = std::vector<std::pair<RowID, T>>();
 
-        /*
-        For ReferenceColumns we do not use the RowIDs from the referenced tables.
-        Instead, we use the index in the ReferenceColumn itself. This way we can later correctly dereference
-        values from different inputs (important for Multi Joins).
-        For performance reasons this if statement is around the for loop.
-        */
-        if (auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
-          // hash and add to the other elements
-          ChunkOffset offset = 0;
-          for (auto&& elem : materialized_chunk) {
-            if (elem.first.chunk_offset != INVALID_CHUNK_OFFSET) {
-              uint32_t hashed_value = hash_value<T>(elem.second);
-              output[row_id] = PartitionedElement<T>{RowID{chunk_id, offset}, hashed_value, elem.second};
-
-              const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
-              histogram[radix]++;
-
-              row_id++;
-            }
+      // Materialize the chunk
+      resolve_column_type<T>(*column, [&, chunk_id, keep_nulls](auto& typed_column) {
+        auto iterable = create_iterable_from_column<T>(typed_column);
 
-            offset++;
+        iterable.for_each([&, chunk_id, keep_nulls](const auto& value) {
+          if (!value.is_null() || keep_nulls) {
+            materialized_chunk.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
+          } else {
+            // We need to add this to avoid gaps in the list of offsets when we iterate later on
+            materialized_chunk.emplace_back(NULL_ROW_ID, T{});
           }
-        } else {
-          // hash and add to the other elements
-          for (auto&& elem : materialized_chunk) {
-            if (elem.first.chunk_offset == INVALID_CHUNK_OFFSET) continue;
-
+        });
+      });
+
+      size_t row_id = output_offset;
+
+      /*
+      For ReferenceColumns we do not use the RowIDs from the referenced tables.
+      Instead, we use the index in the ReferenceColumn itself. This way we can later correctly dereference
+      values from different inputs (important for Multi Joins).
+      For performance reasons this if statement is around the for loop.
+      */
+      if (auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+        // hash and add to the other elements
+        ChunkOffset offset = 0;
+        for (auto&& elem : materialized_chunk) {
+          if (elem.first.chunk_offset != INVALID_CHUNK_OFFSET) {
             uint32_t hashed_value = hash_value<T>(elem.second);
-            output[row_id] = PartitionedElement<T>{elem.first, hashed_value, elem.second};
+            output[row_id] = PartitionedElement<T>{RowID{chunk_id, offset}, hashed_value, elem.second};
 
             const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
             histogram[radix]++;
 
             row_id++;
           }
+
+          offset++;
         }
-      }));
-      jobs.back()->schedule();
-    }
+      } else {
+        // hash and add to the other elements
+        for (auto&& elem : materialized_chunk) {
+          if (elem.first.chunk_offset == INVALID_CHUNK_OFFSET) continue;
 
-    CurrentScheduler::wait_for_tasks(jobs);
+          uint32_t hashed_value = hash_value<T>(elem.second);
+          output[row_id] = PartitionedElement<T>{elem.first, hashed_value, elem.second};
+
+          const Hash radix = (output[row_id].partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
+          histogram[radix]++;
+
+          row_id++;
+        }
+      }
+    });
 
     return elements;
   }
@@ -317,54 +312,46 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       offset = next_offset;
     }
 
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
-    jobs.reserve(offsets.size());
+    parallel_for(ChunkID{0}, static_cast<ChunkID>(offsets.size()), [&](const ChunkID chunk_id) {
+      // calculate output offsets for each partition
+      auto output_offsets = std::vector<size_t>(num_partitions, 0);
 
-    for (ChunkID chunk_id{0}; chunk_id < offsets.size(); ++chunk_id) {
-      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id] {
-        // calculate output offsets for each partition
-        auto output_offsets = std::vector<size_t>(num_partitions, 0);
-
-        // add up the output offsets for chunks before this one
-        for (ChunkID i{0}; i < chunk_id; ++i) {
-          const auto& histogram = *histograms[i];
-          for (size_t j = 0; j < num_partitions; ++j) {
-            output_offsets[j] += histogram[j];
-          }
-        }
-        for (auto i = chunk_id; i < offsets.size(); ++i) {
-          const auto& histogram = *histograms[i];
-          for (size_t j = 1; j < num_partitions; ++j) {
-            output_offsets[j] += histogram[j - 1];
-          }
+      // add up the output offsets for chunks before this one
+      for (ChunkID i{0}; i < chunk_id; ++i) {
+        const auto& histogram = *histograms[i];
+        for (size_t j = 0; j < num_partitions; ++j) {
+          output_offsets[j] += histogram[j];
         }
-
-        size_t input_offset = offsets[chunk_id];
-
-        size_t input_size = 0;
-        if (chunk_id < offsets.size() - 1) {
-          input_size = offsets[chunk_id + 1] - input_offset;
-        } else {
-          input_size = materialized->size() - input_offset;
+      }
+      for (auto i = chunk_id; i < offsets.size(); ++i) {
+        const auto& histogram = *histograms[i];
+        for (size_t j = 1; j < num_partitions; ++j) {
+          output_offsets[j] += histogram[j - 1];
         }
+      }
 
-        auto& out = static_cast<Partition<T>&>(*output);
-        for (size_t column_offset = input_offset; column_offset < input_offset + input_size; ++column_offset) {
-          auto& element = (*materialized)[column_offset];
+      size_t input_offset = offsets[chunk_id];
 
-          if (!keep_nulls && element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-            continue;
-          }
+      size_t input_size = 0;
+      if (chunk_id < offsets.size() - 1) {
+        input_size = offsets[chunk_id + 1] - input_offset;
+      } else {
+        input_size = materialized->size() - input_offset;
+      }
 
-          const size_t radix = (element.partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
+      auto& out = static_cast<Partition<T>&>(*output);
+      for (size_t column_offset = input_offset; column_offset < input_offset + input_size; ++column_offset) {
+        auto& element = (*materialized)[column_offset];
 
-          out[output_offsets[radix]++] = element;
+        if (!keep_nulls && element.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+          continue;
         }
-      }));
-      jobs.back()->schedule();
-    }
 
-    CurrentScheduler::wait_for_tasks(jobs);
+        const size_t radix = (element.partition_hash >> (32 - _radix_bits * (pass + 1))) & mask;
+
+        out[output_offsets[radix]++] = element;
+      }
+    });
 
     return radix_output;
   }
@@ -374,37 +361,28 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   */
   void _build(const RadixContainer<LeftType>& radix_container,
               std::vector<std::shared_ptr<HashTable<HashedType>>>& hashtables) {
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
-    jobs.reserve(radix_container.partition_offsets.size() - 1);
-
-    for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
-         ++current_partition_id) {
-      jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
-        auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
-        const auto& partition_left_begin = radix_container.partition_offsets[current_partition_id];
-        const auto& partition_left_end = radix_container.partition_offsets[current_partition_id + 1];
-        const auto partition_size = partition_left_end - partition_left_begin;
-
-        // Prune empty partitions, so that we don't have too many empty hash tables
-        if (partition_size == 0) {
-          return;
-        }
-
-        auto hashtable = std::make_shared<HashTable<HashedType>>(partition_size);
+    parallel_for(size_t{0}, radix_container.partition_offsets.size() - 1, [&](const size_t current_partition_id) {
+      auto& partition_left = static_cast<Partition<LeftType>&>(*radix_container.elements);
+      const auto& partition_left_begin = radix_container.partition_offsets[current_partition_id];
+      const auto& partition_left_end = radix_container.partition_offsets[current_partition_id + 1];
+      const auto partition_size = partition_left_end - partition_left_begin;
+
+      // Prune empty partitions, so that we don't have too many empty hash tables
+      if (partition_size == 0) {
+        return;
+      }
 
-        for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end;
-             ++partition_offset) {
-          auto& element = partition_left[partition_offset];
+      auto hashtable = std::make_shared<HashTable<HashedType>>(partition_size);
 
-          hashtable->put(type_cast<HashedType>(element.value), element.row_id);
-        }
+      for (size_t partition_offset = partition_left_begin; partition_offset < partition_left_end;
+           ++partition_offset) {
+        auto& element = partition_left[partition_offset];
 
-        hashtables[current_partition_id] = hashtable;
-      }));
-      jobs.back()->schedule();
-    }
+        hashtable->put(type_cast<HashedType>(element.value), element.row_id);
+      }
 
-    CurrentScheduler::wait_for_tasks(jobs);
+      hashtables[current_partition_id] = hashtable;
+    });
   }
 
   /*
@@ -415,9 +393,6 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   void _probe(const RadixContainer<RightType>& radix_container,
               const std::vector<std::shared_ptr<HashTable<HashedType>>>& hashtables,
               std::vector<PosList>& pos_list_left, std::vector<PosList>& pos_list_right) {
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
-    jobs.reserve(radix_container.partition_offsets.size() - 1);
-
     /*
     NUMA notes:
     At this point both input relations are partitioned using radix partitioning.
@@ -426,133 +401,118 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     and the job that probes that partition should also be on that NUMA node.
     */
 
-    for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
-         ++current_partition_id) {
-      jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
-        // Get information from work queue
-        auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
-        const auto& partition_begin = radix_container.partition_offsets[current_partition_id];
-        const auto& partition_end = radix_container.partition_offsets[current_partition_id + 1];
-
-        // Skip empty partitions to avoid empty output chunks
-        if ((partition_end - partition_begin) == 0) {
-          return;
-        }
+    parallel_for(size_t{0}, radix_container.partition_offsets.size() - 1, [&](const size_t current_partition_id) {
+      // Get information from work queue
+      auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
+      const auto& partition_begin = radix_container.partition_offsets[current_partition_id];
+      const auto& partition_end = radix_container.partition_offsets[current_partition_id + 1];
 
-        PosList pos_list_left_local;
-        PosList pos_list_right_local;
+      // Skip empty partitions to avoid empty output chunks
+      if ((partition_end - partition_begin) == 0) {
+        return;
+      }
 
-        if (hashtables[current_partition_id]) {
-          auto& hashtable = hashtables.at(current_partition_id);
+      PosList pos_list_left_local;
+      PosList pos_list_right_local;
 
-          for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-            auto& row = partition[partition_offset];
+      if (hashtables[current_partition_id]) {
+        auto& hashtable = hashtables.at(current_partition_id);
 
-            if (_mode == JoinMode::Inner && row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-              continue;
-            }
+        for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
+          auto& row = partition[partition_offset];
 
-            // This is where the actual comparison happens. `get` only returns values that match and eliminates hash
-            // collisions.
-            auto row_ids = hashtable->get(row.value);
+          if (_mode == JoinMode::Inner && row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+            continue;
+          }
 
-            if (row_ids) {
-              for (const auto& row_id : *row_ids) {
-                if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
-                  pos_list_left_local.emplace_back(row_id);
-                  pos_list_right_local.emplace_back(row.row_id);
-                }
+          // This is where the actual comparison happens. `get` only returns values that match and eliminates hash
+          // collisions.
+          auto row_ids = hashtable->get(row.value);
+
+          if (row_ids) {
+            for (const auto& row_id : *row_ids) {
+              if (row_id.chunk_offset != INVALID_CHUNK_OFFSET) {
+                pos_list_left_local.emplace_back(row_id);
+                pos_list_right_local.emplace_back(row.row_id);
               }
-              // We assume that the relations have been swapped previously,
-              // so that the outer relation is the probing relation.
-            } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
-              pos_list_left_local.emplace_back(NULL_ROW_ID);
-              pos_list_right_local.emplace_back(row.row_id);
             }
-          }
-        } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
-          /*
-          We assume that the relations have been swapped previously,
-          so that the outer relation is the probing relation.
-
-          Since we did not find a proper hash table,
-          we know that there is no match in Left for this partition.
-          Hence we are going to write NULL values for each row.
-          */
-
-          for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-            auto& row = partition[partition_offset];
+            // We assume that the relations have been swapped previously,
+            // so that the outer relation is the probing relation.
+          } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
             pos_list_left_local.emplace_back(NULL_ROW_ID);
             pos_list_right_local.emplace_back(row.row_id);
           }
         }
+      } else if (_mode == JoinMode::Left || _mode == JoinMode::Right) {
+        /*
+        We assume that the relations have been swapped previously,
+        so that the outer relation is the probing relation.
+
+        Since we did not find a proper hash table,
+        we know that there is no match in Left for this partition.
+        Hence we are going to write NULL values for each row.
+        */
 
-        if (!pos_list_left_local.empty()) {
-          pos_list_left[current_partition_id] = std::move(pos_list_left_local);
-          pos_list_right[current_partition_id] = std::move(pos_list_right_local);
+        for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
+          auto& row = partition[partition_offset];
+          pos_list_left_local.emplace_back(NULL_ROW_ID);
+          pos_list_right_local.emplace_back(row.row_id);
         }
-      }));
-      jobs.back()->schedule();
-    }
+      }
 
-    CurrentScheduler::wait_for_tasks(jobs);
+      if (!pos_list_left_local.empty()) {
+        pos_list_left[current_partition_id] = std::move(pos_list_left_local);
+        pos_list_right[current_partition_id] = std::move(pos_list_right_local);
+      }
+    });
   }
 
   void _probe_semi_anti(const RadixContainer<RightType>& radix_container,
                         const std::vector<std::shared_ptr<HashTable<HashedType>>>& hashtables,
                         std::vector<PosList>& pos_lists) {
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
-    jobs.reserve(radix_container.partition_offsets.size() - 1);
-
-    for (size_t current_partition_id = 0; current_partition_id < (radix_container.partition_offsets.size() - 1);
-         ++current_partition_id) {
-      jobs.emplace_back(std::make_shared<JobTask>([&, current_partition_id]() {
-        // Get information from work queue
-        auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
-        const auto& partition_begin = radix_container.partition_offsets[current_partition_id];
-        const auto& partition_end = radix_container.partition_offsets[current_partition_id + 1];
-
-        // Skip empty partitions to avoid empty output chunks
-        if ((partition_end - partition_begin) == 0) {
-          return;
-        }
+    parallel_for(size_t{0}, radix_container.partition_offsets.size() - 1, [&](const size_t current_partition_id) {
+      // Get information from work queue
+      auto& partition = static_cast<Partition<RightType>&>(*radix_container.elements);
+      const auto& partition_begin = radix_container.partition_offsets[current_partition_id];
+      const auto& partition_end = radix_container.partition_offsets[current_partition_id + 1];
+
+      // Skip empty partitions to avoid empty output chunks
+      if ((partition_end - partition_begin) == 0) {
+        return;
+      }
 
-        PosList pos_list_local;
+      PosList pos_list_local;
 
-        if (auto& hashtable = hashtables[current_partition_id]) {
-          // Valid hashtable found, so there is at least one match in this partition
+      if (auto& hashtable = hashtables[current_partition_id]) {
+        // Valid hashtable found, so there is at least one match in this partition
 
-          for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-            auto& row = partition[partition_offset];
+        for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
+          auto& row = partition[partition_offset];
 
-            if (row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
-              continue;
-            }
+          if (row.row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+            continue;
+          }
 
-            auto matching_rows = hashtable->get(row.value);
+          auto matching_rows = hashtable->get(row.value);
 
-            if ((_mode == JoinMode::Semi && matching_rows) || (_mode == JoinMode::Anti && !matching_rows)) {
-              // Semi: found at least one match for this row -> match
-              // Anti: no matching rows found -> match
-              pos_list_local.emplace_back(row.row_id);
-            }
-          }
-        } else if (_mode == JoinMode::Anti) {
-          // no hashtable on other side, but we are in Anti mode
-          for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
-            auto& row = partition[partition_offset];
+          if ((_mode == JoinMode::Semi && matching_rows) || (_mode == JoinMode::Anti && !matching_rows)) {
+            // Semi: found at least one match for this row -> match
+            // Anti: no matching rows found -> match
             pos_list_local.emplace_back(row.row_id);
           }
         }
-
-        if (!pos_list_local.empty()) {
-          pos_lists[current_partition_id] = std::move(pos_list_local);
+      } else if (_mode == JoinMode::Anti) {
+        // no hashtable on other side, but we are in Anti mode
+        for (size_t partition_offset = partition_begin; partition_offset < partition_end; ++partition_offset) {
+          auto& row = partition[partition_offset];
+          pos_list_local.emplace_back(row.row_id);
         }
-      }));
-      jobs.back()->schedule();
-    }
+      }
 
-    CurrentScheduler::wait_for_tasks(jobs);
+      if (!pos_list_local.empty()) {
+        pos_lists[current_partition_id] = std::move(pos_list_local);
+      }
+    });
   }
 
   std::shared_ptr<const Table> _on_execute() override {
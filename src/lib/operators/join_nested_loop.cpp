@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "storage/column_iterables/any_column_iterable.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "type_comparison.hpp"
@@ -140,6 +141,8 @@ void JoinNestedLoop::_perform_join() {
 
     // Scan all chunks for right input
     for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
+      CancellationToken::check_this_thread();
+
       auto column_right = right_table->get_chunk(chunk_id_right)->get_column(right_column_id);
 
       resolve_data_and_column_type(*column_left, [&](auto left_type, auto& typed_left_column) {
@@ -1,5 +1,7 @@
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -43,11 +45,13 @@ class ColumnMaterializer {
    * Materializes and sorts all the chunks of an input table in parallel
    * by creating multiple jobs that materialize chunks.
    * Returns the materialized columns and a list of null row ids if materialize_null is enabled.
+   * Chunks that are known to be sorted by the column (see Chunk::ordered_by()) are not sorted again.
    **/
   std::pair<std::unique_ptr<MaterializedColumnList<T>>, std::unique_ptr<PosList>> materialize(
       std::shared_ptr<const Table> input, ColumnID column_id) {
     auto output = std::make_unique<MaterializedColumnList<T>>(input->chunk_count());
     auto null_rows = std::make_unique<PosList>();
+    _all_chunks_presorted = true;
 
     std::vector<std::shared_ptr<AbstractTask>> jobs;
     for (ChunkID chunk_id{0}; chunk_id < input->chunk_count(); ++chunk_id) {
@@ -60,6 +64,12 @@ class ColumnMaterializer {
     return std::make_pair(std::move(output), std::move(null_rows));
   }
 
+  /**
+   * Returns true if each of the materialized chunks of the last call to materialize() is sorted in ascending order,
+   * even if sorting was not requested
+   **/
+  bool all_chunks_presorted() const { return _all_chunks_presorted; }
+
  private:
   /**
    * Creates a job to materialize and sort a chunk.
@@ -69,9 +79,24 @@ class ColumnMaterializer {
                                                              ChunkID chunk_id, std::shared_ptr<const Table> input,
                                                              ColumnID column_id) {
     return std::make_shared<JobTask>([this, &output, &null_rows_output, input, column_id, chunk_id] {
-      auto column = input->get_chunk(chunk_id)->get_column(column_id);
+      const auto chunk = input->get_chunk(chunk_id);
+      auto column = chunk->get_column(column_id);
+
+      const auto& ordered_by = chunk->ordered_by();
+      const auto presorted_order =
+          ordered_by && ordered_by->first == column_id ? std::optional<OrderByMode>{ordered_by->second} : std::nullopt;
+      if (!presorted_order) _all_chunks_presorted = false;
+
       resolve_column_type<T>(*column, [&](auto& typed_column) {
-        (*output)[chunk_id] = _materialize_column(typed_column, chunk_id, null_rows_output);
+        auto materialized_column = _materialize_column(typed_column, chunk_id, null_rows_output, presorted_order);
+
+        // NULLs are not materialized, so reversing a descending column is enough to sort it in ascending order
+        if (presorted_order &&
+            (*presorted_order == OrderByMode::Descending || *presorted_order == OrderByMode::DescendingNullsLast)) {
+          std::reverse(materialized_column->begin(), materialized_column->end());
+        }
+
+        (*output)[chunk_id] = materialized_column;
       });
     });
   }
@@ -81,7 +106,8 @@ class ColumnMaterializer {
    */
   template <typename ColumnType>
   std::shared_ptr<MaterializedColumn<T>> _materialize_column(const ColumnType& column, ChunkID chunk_id,
-                                                             std::unique_ptr<PosList>& null_rows_output) {
+                                                             std::unique_ptr<PosList>& null_rows_output,
+                                                             const std::optional<OrderByMode>& presorted_order) {
     auto output = MaterializedColumn<T>{};
     output.reserve(column.size());
 
@@ -98,7 +124,7 @@ class ColumnMaterializer {
       }
     });
 
-    if (_sort) {
+    if (_sort && !presorted_order) {
       std::sort(output.begin(), output.end(),
                 [](const auto& left, const auto& right) { return left.value < right.value; });
     }
@@ -110,14 +136,15 @@ class ColumnMaterializer {
    * Specialization for dictionary columns
    */
   std::shared_ptr<MaterializedColumn<T>> _materialize_column(const DictionaryColumn<T>& column, ChunkID chunk_id,
-                                                             std::unique_ptr<PosList>& null_rows_output) {
+                                                             std::unique_ptr<PosList>& null_rows_output,
+                                                             const std::optional<OrderByMode>& presorted_order) {
     auto output = MaterializedColumn<T>{};
     output.reserve(column.size());
 
     auto base_attribute_vector = column.attribute_vector();
     auto dict = column.dictionary();
 
-    if (_sort) {
+    if (_sort && !presorted_order) {
       // Works like Bucket Sort
       // Collect for every value id, the set of rows that this value appeared in
       // value_count is used as an inverted index
@@ -173,6 +200,7 @@ class ColumnMaterializer {
  private:
   bool _sort;
   bool _materialize_null;
+  std::atomic_bool _all_chunks_presorted{true};
 };
 
 }  // namespace opossum
@@ -317,11 +317,14 @@ class RadixClusterSort {
   }
 
   /**
-  * Sorts all clusters of a materialized table.
+  * Sorts all clusters of a materialized table. If the clusters are concatenations of presorted chunks, they might
+  * already be sorted, which is cheaper to check than to sort them again.
   **/
-  void _sort_clusters(std::unique_ptr<MaterializedColumnList<T>>& clusters) {
+  void _sort_clusters(std::unique_ptr<MaterializedColumnList<T>>& clusters, const bool presorted = false) {
+    const auto compare = [](auto& left, auto& right) { return left.value < right.value; };
     for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+      if (presorted && std::is_sorted(cluster->begin(), cluster->end(), compare)) continue;
+      std::sort(cluster->begin(), cluster->end(), compare);
     }
   }
 
@@ -356,8 +359,10 @@ class RadixClusterSort {
 
     // Sort each cluster (right now std::sort -> but maybe can be replaced with
     // an more efficient algorithm, if subparts are already sorted [InsertionSort?!])
-    _sort_clusters(output.clusters_left);
-    _sort_clusters(output.clusters_right);
+    // If all chunks of an input are sorted (e.g., because it is the output of a Sort operator) and there is only a
+    // single cluster, sorting can be skipped if the chunks are in the right order, too.
+    _sort_clusters(output.clusters_left, _cluster_count == 1 && left_column_materializer.all_chunks_presorted());
+    _sort_clusters(output.clusters_right, _cluster_count == 1 && right_column_materializer.all_chunks_presorted());
 
     return output;
   }
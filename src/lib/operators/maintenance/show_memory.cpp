@@ -0,0 +1,77 @@
+#include "show_memory.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/chunk.hpp"
+#include "storage/memory_usage.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+ShowMemory::ShowMemory() : AbstractReadOnlyOperator(OperatorType::ShowMemory) {}
+
+const std::string ShowMemory::name() const { return "ShowMemory"; }
+
+std::shared_ptr<AbstractOperator> ShowMemory::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<ShowMemory>();
+}
+
+std::shared_ptr<const Table> ShowMemory::_on_execute() {
+  const auto size_column_names =
+      std::vector<std::string>{"row_count",   "chunk_count", "data",    "dictionaries", "attribute_vectors",
+                               "null_values", "pos_lists",   "mvcc",    "indices",      "statistics",
+                               "metadata",    "total"};
+
+  auto column_definitions = TableColumnDefinitions{{"table_name", DataType::String}};
+  for (const auto& column_name : size_column_names) {
+    column_definitions.emplace_back(column_name, DataType::Long);
+  }
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+
+  const auto& storage_manager = StorageManager::get();
+  const auto memory_usage = storage_manager.memory_usage();
+
+  auto table_names = pmr_concurrent_vector<std::string>{};
+  auto sizes = std::vector<pmr_concurrent_vector<int64_t>>(size_column_names.size());
+
+  for (const auto& [table_name, usage] : memory_usage) {
+    const auto stored_table = storage_manager.get_table(table_name);
+
+    table_names.push_back(table_name);
+    const auto row_values = {stored_table->row_count(),
+                             static_cast<uint64_t>(stored_table->chunk_count()),
+                             usage.data,
+                             usage.dictionaries,
+                             usage.attribute_vectors,
+                             usage.null_values,
+                             usage.pos_lists,
+                             usage.mvcc,
+                             usage.indices,
+                             usage.statistics,
+                             usage.metadata,
+                             usage.total()};
+
+    auto column_index = size_t{0};
+    for (const auto value : row_values) {
+      sizes[column_index++].push_back(static_cast<int64_t>(value));
+    }
+  }
+
+  ChunkColumns columns;
+  columns.push_back(std::make_shared<ValueColumn<std::string>>(std::move(table_names)));
+  for (auto& column_values : sizes) {
+    columns.push_back(std::make_shared<ValueColumn<int64_t>>(std::move(column_values)));
+  }
+  table->append_chunk(columns);
+
+  return table;
+}
+
+}  // namespace opossum
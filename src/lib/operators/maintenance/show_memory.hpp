@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "operators/abstract_read_only_operator.hpp"
+
+namespace opossum {
+
+// maintenance operator to get the memory held by each table stored by the StorageManager, broken down by component
+// (see MemoryUsage). Sizes are given in bytes.
+class ShowMemory : public AbstractReadOnlyOperator {
+ public:
+  ShowMemory();
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+};
+}  // namespace opossum
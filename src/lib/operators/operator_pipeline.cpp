@@ -0,0 +1,99 @@
+#include "operator_pipeline.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "scheduler/parallel_for.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+OperatorPipeline::OperatorPipeline(std::vector<std::shared_ptr<AbstractOperator>> operators)
+    : _operators(std::move(operators)) {
+  DebugAssert(!_operators.empty(), "Pipeline must not be empty");
+  DebugAssert(_operators.front()->input_left(), "Pipeline needs a source");
+
+  for (auto operator_idx = size_t{0}; operator_idx < _operators.size(); ++operator_idx) {
+    DebugAssert(_operators[operator_idx]->is_chunkwise(), "Only chunk-wise operators can be pipelined");
+    DebugAssert(operator_idx == 0 || _operators[operator_idx]->input_left() == _operators[operator_idx - 1],
+                "Pipelined operators must form a chain");
+  }
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& OperatorPipeline::operators() const { return _operators; }
+
+std::string OperatorPipeline::description() const {
+  auto description = std::string{"Pipeline of"};
+  for (const auto& op : _operators) {
+    description += " " + op->description();
+  }
+  return description;
+}
+
+void OperatorPipeline::execute() {
+  const auto& last_operator = _operators.back();
+  DebugAssert(!last_operator->_output, "Pipeline has already been executed");
+
+  const auto start = std::chrono::high_resolution_clock::now();
+
+  const auto source_table = _operators.front()->input_table_left();
+
+  // Without any chunks, there is nothing to pipeline. Still, the output needs the columns of the last operator.
+  if (source_table->chunk_count() == 0) {
+    for (const auto& op : _operators) {
+      op->execute();
+    }
+    return;
+  }
+
+  auto chunk_outputs = std::vector<std::shared_ptr<const Table>>(source_table->chunk_count());
+  parallel_for(ChunkID{0}, source_table->chunk_count(),
+               [&](const ChunkID chunk_id) { chunk_outputs[chunk_id] = _execute_for_chunk(chunk_id); });
+
+  // The transaction was aborted, so no operator produces an output
+  for (const auto& chunk_output : chunk_outputs) {
+    if (!chunk_output) return;
+  }
+
+  const auto& first_output = *chunk_outputs.front();
+  auto output = std::make_shared<Table>(first_output.column_definitions(), first_output.type(),
+                                        first_output.max_chunk_size());
+
+  for (const auto& chunk_output : chunk_outputs) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_output->chunk_count(); ++chunk_id) {
+      const auto chunk = chunk_output->get_chunk(chunk_id);
+      output->append_chunk(chunk->columns(), chunk->get_allocator(), chunk->access_counter());
+      output->get_chunk(static_cast<ChunkID>(output->chunk_count() - 1))->set_ordered_by(chunk->ordered_by());
+    }
+  }
+
+  last_operator->_output = output;
+
+  const auto end = std::chrono::high_resolution_clock::now();
+  last_operator->_performance_data.walltime_ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+}
+
+std::shared_ptr<const Table> OperatorPipeline::_execute_for_chunk(const ChunkID chunk_id) const {
+  auto input = _operators.front()->mutable_input_left();
+
+  for (const auto& op : _operators) {
+    const auto chunk_op = op->recreate_with_inputs(input);
+    if (op->transaction_context_is_set()) chunk_op->set_transaction_context(op->transaction_context());
+    if (op == _operators.front()) chunk_op->restrict_input_chunks(chunk_id, ChunkID{chunk_id + 1});
+
+    chunk_op->execute();
+    if (!chunk_op->get_output()) return nullptr;
+
+    input = chunk_op;
+  }
+
+  return input->get_output();
+}
+
+}  // namespace opossum
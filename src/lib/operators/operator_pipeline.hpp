@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * A chain of chunk-wise operators (see AbstractOperator::is_chunkwise()) in which each operator is the only consumer
+ * of its predecessor, e.g., Validate -> TableScan -> Projection. The input of the first operator (the source) and the
+ * consumer of the last one are pipeline breakers, i.e., operators that need their whole input.
+ *
+ * Instead of executing the operators one after another, each materializing its whole output, a pipeline pushes the
+ * chunks of the source through all operators: For every chunk of the source, the operators are recreated (see
+ * AbstractOperator::recreate_with_inputs()), the first one is restricted to this chunk, and the chain is executed.
+ * Thus, only the intermediate results of the chunks currently being processed exist, and the chunks are processed in
+ * parallel (see parallel_for()) without waiting for an operator to finish all of them.
+ *
+ * The output of the last operator is composed of the outputs of all chunks, in the order of the source chunks. The
+ * other operators of the pipeline are not executed themselves, i.e., they have no output.
+ */
+class OperatorPipeline final {
+ public:
+  // Operators from the first one (which reads the source) to the last one
+  explicit OperatorPipeline(std::vector<std::shared_ptr<AbstractOperator>> operators);
+
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+  std::string description() const;
+
+  // Must only be called once the source has been executed
+  void execute();
+
+ protected:
+  // Executes the operators for a single chunk of the source, returns nullptr if the transaction was aborted
+  std::shared_ptr<const Table> _execute_for_chunk(const ChunkID chunk_id) const;
+
+  const std::vector<std::shared_ptr<AbstractOperator>> _operators;
+};
+
+}  // namespace opossum
@@ -0,0 +1,79 @@
+#include "primary_key_lookup.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_parameter_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+PrimaryKeyLookup::PrimaryKeyLookup(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+                                   const AllTypeVariant& value)
+    : AbstractReadOnlyOperator(OperatorType::PrimaryKeyLookup, in), _column_id(column_id), _value(value) {}
+
+const std::string PrimaryKeyLookup::name() const { return "PrimaryKeyLookup"; }
+
+const std::string PrimaryKeyLookup::description(DescriptionMode description_mode) const {
+  std::string column_name = std::string("Col #") + std::to_string(_column_id);
+
+  if (input_table_left()) column_name = input_table_left()->column_name(_column_id);
+
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "(" + column_name + " = " + to_string(AllParameterVariant{_value}) + ")";
+}
+
+bool PrimaryKeyLookup::is_applicable(const Table& table, const ColumnID column_id,
+                                     const PredicateCondition predicate_condition, const AllParameterVariant& value) {
+  const auto primary_key_index = table.primary_key_index();
+  if (!primary_key_index || primary_key_index->column_id() != column_id) return false;
+
+  if (predicate_condition != PredicateCondition::Equals || !is_variant(value)) return false;
+
+  const auto& value_variant = boost::get<AllTypeVariant>(value);
+  if (variant_is_null(value_variant)) return false;
+
+  return data_type_from_all_type_variant(value_variant) == table.column_data_type(column_id);
+}
+
+ColumnID PrimaryKeyLookup::column_id() const { return _column_id; }
+
+const AllTypeVariant& PrimaryKeyLookup::value() const { return _value; }
+
+std::shared_ptr<const Table> PrimaryKeyLookup::_on_execute() {
+  const auto input_table = input_table_left();
+  Assert(input_table->type() == TableType::Data, "PrimaryKeyLookup only supports data tables");
+
+  const auto primary_key_index = input_table->primary_key_index();
+  Assert(primary_key_index && primary_key_index->column_id() == _column_id,
+         "Table has no primary key index on the given column");
+
+  auto pos_list = std::make_shared<PosList>(primary_key_index->lookup(_value));
+
+  // Keep the table's order, e.g., for rows that were inserted with the same key
+  std::sort(pos_list->begin(), pos_list->end());
+
+  auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+
+  ChunkColumns output_columns;
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    output_columns.push_back(std::make_shared<ReferenceColumn>(input_table, column_id, pos_list));
+  }
+  output_table->append_chunk(output_columns);
+
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> PrimaryKeyLookup::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<PrimaryKeyLookup>(recreated_input_left, _column_id, _value);
+}
+
+}  // namespace opossum
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "all_parameter_variant.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that finds all rows whose value in column_id equals value using the table's primary key index (see
+ * Table::create_primary_key_index()). Other than the IndexScan, which probes the index of each chunk, this is a single
+ * hash lookup that also covers the mutable chunks.
+ *
+ * The input must be a data table with a primary key index on column_id. Since the index contains all versions of a
+ * row, the output has to be validated if MVCC is used.
+ */
+class PrimaryKeyLookup : public AbstractReadOnlyOperator {
+ public:
+  PrimaryKeyLookup(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
+                   const AllTypeVariant& value);
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+  /**
+   * Returns whether the predicate `column_id <predicate_condition> value` on table can be executed as a
+   * PrimaryKeyLookup, i.e., the table has a primary key index on column_id, the predicate is an equality with a value
+   * that is not NULL and has the column's type. The index casts the value to the column's type, which would change
+   * the semantics of, e.g., `int_column = 1.5`.
+   */
+  static bool is_applicable(const Table& table, const ColumnID column_id, const PredicateCondition predicate_condition,
+                            const AllParameterVariant& value);
+
+  ColumnID column_id() const;
+  const AllTypeVariant& value() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+
+ private:
+  const ColumnID _column_id;
+  const AllTypeVariant _value;
+};
+
+}  // namespace opossum
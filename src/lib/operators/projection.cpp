@@ -5,6 +5,7 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -15,8 +16,10 @@
 #include "scheduler/current_scheduler.hpp"
 #include "sql/sql_query_plan.hpp"
 
+#include "storage/base_encoded_column.hpp"
+#include "storage/base_value_column.hpp"
 #include "storage/create_iterable_from_column.hpp"
-#include "storage/materialize.hpp"
+#include "storage/dictionary_column/dictionary_column_builder.hpp"
 #include "storage/reference_column.hpp"
 #include "utils/arithmetic_operator_expression.hpp"
 
@@ -41,6 +44,11 @@ const std::string Projection::description(DescriptionMode description_mode) cons
 
 const Projection::ColumnExpressions& Projection::column_expressions() const { return _column_expressions; }
 
+bool Projection::is_chunkwise() const {
+  return std::none_of(_column_expressions.cbegin(), _column_expressions.cend(),
+                      [](const auto& column_expression) { return column_expression->is_subselect(); });
+}
+
 std::shared_ptr<AbstractOperator> Projection::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
@@ -71,17 +79,36 @@ std::shared_ptr<AbstractOperator> Projection::_on_recreate(
 template <typename T>
 std::shared_ptr<BaseColumn> Projection::_create_column(boost::hana::basic_type<T> type, const ChunkID chunk_id,
                                                        const std::shared_ptr<PQPExpression>& expression,
-                                                       std::shared_ptr<const Table> input_table_left,
-                                                       bool reuse_column_from_input) {
-  // check whether term is a just a simple column and bypass this column
-  if (reuse_column_from_input) {
+                                                       std::shared_ptr<const Table> input_table_left) {
+  const auto chunk = input_table_left->get_chunk(chunk_id);
+
+  if (expression->type() == ExpressionType::Column) {
     // we have to use get_mutable_column here because we cannot add a const column to the chunk
-    return input_table_left->get_chunk(chunk_id)->get_mutable_column(expression->column_id());
+    const auto column = chunk->get_mutable_column(expression->column_id());
+
+    // Encoded columns are immutable and can be shared with the input. ValueColumns can only be shared if no more rows
+    // can be appended to them, i.e., if their chunk is full or not the last chunk of the table (see Insert).
+    if (std::dynamic_pointer_cast<BaseEncodedColumn>(column)) return column;
+
+    const auto is_last_chunk = chunk_id + 1u == input_table_left->chunk_count();
+    if (std::dynamic_pointer_cast<BaseValueColumn>(column) &&
+        (!is_last_chunk || chunk->size() >= input_table_left->max_chunk_size())) {
+      return column;
+    }
+
+    // Values referenced by a ReferenceColumn are re-encoded using the dictionaries they stem from, if possible.
+    if (std::dynamic_pointer_cast<ReferenceColumn>(column)) {
+      auto builder = DictionaryColumnBuilder<T>{column->size()};
+      auto chunk_offset = ChunkOffset{0};
+      while (chunk_offset < column->size() && builder.append(column, chunk_offset)) ++chunk_offset;
+      if (chunk_offset == column->size()) return builder.build();
+    }
   }
 
+  const auto row_count = chunk->size();
+
   if (expression->is_null_literal()) {
     // fill a nullable column with NULLs
-    auto row_count = input_table_left->get_chunk(chunk_id)->size();
     auto null_values = pmr_concurrent_vector<bool>(row_count, true);
     // explicitly pass T{} because in some cases it won't initialize otherwise
     auto values = pmr_concurrent_vector<T>(row_count, T{});
@@ -97,8 +124,6 @@ std::shared_ptr<BaseColumn> Projection::_create_column(boost::hana::basic_type<T
     const auto subselect_table = expression->subselect_table();
     const auto subselect_value = subselect_table->get_value<T>(ColumnID(0), 0u);
 
-    auto row_count = input_table_left->get_chunk(chunk_id)->size();
-
     // materialize the result of the subquery for every row in the input table
     auto null_values = pmr_concurrent_vector<bool>(row_count, false);
     auto values = pmr_concurrent_vector<T>(row_count, subselect_value);
@@ -106,19 +131,16 @@ std::shared_ptr<BaseColumn> Projection::_create_column(boost::hana::basic_type<T
     return std::make_shared<ValueColumn<T>>(std::move(values), std::move(null_values));
   } else {
     // fill a value column with the specified expression
-    auto values = _evaluate_expression<T>(expression, input_table_left, chunk_id);
+    auto evaluated_expression = _evaluate_expression<T>(expression, input_table_left, chunk_id);
+    auto& values = evaluated_expression.values;
+    auto& nulls = evaluated_expression.nulls;
 
-    pmr_concurrent_vector<T> non_null_values;
-    non_null_values.reserve(values.size());
-    pmr_concurrent_vector<bool> null_values;
-    null_values.reserve(values.size());
+    auto column_values = pmr_concurrent_vector<T>(row_count);
+    std::move(values.begin(), values.end(), column_values.begin());
+    auto column_null_values = pmr_concurrent_vector<bool>(row_count, false);
+    std::copy(nulls.cbegin(), nulls.cend(), column_null_values.begin());
 
-    for (const auto value : values) {
-      non_null_values.push_back(value.second);
-      null_values.push_back(value.first);
-    }
-
-    return std::make_shared<ValueColumn<T>>(std::move(non_null_values), std::move(null_values));
+    return std::make_shared<ValueColumn<T>>(std::move(column_values), std::move(column_null_values));
   }
 }
 
@@ -129,23 +151,32 @@ std::shared_ptr<const Table> Projection::_on_execute() {
    * Determine the TableColumnDefinitions and create empty output table from them
    */
   TableColumnDefinitions column_definitions;
+
+  // Usually, the subselects were executed by tasks of their own before the Projection (see
+  // OperatorTask::make_tasks_from_operator()). Otherwise, e.g., if the Projection is executed directly, execute all of
+  // them now, concurrently.
+  SQLQueryPlan subselect_plan;
   for (const auto& column_expression : _column_expressions) {
-    TableColumnDefinition column_definition;
+    if (column_expression->is_subselect() && !column_expression->has_subselect_table() &&
+        !column_expression->subselect_operator()->get_output()) {
+      subselect_plan.add_tree_by_root(column_expression->subselect_operator());
+    }
+  }
 
-    // For subselects, we need to execute the subquery in order to use the result table later
-    if (column_expression->is_subselect() && !column_expression->has_subselect_table()) {
-      SQLQueryPlan query_plan;
-      query_plan.add_tree_by_root(column_expression->subselect_operator());
+  if (!subselect_plan.tree_roots().empty()) {
+    auto transaction_context = this->transaction_context();
+    if (transaction_context) {
+      subselect_plan.set_transaction_context(transaction_context);
+    }
 
-      auto transaction_context = this->transaction_context();
-      if (transaction_context) {
-        query_plan.set_transaction_context(transaction_context);
-      }
+    CurrentScheduler::schedule_and_wait_for_tasks(subselect_plan.create_tasks());
+  }
 
-      const auto tasks = query_plan.create_tasks();
-      CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  for (const auto& column_expression : _column_expressions) {
+    TableColumnDefinition column_definition;
 
-      auto result_table = tasks.back()->get_operator()->get_output();
+    if (column_expression->is_subselect() && !column_expression->has_subselect_table()) {
+      auto result_table = column_expression->subselect_operator()->get_output();
       DebugAssert(result_table->column_count() == 1, "Subselect table must have exactly one column.");
 
       Assert(result_table->row_count() == 1,
@@ -189,18 +220,43 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   /**
    * Perform the projection
    */
-  for (ChunkID chunk_id{0}; chunk_id < input_table_left()->chunk_count(); ++chunk_id) {
-    ChunkColumns output_columns;
+  const auto input_chunk_range = _input_chunk_range();
+  for (auto chunk_id = input_chunk_range.first; chunk_id < input_chunk_range.second; ++chunk_id) {
+    const auto input_chunk = input_table_left()->get_chunk(chunk_id);
 
-    for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
-      resolve_data_type(output_table->column_data_type(ColumnID{expression_index}), [&](auto type) {
-        const auto column = _create_column(type, chunk_id, _column_expressions[expression_index], input_table_left(),
-                                           reuse_columns_from_input);
-        output_columns.push_back(column);
-      });
+    ChunkColumns output_columns;
+    output_columns.reserve(_column_expressions.size());
+
+    if (reuse_columns_from_input) {
+      // Projecting existing columns is a pure metadata operation: the output shares the columns (and thereby the pos
+      // lists of ReferenceColumns) with the input.
+      for (const auto& column_expression : _column_expressions) {
+        // we have to use get_mutable_column here because we cannot add a const column to the chunk
+        output_columns.push_back(input_chunk->get_mutable_column(column_expression->column_id()));
+      }
+    } else {
+      for (uint16_t expression_index = 0u; expression_index < _column_expressions.size(); ++expression_index) {
+        resolve_data_type(output_table->column_data_type(ColumnID{expression_index}), [&](auto type) {
+          output_columns.push_back(
+              _create_column(type, chunk_id, _column_expressions[expression_index], input_table_left()));
+        });
+      }
     }
 
     output_table->append_chunk(output_columns);
+
+    // The output chunk is sorted if the column the input chunk is sorted by is projected
+    if (const auto& ordered_by = input_chunk->ordered_by()) {
+      for (auto expression_index = ColumnID{0}; expression_index < _column_expressions.size(); ++expression_index) {
+        const auto& column_expression = _column_expressions[expression_index];
+        if (column_expression->type() == ExpressionType::Column &&
+            column_expression->column_id() == ordered_by->first) {
+          const auto output_chunk_id = static_cast<ChunkID>(output_table->chunk_count() - 1);
+          output_table->get_chunk(output_chunk_id)->set_ordered_by(std::make_pair(expression_index, ordered_by->second));
+          break;
+        }
+      }
+    }
   }
 
   return output_table;
@@ -241,31 +297,41 @@ DataType Projection::_get_type_of_expression(const std::shared_ptr<PQPExpression
 }
 
 template <typename T>
-const pmr_concurrent_vector<std::pair<bool, T>> Projection::_evaluate_expression(
-    const std::shared_ptr<PQPExpression>& expression, const std::shared_ptr<const Table> table,
-    const ChunkID chunk_id) {
+Projection::EvaluatedExpression<T> Projection::_evaluate_expression(const std::shared_ptr<PQPExpression>& expression,
+                                                                    const std::shared_ptr<const Table> table,
+                                                                    const ChunkID chunk_id) {
+  const auto row_count = table->get_chunk(chunk_id)->size();
+
+  auto result = EvaluatedExpression<T>{};
+
   /**
    * Handle Literal
    * This is only used if the Literal represents a constant column, e.g. in 'SELECT 5 FROM table_a'.
    * On the other hand this is not used for nested arithmetic Expressions, such as 'SELECT a + 5 FROM table_a'.
    */
   if (expression->type() == ExpressionType::Literal) {
-    return pmr_concurrent_vector<std::pair<bool, T>>(table->get_chunk(chunk_id)->size(),
-                                                     std::make_pair(false, boost::get<T>(expression->value())));
+    result.values.resize(row_count, boost::get<T>(expression->value()));
+    return result;
   }
 
   /**
    * Handle column reference
    */
   if (expression->type() == ExpressionType::Column) {
-    const auto chunk = table->get_chunk(chunk_id);
-
-    pmr_concurrent_vector<std::pair<bool, T>> values_and_nulls;
-    values_and_nulls.reserve(chunk->size());
-
-    materialize_values_and_nulls(*chunk->get_column(expression->column_id()), values_and_nulls);
+    result.values.reserve(row_count);
+    result.nulls.reserve(row_count);
+
+    auto has_nulls = false;
+    resolve_column_type<T>(*table->get_chunk(chunk_id)->get_column(expression->column_id()), [&](const auto& column) {
+      create_iterable_from_column<T>(column).for_each([&](const auto& value) {
+        result.values.push_back(value.value());
+        result.nulls.push_back(value.is_null());
+        has_nulls |= value.is_null();
+      });
+    });
 
-    return values_and_nulls;
+    if (!has_nulls) result.nulls.clear();
+    return result;
   }
 
   /**
@@ -273,11 +339,6 @@ const pmr_concurrent_vector<std::pair<bool, T>> Projection::_evaluate_expression
    */
   Assert(expression->is_arithmetic_operator(), "Projection only supports literals, column refs and arithmetics");
 
-  const auto& arithmetic_operator_function = function_for_arithmetic_expression<T>(expression->type());
-
-  pmr_concurrent_vector<std::pair<bool, T>> values;
-  values.resize(table->get_chunk(chunk_id)->size());
-
   const auto& left = expression->left_child();
   const auto& right = expression->right_child();
   const auto left_is_literal = left->type() == ExpressionType::Literal;
@@ -285,39 +346,82 @@ const pmr_concurrent_vector<std::pair<bool, T>> Projection::_evaluate_expression
 
   if ((left_is_literal && variant_is_null(left->value())) || (right_is_literal && variant_is_null(right->value()))) {
     // one of the operands is a literal null - early out.
-    std::fill(values.begin(), values.end(), std::make_pair(true, T{}));
-  } else if (left_is_literal && right_is_literal) {
-    std::fill(values.begin(), values.end(),
-              std::make_pair(
-                  false, arithmetic_operator_function(boost::get<T>(left->value()), boost::get<T>(right->value()))));
-  } else if (right_is_literal) {
-    auto left_values = _evaluate_expression<T>(left, table, chunk_id);
-    auto right_value = boost::get<T>(right->value());
-    // apply operator function to both vectors
-    auto func = [&](const std::pair<bool, T>& left_value) -> std::pair<bool, T> {
-      return std::make_pair(left_value.first, arithmetic_operator_function(left_value.second, right_value));
-    };
-    std::transform(left_values.begin(), left_values.end(), values.begin(), func);
-  } else if (left_is_literal) {
-    auto right_values = _evaluate_expression<T>(right, table, chunk_id);
-    auto left_value = boost::get<T>(left->value());
-    // apply operator function to both vectors
-    auto func = [&](const std::pair<bool, T>& right_value) -> std::pair<bool, T> {
-      return std::make_pair(right_value.first, arithmetic_operator_function(left_value, right_value.second));
-    };
-    std::transform(right_values.begin(), right_values.end(), values.begin(), func);
+    result.values.resize(row_count);
+    result.nulls.resize(row_count, true);
+    return result;
+  }
+
+  // Literals are not materialized, but used as scalar operands
+  auto left_operand = left_is_literal ? EvaluatedExpression<T>{} : _evaluate_expression<T>(left, table, chunk_id);
+  auto right_operand = right_is_literal ? EvaluatedExpression<T>{} : _evaluate_expression<T>(right, table, chunk_id);
+  const auto left_value = left_is_literal ? boost::get<T>(left->value()) : T{};
+  const auto right_value = right_is_literal ? boost::get<T>(right->value()) : T{};
+
+  // A row is NULL if one of its operands is NULL
+  if (left_operand.nulls.empty()) {
+    result.nulls = std::move(right_operand.nulls);
+  } else if (right_operand.nulls.empty()) {
+    result.nulls = std::move(left_operand.nulls);
   } else {
-    auto left_values = _evaluate_expression<T>(left, table, chunk_id);
-    auto right_values = _evaluate_expression<T>(right, table, chunk_id);
-
-    // apply operator function to both vectors
-    auto func = [&](const std::pair<bool, T>& left, const std::pair<bool, T>& right) -> std::pair<bool, T> {
-      return std::make_pair(left.first || right.first, arithmetic_operator_function(left.second, right.second));
-    };
-    std::transform(left_values.begin(), left_values.end(), right_values.begin(), values.begin(), func);
+    result.nulls.resize(row_count);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      result.nulls[row] = left_operand.nulls[row] || right_operand.nulls[row];
+    }
   }
 
-  return values;
+  if constexpr (std::is_integral_v<T>) {
+    if (expression->type() == ExpressionType::Division || expression->type() == ExpressionType::Modulo) {
+      // Integer division by 0 is checked here once instead of in the loop below, which keeps the loop free of
+      // branches. The divisors of NULL rows are undefined and replaced by 1, so that NULL / 0 and 1 / NULL are NULL.
+      auto has_zero_divisor = false;
+      if (right_is_literal) {
+        has_zero_divisor = right_value == 0;
+        const auto& nulls = result.nulls;
+        const auto all_rows_null = !nulls.empty() && std::find(nulls.cbegin(), nulls.cend(), false) == nulls.cend();
+        if (has_zero_divisor && all_rows_null) {
+          result.values.resize(row_count);
+          return result;
+        }
+      } else {
+        auto& right_values = right_operand.values;
+        if (!result.nulls.empty()) {
+          for (auto row = size_t{0}; row < row_count; ++row) {
+            right_values[row] = result.nulls[row] ? T{1} : right_values[row];
+          }
+        }
+        has_zero_divisor = std::find(right_values.cbegin(), right_values.cend(), T{0}) != right_values.cend();
+      }
+
+      if (has_zero_divisor) throw std::runtime_error("Cannot divide integers by 0.");
+    }
+  }
+
+  result.values.resize(row_count);
+
+  // Apply the operator in plain loops over contiguous memory, which the compiler can vectorize
+  resolve_arithmetic_operator<T>(expression->type(), [&](const auto& arithmetic_operator) {
+    auto* const output = result.values.data();
+    const auto* const left_values = left_operand.values.data();
+    const auto* const right_values = right_operand.values.data();
+
+    if (left_is_literal && right_is_literal) {
+      std::fill(output, output + row_count, arithmetic_operator(left_value, right_value));
+    } else if (right_is_literal) {
+      for (auto row = size_t{0}; row < row_count; ++row) {
+        output[row] = arithmetic_operator(left_values[row], right_value);
+      }
+    } else if (left_is_literal) {
+      for (auto row = size_t{0}; row < row_count; ++row) {
+        output[row] = arithmetic_operator(left_value, right_values[row]);
+      }
+    } else {
+      for (auto row = size_t{0}; row < row_count; ++row) {
+        output[row] = arithmetic_operator(left_values[row], right_values[row]);
+      }
+    }
+  });
+
+  return result;
 }
 
 // returns the singleton dummy table used for literal projections
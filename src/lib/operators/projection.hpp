@@ -33,6 +33,9 @@ class Projection : public AbstractReadOnlyOperator {
 
   const ColumnExpressions& column_expressions() const;
 
+  // Projections with subselects are not chunk-wise, as every chunk needs the results of all subselects
+  bool is_chunkwise() const override;
+
   /**
    * The dummy table is used for literal projections that have no input table.
    * This was introduce to allow queries like INSERT INTO tbl VALUES (1, 2, 3);
@@ -54,23 +57,32 @@ class Projection : public AbstractReadOnlyOperator {
  protected:
   ColumnExpressions _column_expressions;
 
+  /**
+   * Result of evaluating an expression on a single chunk. Values and NULL flags are stored in separate, contiguous
+   * vectors so that arithmetic operators can be applied in loops that the compiler is able to vectorize.
+   */
+  template <typename T>
+  struct EvaluatedExpression {
+    pmr_vector<T> values;
+    // Empty if none of the values is NULL
+    pmr_vector<bool> nulls;
+  };
+
   template <typename T>
   static std::shared_ptr<BaseColumn> _create_column(boost::hana::basic_type<T> type, const ChunkID chunk_id,
                                                     const std::shared_ptr<PQPExpression>& expression,
-                                                    std::shared_ptr<const Table> input_table_left,
-                                                    bool reuse_column_from_input);
+                                                    std::shared_ptr<const Table> input_table_left);
 
   static DataType _get_type_of_expression(const std::shared_ptr<PQPExpression>& expression,
                                           const std::shared_ptr<const Table>& table);
 
   /**
    * This function evaluates the given expression on a single chunk.
-   * It returns a vector containing the materialized values resulting from the expression.
+   * It returns the materialized values resulting from the expression.
    */
   template <typename T>
-  static const pmr_concurrent_vector<std::pair<bool, T>> _evaluate_expression(
-      const std::shared_ptr<PQPExpression>& expression, const std::shared_ptr<const Table> table,
-      const ChunkID chunk_id);
+  static EvaluatedExpression<T> _evaluate_expression(const std::shared_ptr<PQPExpression>& expression,
+                                                     const std::shared_ptr<const Table> table, const ChunkID chunk_id);
 
   std::shared_ptr<const Table> _on_execute() override;
 
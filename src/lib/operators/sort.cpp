@@ -1,5 +1,6 @@
 #include "sort.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -7,6 +8,7 @@
 #include <vector>
 
 #include "storage/column_iterables/chunk_offset_mapping.hpp"
+#include "storage/dictionary_column/dictionary_column_builder.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/value_column.hpp"
 
@@ -47,8 +49,12 @@ class Sort::SortImplMaterializeOutput {
   // creates a new table with reference columns
   SortImplMaterializeOutput(std::shared_ptr<const Table> in,
                             std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+                            const ColumnID column_id, const OrderByMode order_by_mode, const size_t output_chunk_size)
+      : _table_in(in),
+        _column_id(column_id),
+        _order_by_mode(order_by_mode),
+        _output_chunk_size(output_chunk_size),
+        _row_id_value_vector(id_value_map) {}
 
   std::shared_ptr<const Table> execute() {
     // First we create a new table as the output
@@ -78,6 +84,8 @@ class Sort::SortImplMaterializeOutput {
       resolve_data_type(column_data_type, [&](auto type) {
         using ColumnDataType = typename decltype(type)::type;
 
+        if (_materialize_dictionary_columns<ColumnDataType>(column_id, output_columns_by_chunk)) return;
+
         // Initialize value columns
         auto columns_out = std::vector<std::shared_ptr<ValueColumn<ColumnDataType>>>(chunk_count_out);
         std::generate(columns_out.begin(), columns_out.end(),
@@ -114,14 +122,48 @@ class Sort::SortImplMaterializeOutput {
       });
     }
 
+    // Every output chunk is sorted, which later operators can exploit (e.g., TableScan can use binary search)
     for (auto& columns : output_columns_by_chunk) {
       output->append_chunk(columns);
+      const auto chunk_id = static_cast<ChunkID>(output->chunk_count() - 1);
+      output->get_chunk(chunk_id)->set_ordered_by(std::make_pair(_column_id, _order_by_mode));
     }
 
     return output;
   }
 
+  // If all values of the column stem from DictionaryColumns, the output is dictionary-encoded as well. This avoids
+  // decoding (and, for strings, copying) every single value. Returns false if the column cannot be materialized this
+  // way, in which case output_columns_by_chunk is left untouched.
+  template <typename ColumnDataType>
+  bool _materialize_dictionary_columns(const ColumnID column_id, std::vector<ChunkColumns>& output_columns_by_chunk) {
+    const auto row_count_out = _row_id_value_vector->size();
+
+    auto columns_out = std::vector<std::shared_ptr<BaseColumn>>{};
+    columns_out.reserve(output_columns_by_chunk.size());
+
+    for (auto chunk_begin = size_t{0}; chunk_begin < row_count_out; chunk_begin += _output_chunk_size) {
+      const auto chunk_end = std::min(chunk_begin + _output_chunk_size, row_count_out);
+
+      auto builder = DictionaryColumnBuilder<ColumnDataType>{chunk_end - chunk_begin};
+      for (auto row_index = chunk_begin; row_index < chunk_end; ++row_index) {
+        const auto[chunk_id, chunk_offset] = (*_row_id_value_vector)[row_index].first;
+        if (!builder.append(_table_in->get_chunk(chunk_id)->get_column(column_id), chunk_offset)) return false;
+      }
+
+      columns_out.push_back(builder.build());
+    }
+
+    for (auto chunk_index = size_t{0}; chunk_index < columns_out.size(); ++chunk_index) {
+      output_columns_by_chunk[chunk_index].push_back(columns_out[chunk_index]);
+    }
+
+    return true;
+  }
+
   const std::shared_ptr<const Table> _table_in;
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
   const size_t _output_chunk_size;
   const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
 };
@@ -167,8 +209,8 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
 
     // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
     // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
+    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(
+        _table_in, _row_id_value_vector, _column_id, _order_by_mode, _output_chunk_size);
     return materialization->execute();
   }
 
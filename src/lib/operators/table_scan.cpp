@@ -11,9 +11,9 @@
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
-#include "scheduler/abstract_task.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "scheduler/job_task.hpp"
+#include "optimizer/chunk_statistics/chunk_statistics.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/parallel_for.hpp"
 #include "storage/base_column.hpp"
 #include "storage/chunk.hpp"
 #include "storage/proxy_chunk.hpp"
@@ -60,6 +60,8 @@ const std::string TableScan::description(DescriptionMode description_mode) const
          " " + predicate_string + ")";
 }
 
+bool TableScan::is_chunkwise() const { return true; }
+
 std::shared_ptr<AbstractOperator> TableScan::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
@@ -84,85 +86,111 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend()};
 
-  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
-  jobs.reserve(_in_table->chunk_count() - excluded_chunk_set.size());
+  // Excluded and pruned chunks (and those outside of the input chunk range) are not scanned at all, which is achieved
+  // by treating them as empty
+  const auto input_chunk_range = _input_chunk_range();
+  auto chunk_sizes = std::vector<size_t>(_in_table->chunk_count());
+  for (auto chunk_id = input_chunk_range.first; chunk_id < input_chunk_range.second; ++chunk_id) {
+    if (excluded_chunk_set.count(chunk_id) || _can_prune_chunk(chunk_id)) continue;
+    chunk_sizes[chunk_id] = _in_table->chunk_size(chunk_id);
+  }
 
-  for (ChunkID chunk_id{0u}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
-    if (excluded_chunk_set.count(chunk_id)) continue;
+  // Large chunks of data tables are split into several morsels, each of which becomes an output chunk. Ranges of
+  // reference columns are not supported by the scans, so chunks of reference tables are scanned as a whole.
+  const auto split_chunks = _in_table->type() == TableType::Data && _impl->supports_chunk_ranges();
 
-    auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
-      const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
-      // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = std::make_shared<PosList>(_impl->scan_chunk(chunk_id));
-      if (matches_out->empty()) return;
+  parallel_for_morsels(chunk_sizes, split_chunks, [&](const size_t chunk_index, const size_t begin, const size_t end) {
+    const auto chunk_id = static_cast<ChunkID>(chunk_index);
 
-      // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
-      // towards the original chunk.
-      ChunkColumns out_columns;
+    const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
+    // The actual scan happens in the sub classes of BaseTableScanImpl
+    const auto whole_chunk = begin == 0 && end == chunk_sizes[chunk_index];
+    const auto matches_out = std::make_shared<PosList>(
+        whole_chunk ? _impl->scan_chunk(chunk_id) : _impl->scan_chunk_range(chunk_id, begin, end));
+    if (matches_out->empty()) return;
 
-      /**
-       * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
-       * directly use the matches to construct the reference columns of the output. If it is a reference column,
-       * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
-       * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
-       * between columns as much as possible. Position lists can be shared between two columns iff
-       * (a) they point to the same table and
-       * (b) the reference columns of the input table point to the same positions in the same order
-       *     (i.e. they share their position list).
-       */
-      if (_in_table->type() == TableType::References) {
-        const auto chunk_in = _in_table->get_chunk(chunk_id);
+    // The ChunkAccessCounter is reused to track accesses of the output chunk. Accesses of derived chunks are counted
+    // towards the original chunk.
+    ChunkColumns out_columns;
 
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+    /**
+     * matches_out contains a list of row IDs into this chunk. If this is not a reference table, we can
+     * directly use the matches to construct the reference columns of the output. If it is a reference column,
+     * we need to resolve the row IDs so that they reference the physical data columns (value, dictionary) instead,
+     * since we don’t allow multi-level referencing. To save time and space, we want to share position lists
+     * between columns as much as possible. Position lists can be shared between two columns iff
+     * (a) they point to the same table and
+     * (b) the reference columns of the input table point to the same positions in the same order
+     *     (i.e. they share their position list).
+     */
+    if (_in_table->type() == TableType::References) {
+      const auto chunk_in = _in_table->get_chunk(chunk_id);
 
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto column_in = chunk_in->get_column(column_id);
+      auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
 
-          auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
-          DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        auto column_in = chunk_in->get_column(column_id);
 
-          const auto pos_list_in = ref_column_in->pos_list();
+        auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
+        DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
 
-          const auto table_out = ref_column_in->referenced_table();
-          const auto column_id_out = ref_column_in->referenced_column_id();
+        const auto pos_list_in = ref_column_in->pos_list();
 
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+        const auto table_out = ref_column_in->referenced_table();
+        const auto column_id_out = ref_column_in->referenced_column_id();
 
-          if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
+        auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
-            }
-          }
+        if (!filtered_pos_list) {
+          filtered_pos_list = std::make_shared<PosList>();
+          filtered_pos_list->reserve(matches_out->size());
 
-          auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
-          out_columns.push_back(ref_column_out);
-        }
-      } else {
-        for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
-          out_columns.push_back(ref_column_out);
+          for (const auto& match : *matches_out) {
+            const auto row_id = (*pos_list_in)[match.chunk_offset];
+            filtered_pos_list->push_back(row_id);
+          }
         }
-      }
 
-      std::lock_guard<std::mutex> lock(output_mutex);
-      _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
-    });
+        auto ref_column_out = std::make_shared<ReferenceColumn>(table_out, column_id_out, filtered_pos_list);
+        out_columns.push_back(ref_column_out);
+      }
+    } else {
+      for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+        auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
+        out_columns.push_back(ref_column_out);
+      }
+    }
 
-    jobs.push_back(job_task);
-    job_task->schedule();
-  }
+    std::lock_guard<std::mutex> lock(output_mutex);
+    _output_table->append_chunk(out_columns, chunk_guard->get_allocator(), chunk_guard->access_counter());
 
-  CurrentScheduler::wait_for_tasks(jobs);
+    // The matches are in the same order as the input rows, so the output chunk inherits their sort order
+    const auto& ordered_by = _in_table->get_chunk(chunk_id)->ordered_by();
+    if (ordered_by) {
+      _output_table->get_chunk(static_cast<ChunkID>(_output_table->chunk_count() - 1))->set_ordered_by(ordered_by);
+    }
+  });
 
   return _output_table;
 }
 
 void TableScan::_on_cleanup() { _impl.reset(); }
 
+bool TableScan::_can_prune_chunk(const ChunkID chunk_id) const {
+  // Chunks of reference tables have no statistics
+  if (_in_table->type() != TableType::Data || !is_variant(_right_parameter)) return false;
+
+  const auto& right_value = boost::get<AllTypeVariant>(_right_parameter);
+  // The filters expect a value of the column's data type
+  if (variant_is_null(right_value) ||
+      data_type_from_all_type_variant(right_value) != _in_table->column_data_type(_left_column_id)) {
+    return false;
+  }
+
+  const auto statistics = _in_table->chunk_statistics(chunk_id);
+  return statistics && statistics->can_prune(_left_column_id, right_value, _predicate_condition);
+}
+
 void TableScan::_init_scan() {
   if (_predicate_condition == PredicateCondition::Like || _predicate_condition == PredicateCondition::NotLike) {
     const auto left_column_type = _in_table->column_data_type(_left_column_id);
@@ -47,6 +47,8 @@ class TableScan : public AbstractReadOnlyOperator {
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
 
+  bool is_chunkwise() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -58,6 +60,13 @@ class TableScan : public AbstractReadOnlyOperator {
 
   void _init_scan();
 
+  /**
+   * Returns true if the zone maps of the chunk show that it does not contain any matches. The ChunkPruningRule only
+   * excludes chunks for values known at optimization time, the scan also skips chunks for values that are set later
+   * (e.g., parameters of prepared statements) and for chunks encoded or inserted into after the plan was optimized.
+   */
+  bool _can_prune_chunk(const ChunkID chunk_id) const;
+
  private:
   const ColumnID _left_column_id;
   const PredicateCondition _predicate_condition;
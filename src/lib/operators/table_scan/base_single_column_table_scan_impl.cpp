@@ -30,6 +30,22 @@ PosList BaseSingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
   return matches_out;
 }
 
+bool BaseSingleColumnTableScanImpl::supports_chunk_ranges() const { return true; }
+
+PosList BaseSingleColumnTableScanImpl::scan_chunk_range(ChunkID chunk_id, ChunkOffset begin, ChunkOffset end) {
+  DebugAssert(_in_table->type() == TableType::Data, "Only chunks of data tables can be scanned in ranges");
+
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  const auto left_column = chunk->get_column(_left_column_id);
+
+  auto matches_out = PosList{};
+  auto context = std::make_shared<Context>(chunk_id, matches_out, std::make_pair(begin, end));
+
+  left_column->visit(*this, context);
+
+  return matches_out;
+}
+
 void BaseSingleColumnTableScanImpl::handle_column(const ReferenceColumn& left_column,
                                                   std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -30,6 +31,10 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public ColumnVis
 
   PosList scan_chunk(ChunkID chunk_id) override;
 
+  bool supports_chunk_ranges() const override;
+
+  PosList scan_chunk_range(ChunkID chunk_id, ChunkOffset begin, ChunkOffset end) override;
+
   void handle_column(const ReferenceColumn& left_column, std::shared_ptr<ColumnVisitableContext> base_context) override;
 
  protected:
@@ -42,10 +47,29 @@ class BaseSingleColumnTableScanImpl : public BaseTableScanImpl, public ColumnVis
     Context(const ChunkID chunk_id, PosList& matches_out, std::unique_ptr<ChunkOffsetsList> mapped_chunk_offsets)
         : _chunk_id{chunk_id}, _matches_out{matches_out}, _mapped_chunk_offsets{std::move(mapped_chunk_offsets)} {}
 
+    Context(const ChunkID chunk_id, PosList& matches_out, const std::pair<ChunkOffset, ChunkOffset>& chunk_offset_range)
+        : _chunk_id{chunk_id}, _matches_out{matches_out}, _chunk_offset_range{chunk_offset_range} {}
+
+    /**
+     * Calls functor with the iterators of iterable over the rows that are scanned, i.e., the mapped chunk offsets,
+     * the chunk offset range, or the entire column
+     */
+    template <typename Iterable, typename Functor>
+    void with_iterators(const Iterable& iterable, const Functor& functor) const {
+      if (_chunk_offset_range) {
+        iterable.with_iterators(_chunk_offset_range->first, _chunk_offset_range->second, functor);
+      } else {
+        iterable.with_iterators(_mapped_chunk_offsets.get(), functor);
+      }
+    }
+
     const ChunkID _chunk_id;
     PosList& _matches_out;
 
     std::unique_ptr<ChunkOffsetsList> _mapped_chunk_offsets;
+
+    // Set when only the rows [first, second) of a chunk are scanned (see scan_chunk_range())
+    std::optional<std::pair<ChunkOffset, ChunkOffset>> _chunk_offset_range;
   };
 };
 
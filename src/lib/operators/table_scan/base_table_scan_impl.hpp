@@ -23,6 +23,16 @@ class BaseTableScanImpl {
 
   virtual PosList scan_chunk(ChunkID chunk_id) = 0;
 
+  /**
+   * Scans only the rows [begin, end) of a chunk of a data table, so that large chunks can be split into several
+   * morsels (see parallel_for_morsels()). Only implemented if supports_chunk_ranges() returns true.
+   */
+  virtual bool supports_chunk_ranges() const { return false; }
+
+  virtual PosList scan_chunk_range(ChunkID, ChunkOffset, ChunkOffset) {
+    Fail("This table scan cannot scan ranges of chunks");
+  }
+
  protected:
   /**
    * @defgroup The hot loops of the table scan
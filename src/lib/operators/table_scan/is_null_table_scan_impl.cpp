@@ -38,7 +38,6 @@ void IsNullTableScanImpl::handle_column(const ReferenceColumn& left_column,
 void IsNullTableScanImpl::handle_column(const BaseValueColumn& base_column,
                                         std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
 
   if (_matches_all(base_column)) {
     _add_all(*context, base_column.size());
@@ -54,25 +53,23 @@ void IsNullTableScanImpl::handle_column(const BaseValueColumn& base_column,
 
   auto left_column_iterable = NullValueVectorIterable{base_column.null_values()};
 
-  left_column_iterable.with_iterators(mapped_chunk_offsets.get(),
-                                      [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
+  context->with_iterators(left_column_iterable,
+                          [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
 }
 
 void IsNullTableScanImpl::handle_column(const BaseDictionaryColumn& left_column,
                                         std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
 
   auto left_column_iterable = create_iterable_from_attribute_vector(left_column);
 
-  left_column_iterable.with_iterators(mapped_chunk_offsets.get(),
-                                      [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
+  context->with_iterators(left_column_iterable,
+                          [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
 }
 
 void IsNullTableScanImpl::handle_column(const BaseEncodedColumn& base_column,
                                         std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
 
   const auto left_column_type = _in_table->column_data_type(_left_column_id);
 
@@ -82,8 +79,8 @@ void IsNullTableScanImpl::handle_column(const BaseEncodedColumn& base_column,
     resolve_encoded_column_type<Type>(base_column, [&](const auto& typed_column) {
       auto left_column_iterable = create_iterable_from_column(typed_column);
 
-      left_column_iterable.with_iterators(
-          mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
+      context->with_iterators(left_column_iterable,
+                              [&](auto left_it, auto left_end) { this->_scan(left_it, left_end, *context); });
     });
   });
 }
@@ -118,11 +115,16 @@ void IsNullTableScanImpl::_add_all(Context& context, size_t column_size) {
   auto& matches_out = context._matches_out;
   const auto chunk_id = context._chunk_id;
   const auto& mapped_chunk_offsets = context._mapped_chunk_offsets;
+  const auto& chunk_offset_range = context._chunk_offset_range;
 
   if (mapped_chunk_offsets) {
     for (const auto& chunk_offsets : *mapped_chunk_offsets) {
       matches_out.push_back(RowID{chunk_id, chunk_offsets.into_referencing});
     }
+  } else if (chunk_offset_range) {
+    for (auto chunk_offset = chunk_offset_range->first; chunk_offset < chunk_offset_range->second; ++chunk_offset) {
+      matches_out.push_back(RowID{chunk_id, chunk_offset});
+    }
   } else {
     for (auto chunk_offset = 0u; chunk_offset < column_size; ++chunk_offset) {
       matches_out.push_back(RowID{chunk_id, chunk_offset});
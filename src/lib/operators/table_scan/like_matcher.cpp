@@ -0,0 +1,108 @@
+#include "like_matcher.hpp"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+namespace {
+
+char to_lower(const char character) { return static_cast<char>(std::tolower(static_cast<unsigned char>(character))); }
+
+char to_upper(const char character) { return static_cast<char>(std::toupper(static_cast<unsigned char>(character))); }
+
+}  // namespace
+
+LikeMatcher::LikeMatcher(const std::string& pattern) {
+  auto segment = std::string{};
+  for (const auto character : pattern) {
+    if (character == '%') {
+      _segments.emplace_back(std::move(segment));
+      segment.clear();
+    } else {
+      segment.push_back(to_lower(character));
+    }
+  }
+  _segments.emplace_back(std::move(segment));
+}
+
+bool LikeMatcher::matches(const std::string& value) const {
+  const auto& first_segment = _segments.front();
+
+  // Without '%', the pattern has to match the whole value
+  if (_segments.size() == 1u) return value.size() == first_segment.size() && _matches_at(value, 0u, first_segment);
+
+  const auto& last_segment = _segments.back();
+  if (value.size() < first_segment.size() + last_segment.size()) return false;
+
+  const auto last_segment_position = value.size() - last_segment.size();
+  if (!_matches_at(value, 0u, first_segment) || !_matches_at(value, last_segment_position, last_segment)) {
+    return false;
+  }
+
+  // The segments in between must not overlap the first and the last one
+  auto position = first_segment.size();
+  for (auto segment_id = size_t{1}; segment_id + 1 < _segments.size(); ++segment_id) {
+    const auto& segment = _segments[segment_id];
+
+    position = _find(value, position, last_segment_position, segment);
+    if (position == std::string::npos) return false;
+
+    position += segment.size();
+  }
+
+  return true;
+}
+
+bool LikeMatcher::_matches_at(const std::string& value, const size_t position, const std::string& segment) {
+  for (auto index = size_t{0}; index < segment.size(); ++index) {
+    if (segment[index] != '_' && segment[index] != to_lower(value[position + index])) return false;
+  }
+  return true;
+}
+
+size_t LikeMatcher::_find(const std::string& value, const size_t from, const size_t limit,
+                          const std::string& segment) {
+  if (from + segment.size() > limit) return std::string::npos;
+
+  // Segments consisting of '_' only match anywhere
+  const auto anchor = segment.find_first_not_of('_');
+  if (anchor == std::string::npos) return from;
+
+  // Look for the anchor character at the positions where it would be located in a match of the segment
+  const auto lower = segment[anchor];
+  const auto upper = to_upper(lower);
+  const auto* data = value.data();
+
+  auto position = from + anchor;
+  const auto end = limit - segment.size() + anchor + 1;
+
+  const auto lower_register = _mm_set1_epi8(lower);
+  const auto upper_register = _mm_set1_epi8(upper);
+  for (; position + sizeof(__m128i) <= end; position += sizeof(__m128i)) {
+    const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position));
+    const auto equal = _mm_or_si128(_mm_cmpeq_epi8(block, lower_register), _mm_cmpeq_epi8(block, upper_register));
+
+    // Each set bit of the mask marks a candidate
+    for (auto mask = static_cast<uint32_t>(_mm_movemask_epi8(equal)); mask != 0u; mask &= mask - 1u) {
+      const auto candidate = position + __builtin_ctz(mask) - anchor;
+      if (_matches_at(value, candidate, segment)) return candidate;
+    }
+  }
+
+  for (; position < end; ++position) {
+    if ((data[position] == lower || data[position] == upper) && _matches_at(value, position - anchor, segment)) {
+      return position - anchor;
+    }
+  }
+
+  return std::string::npos;
+}
+
+}  // namespace opossum
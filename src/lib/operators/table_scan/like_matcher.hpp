@@ -0,0 +1,39 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Evaluates an SQL LIKE pattern on strings without using a regex.
+ *
+ * The pattern is split at '%' into segments, which are matched from left to right: The first segment has to match at
+ * the beginning of the value and the last one at its end (unless the pattern starts or ends with '%'). The segments in
+ * between are searched for, taking the leftmost match of each. As segments have a fixed length, this is sufficient to
+ * find a match if one exists. '_' matches any single character within a segment.
+ *
+ * To search for a segment, the value is scanned 16 bytes at a time for the first character of the segment that is not
+ * a '_' using SSE2, and only the candidate positions found are compared character by character.
+ *
+ * Matching is case insensitive for the characters of the "C" locale.
+ */
+class LikeMatcher {
+ public:
+  explicit LikeMatcher(const std::string& pattern);
+
+  bool matches(const std::string& value) const;
+
+ protected:
+  // Returns true if the segment matches the value at position
+  static bool _matches_at(const std::string& value, size_t position, const std::string& segment);
+
+  // Returns the position of the first match of the segment within [from, limit), or std::string::npos
+  static size_t _find(const std::string& value, size_t from, size_t limit, const std::string& segment);
+
+  // Lower-case segments of the pattern between the '%'. The first and last one are empty if the pattern starts or
+  // ends with '%'.
+  std::vector<std::string> _segments;
+};
+
+}  // namespace opossum
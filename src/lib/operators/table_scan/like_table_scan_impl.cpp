@@ -1,18 +1,15 @@
 #include "like_table_scan_impl.hpp"
 
-#include <boost/algorithm/string/replace.hpp>
-
 #include <algorithm>
-#include <array>
+#include <cctype>
+#include <limits>
 #include <map>
 #include <memory>
-#include <regex>
-#include <sstream>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "storage/column_iterables/constant_value_iterable.hpp"
 #include "storage/column_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/create_iterable_from_column.hpp"
 #include "storage/resolve_encoded_column_type.hpp"
@@ -25,28 +22,24 @@ LikeTableScanImpl::LikeTableScanImpl(std::shared_ptr<const Table> in_table, cons
                                      const PredicateCondition predicate_condition, const std::string& right_wildcard)
     : BaseSingleColumnTableScanImpl{in_table, left_column_id, predicate_condition},
       _right_wildcard{right_wildcard},
-      _invert_results(predicate_condition == PredicateCondition::NotLike) {
-  // convert the given SQL-like search term into a c++11 regex to use it for the actual matching
-  auto regex_string = sqllike_to_regex(_right_wildcard);
-  _regex = std::regex{regex_string, std::regex_constants::icase};  // case insensitivity
-}
+      _invert_results(predicate_condition == PredicateCondition::NotLike),
+      _matcher{right_wildcard},
+      _prefix{extract_prefix(right_wildcard)} {}
 
 void LikeTableScanImpl::handle_column(const BaseValueColumn& base_column,
                                       std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
   const auto chunk_id = context->_chunk_id;
 
   auto& left_column = static_cast<const ValueColumn<std::string>&>(base_column);
 
   auto left_iterable = ValueColumnIterable<std::string>{left_column};
-  auto right_iterable = ConstantValueIterable<std::regex>{_regex};
 
-  const auto regex_match = [this](const std::string& str) { return std::regex_match(str, _regex) ^ _invert_results; };
+  const auto like_match = [this](const std::string& str) { return _matcher.matches(str) ^ _invert_results; };
 
-  left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
-    this->_unary_scan(regex_match, left_it, left_end, chunk_id, matches_out);
+  context->with_iterators(left_iterable, [&](auto left_it, auto left_end) {
+    this->_unary_scan(like_match, left_it, left_end, chunk_id, matches_out);
   });
 }
 
@@ -54,45 +47,38 @@ void LikeTableScanImpl::handle_column(const BaseEncodedColumn& base_column,
                                       std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
   const auto chunk_id = context->_chunk_id;
 
   resolve_encoded_column_type<std::string>(base_column, [&](const auto& typed_column) {
     auto left_iterable = create_iterable_from_column(typed_column);
-    auto right_iterable = ConstantValueIterable<std::regex>{_regex};
 
-    const auto regex_match = [this](const std::string& str) { return std::regex_match(str, _regex) ^ _invert_results; };
+    const auto like_match = [this](const std::string& str) { return _matcher.matches(str) ^ _invert_results; };
 
-    left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
-      this->_unary_scan(regex_match, left_it, left_end, chunk_id, matches_out);
+    context->with_iterators(left_iterable, [&](auto left_it, auto left_end) {
+      this->_unary_scan(like_match, left_it, left_end, chunk_id, matches_out);
     });
   });
 }
 
-std::string LikeTableScanImpl::sqllike_to_regex(std::string sqllike) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto replace_by = std::array<std::pair<const char*, const char*>, 15u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {".", "\\."},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : replace_by) {
-    boost::replace_all(sqllike, pair.first, pair.second);
+std::optional<std::string> LikeTableScanImpl::extract_prefix(const std::string& sqllike) {
+  const auto wildcard_position = sqllike.find_first_of("%_");
+  if (wildcard_position == std::string::npos || sqllike[wildcard_position] != '%') return std::nullopt;
+
+  // Multiple trailing '%' are equivalent to a single one
+  if (sqllike.find_first_not_of('%', wildcard_position) != std::string::npos) return std::nullopt;
+
+  return sqllike.substr(0, wildcard_position);
+}
+
+std::optional<std::string> LikeTableScanImpl::_next_prefix(std::string prefix) {
+  // Increment the last character that is not the largest one, dropping the ones after it
+  while (!prefix.empty() && static_cast<unsigned char>(prefix.back()) == std::numeric_limits<unsigned char>::max()) {
+    prefix.pop_back();
   }
+  if (prefix.empty()) return std::nullopt;
 
-  return "^" + sqllike + "$";
+  prefix.back() = static_cast<char>(static_cast<unsigned char>(prefix.back()) + 1);
+  return prefix;
 }
 
 void LikeTableScanImpl::handle_column(const BaseDictionaryColumn& base_column,
@@ -100,18 +86,46 @@ void LikeTableScanImpl::handle_column(const BaseDictionaryColumn& base_column,
   const auto& left_column = static_cast<const DictionaryColumn<std::string>&>(base_column);
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
   const auto chunk_id = context->_chunk_id;
 
+  auto attribute_vector_iterable = create_iterable_from_attribute_vector(left_column);
+
+  // A prefix that matches a single range of value IDs is evaluated by comparing the value IDs with the range's bounds
+  if (_prefix) {
+    const auto value_id_ranges = _find_prefix_value_id_ranges(*left_column.dictionary());
+    if (value_id_ranges.size() <= 1u) {
+      const auto range = value_id_ranges.empty() ? std::make_pair(ValueID{0u}, ValueID{0u}) : value_id_ranges.front();
+      const auto range_size = static_cast<size_t>(range.second) - static_cast<size_t>(range.first);
+      const auto dictionary_size = left_column.dictionary()->size();
+
+      // The scan matches none
+      if (range_size == (_invert_results ? dictionary_size : 0u)) return;
+
+      context->with_iterators(attribute_vector_iterable, [&](auto left_it, auto left_end) {
+        // The scan matches all
+        if (range_size == (_invert_results ? 0u : dictionary_size)) {
+          static const auto always_true = [](const auto&) { return true; };
+          this->_unary_scan(always_true, left_it, left_end, chunk_id, matches_out);
+          return;
+        }
+
+        const auto value_id_in_range = [&](const ValueID& value) {
+          return (value >= range.first && value < range.second) ^ _invert_results;
+        };
+        this->_unary_scan(value_id_in_range, left_it, left_end, chunk_id, matches_out);
+      });
+
+      return;
+    }
+  }
+
   const auto result = _find_matches_in_dictionary(*left_column.dictionary());
   const auto& match_count = result.first;
   const auto& dictionary_matches = result.second;
 
-  auto attribute_vector_iterable = create_iterable_from_attribute_vector(left_column);
-
   // Regex matches all
   if (match_count == dictionary_matches.size()) {
-    attribute_vector_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    context->with_iterators(attribute_vector_iterable, [&](auto left_it, auto left_end) {
       static const auto always_true = [](const auto&) { return true; };
       this->_unary_scan(always_true, left_it, left_end, chunk_id, matches_out);
     });
@@ -126,7 +140,7 @@ void LikeTableScanImpl::handle_column(const BaseDictionaryColumn& base_column,
 
   const auto dictionary_lookup = [&dictionary_matches](const ValueID& value) { return dictionary_matches[value]; };
 
-  attribute_vector_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+  context->with_iterators(attribute_vector_iterable, [&](auto left_it, auto left_end) {
     this->_unary_scan(dictionary_lookup, left_it, left_end, chunk_id, matches_out);
   });
 }
@@ -139,10 +153,25 @@ std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_diction
   auto& dictionary_matches = result.second;
 
   count = 0u;
+
+  if (_prefix) {
+    dictionary_matches.resize(dictionary.size(), _invert_results);
+    for (const auto& range : _find_prefix_value_id_ranges(dictionary)) {
+      const auto range_begin = static_cast<size_t>(range.first);
+      const auto range_end = static_cast<size_t>(range.second);
+      std::fill(dictionary_matches.begin() + range_begin, dictionary_matches.begin() + range_end, !_invert_results);
+      count += range_end - range_begin;
+    }
+    if (_invert_results) count = dictionary.size() - count;
+
+    return result;
+  }
+
   dictionary_matches.reserve(dictionary.size());
 
+  // The pattern is evaluated once per distinct value
   for (const auto& value : dictionary) {
-    const auto result = std::regex_match(value, _regex) ^ _invert_results;
+    const auto result = _matcher.matches(value) ^ _invert_results;
     count += static_cast<size_t>(result);
     dictionary_matches.push_back(result);
   }
@@ -150,4 +179,20 @@ std::pair<size_t, std::vector<bool>> LikeTableScanImpl::_find_matches_in_diction
   return result;
 }
 
+std::vector<std::pair<ValueID, ValueID>> LikeTableScanImpl::_find_prefix_value_id_ranges(
+    const pmr_vector<std::string>& dictionary) {
+  const auto lower_bound = [&](const std::string& value) {
+    return std::lower_bound(dictionary.cbegin(), dictionary.cend(), value);
+  };
+  const auto ranges = find_prefix_ranges(*_prefix, dictionary.cbegin(), dictionary.cend(), lower_bound);
+
+  auto value_id_ranges = std::vector<std::pair<ValueID, ValueID>>{};
+  value_id_ranges.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    value_id_ranges.emplace_back(static_cast<ValueID>(std::distance(dictionary.cbegin(), range.first)),
+                                 static_cast<ValueID>(std::distance(dictionary.cbegin(), range.second)));
+  }
+  return value_id_ranges;
+}
+
 }  // namespace opossum
@@ -1,13 +1,16 @@
 #pragma once
 
+#include <algorithm>
+#include <cctype>
 #include <map>
 #include <memory>
-#include <regex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base_single_column_table_scan_impl.hpp"
+#include "like_matcher.hpp"
 
 #include "types.hpp"
 
@@ -23,6 +26,8 @@ class Table;
  * - For dictionary columns, we check the values in the dictionary and store the results in a vector
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the column satisfy the expression.
+ * - Patterns are evaluated using a LikeMatcher. For dictionary columns with prefix patterns (e.g., 'abc%'), the
+ *   matching value IDs are determined by binary search in the dictionary instead.
  */
 class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -41,11 +46,29 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
 
  public:
   /**
-   * @defgroup Methods which are used to convert an SQL wildcard into a C++ regex.
+   * @defgroup Methods for evaluating prefix patterns using sorted sequences
    * @{
    */
 
-  static std::string sqllike_to_regex(std::string sqllike);
+  /**
+   * @returns the prefix if the pattern is of the form 'prefix%' and the prefix contains no wildcards, std::nullopt
+   *          otherwise
+   */
+  static std::optional<std::string> extract_prefix(const std::string& sqllike);
+
+  /**
+   * Determines the ranges of a sorted sequence (e.g., a dictionary or an index) that contain the values starting with
+   * prefix. As LIKE is case insensitive, a prefix can match several ranges, e.g., 'ab%' matches the ranges of 'AB',
+   * 'Ab', 'aB', and 'ab'. The ranges are narrowed down character by character, and only ranges that contain values are
+   * refined further, so that the number of lookups depends on the case variants actually present.
+   *
+   * @param lower_bound returns the position of the first value that is not less than the passed string
+   * @returns the non-empty ranges in ascending order
+   */
+  template <typename Position, typename LowerBound>
+  static std::vector<std::pair<Position, Position>> find_prefix_ranges(const std::string& prefix, const Position begin,
+                                                                       const Position end,
+                                                                       const LowerBound& lower_bound);
 
   /**@}*/
 
@@ -60,13 +83,66 @@ class LikeTableScanImpl : public BaseSingleColumnTableScanImpl {
    */
   std::pair<size_t, std::vector<bool>> _find_matches_in_dictionary(const pmr_vector<std::string>& dictionary);
 
+  /**
+   * @returns the ranges of value IDs [begin, end) whose values start with the prefix
+   */
+  std::vector<std::pair<ValueID, ValueID>> _find_prefix_value_id_ranges(const pmr_vector<std::string>& dictionary);
+
   /**@}*/
 
+  // The smallest string that is greater than all strings starting with prefix, if such a string exists
+  static std::optional<std::string> _next_prefix(std::string prefix);
+
  private:
   const std::string _right_wildcard;
   const bool _invert_results;
 
-  std::regex _regex;
+  const LikeMatcher _matcher;
+
+  // Prefix of the pattern if it is a prefix pattern
+  const std::optional<std::string> _prefix;
 };
 
+template <typename Position, typename LowerBound>
+std::vector<std::pair<Position, Position>> LikeTableScanImpl::find_prefix_ranges(const std::string& prefix,
+                                                                                  const Position begin,
+                                                                                  const Position end,
+                                                                                  const LowerBound& lower_bound) {
+  // Each range contains the values starting with the candidate at the same index
+  auto ranges = std::vector<std::pair<Position, Position>>{{begin, end}};
+  auto candidates = std::vector<std::string>{""};
+
+  for (const auto character : prefix) {
+    // As in LikeMatcher, only characters of the "C" locale are case-converted. Upper-case letters come first so that
+    // the ranges remain sorted.
+    const auto upper = static_cast<char>(std::toupper(static_cast<unsigned char>(character)));
+    const auto lower = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+    const auto variants = upper == lower ? std::string{upper} : std::string{upper, lower};
+
+    auto next_ranges = std::vector<std::pair<Position, Position>>{};
+    auto next_candidates = std::vector<std::string>{};
+    for (auto range_index = size_t{0}; range_index < ranges.size(); ++range_index) {
+      for (const auto variant : variants) {
+        auto candidate = candidates[range_index] + variant;
+
+        const auto range_begin = lower_bound(candidate);
+        const auto next_candidate = _next_prefix(candidate);
+        // lower_bound() might return a position beyond the end of the enclosing range, e.g., the end of an index
+        const auto range_end = next_candidate ? std::min(lower_bound(*next_candidate), ranges[range_index].second)
+                                              : ranges[range_index].second;
+        if (!(range_begin < range_end)) continue;
+
+        next_ranges.emplace_back(range_begin, range_end);
+        next_candidates.emplace_back(std::move(candidate));
+      }
+    }
+
+    ranges = std::move(next_ranges);
+    candidates = std::move(next_candidates);
+    if (ranges.empty()) break;
+  }
+
+  return ranges;
+}
+
 }  // namespace opossum
@@ -1,16 +1,23 @@
 #include "single_column_table_scan_impl.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "storage/base_dictionary_column.hpp"
+#include "storage/chunk.hpp"
 #include "storage/column_iterables/constant_value_iterable.hpp"
 #include "storage/column_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/create_iterable_from_column.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/resolve_encoded_column_type.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
 
 #include "resolve_type.hpp"
+#include "type_cast.hpp"
 #include "type_comparison.hpp"
 
 namespace opossum {
@@ -33,14 +40,30 @@ PosList SingleColumnTableScanImpl::scan_chunk(ChunkID chunk_id) {
     return PosList{};
   }
 
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  auto matches_out = PosList{};
+  if (_scan_sorted_column(*chunk, chunk_id, ChunkOffset{0}, static_cast<ChunkOffset>(chunk->size()), matches_out)) {
+    return matches_out;
+  }
+
   return BaseSingleColumnTableScanImpl::scan_chunk(chunk_id);
 }
 
+PosList SingleColumnTableScanImpl::scan_chunk_range(ChunkID chunk_id, ChunkOffset begin, ChunkOffset end) {
+  // see scan_chunk()
+  if (variant_is_null(_right_value)) return PosList{};
+
+  const auto chunk = _in_table->get_chunk(chunk_id);
+  auto matches_out = PosList{};
+  if (_scan_sorted_column(*chunk, chunk_id, begin, end, matches_out)) return matches_out;
+
+  return BaseSingleColumnTableScanImpl::scan_chunk_range(chunk_id, begin, end);
+}
+
 void SingleColumnTableScanImpl::handle_column(const BaseValueColumn& base_column,
                                               std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
   const auto chunk_id = context->_chunk_id;
 
   const auto left_column_type = _in_table->column_data_type(_left_column_id);
@@ -53,7 +76,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseValueColumn& base_column
     auto left_column_iterable = create_iterable_from_column(left_column);
     auto right_value_iterable = ConstantValueIterable<ColumnDataType>{_right_value};
 
-    left_column_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    context->with_iterators(left_column_iterable, [&](auto left_it, auto left_end) {
       right_value_iterable.with_iterators([&](auto right_it, auto right_end) {
         with_comparator(_predicate_condition, [&](auto comparator) {
           _binary_scan(comparator, left_it, left_end, right_it, chunk_id, matches_out);
@@ -67,7 +90,6 @@ void SingleColumnTableScanImpl::handle_column(const BaseEncodedColumn& base_colu
                                               std::shared_ptr<ColumnVisitableContext> base_context) {
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
   const auto chunk_id = context->_chunk_id;
 
   const auto left_column_type = _in_table->column_data_type(_left_column_id);
@@ -79,7 +101,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseEncodedColumn& base_colu
       auto left_column_iterable = create_iterable_from_column(typed_column);
       auto right_value_iterable = ConstantValueIterable<Type>{_right_value};
 
-      left_column_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+      context->with_iterators(left_column_iterable, [&](auto left_it, auto left_end) {
         right_value_iterable.with_iterators([&](auto right_it, auto right_end) {
           with_comparator(_predicate_condition, [&](auto comparator) {
             _binary_scan(comparator, left_it, left_end, right_it, chunk_id, matches_out);
@@ -95,7 +117,6 @@ void SingleColumnTableScanImpl::handle_column(const BaseDictionaryColumn& left_c
   auto context = std::static_pointer_cast<Context>(base_context);
   auto& matches_out = context->_matches_out;
   const auto chunk_id = context->_chunk_id;
-  const auto& mapped_chunk_offsets = context->_mapped_chunk_offsets;
 
   /**
    * ValueID value_id; // left value id
@@ -129,7 +150,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseDictionaryColumn& left_c
   auto left_iterable = create_iterable_from_attribute_vector(left_column);
 
   if (_right_value_matches_all(left_column, search_value_id)) {
-    left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+    context->with_iterators(left_iterable, [&](auto left_it, auto left_end) {
       static const auto always_true = [](const auto&) { return true; };
       this->_unary_scan(always_true, left_it, left_end, chunk_id, matches_out);
     });
@@ -143,7 +164,7 @@ void SingleColumnTableScanImpl::handle_column(const BaseDictionaryColumn& left_c
 
   auto right_iterable = ConstantValueIterable<ValueID>{search_value_id};
 
-  left_iterable.with_iterators(mapped_chunk_offsets.get(), [&](auto left_it, auto left_end) {
+  context->with_iterators(left_iterable, [&](auto left_it, auto left_end) {
     right_iterable.with_iterators([&](auto right_it, auto right_end) {
       this->_with_operator_for_dict_column_scan(_predicate_condition, [&](auto comparator) {
         this->_binary_scan(comparator, left_it, left_end, right_it, chunk_id, matches_out);
@@ -169,6 +190,150 @@ ValueID SingleColumnTableScanImpl::_get_search_value_id(const BaseDictionaryColu
   }
 }
 
+bool SingleColumnTableScanImpl::_scan_sorted_column(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin,
+                                                    const ChunkOffset end, PosList& matches_out) const {
+  const auto& ordered_by = chunk.ordered_by();
+  if (!ordered_by || ordered_by->first != _left_column_id) return false;
+
+  const auto order_by_mode = ordered_by->second;
+  const auto& column = *chunk.get_column(_left_column_id);
+  auto scanned = false;
+
+  resolve_data_type(_in_table->column_data_type(_left_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    if (const auto value_column = dynamic_cast<const ValueColumn<ColumnDataType>*>(&column)) {
+      const auto& values = value_column->values();
+      const auto size = static_cast<ChunkOffset>(values.size());
+      const auto search_value = type_cast<ColumnDataType>(_right_value);
+
+      const auto is_null = [&](const ChunkOffset offset) {
+        return value_column->is_nullable() && value_column->null_values()[offset];
+      };
+      const auto is_less = [&](const ChunkOffset offset) { return values[offset] < search_value; };
+      const auto is_less_equal = [&](const ChunkOffset offset) { return !(search_value < values[offset]); };
+
+      _scan_sorted_column_range(size, order_by_mode, is_null, is_less, is_less_equal, chunk_id, begin, end,
+                                matches_out);
+      scanned = true;
+    } else if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<ColumnDataType>*>(&column)) {
+      // Since the dictionary is sorted, the value IDs are sorted in the same way as the values
+      const auto size = static_cast<ChunkOffset>(dictionary_column->size());
+      const auto null_value_id = dictionary_column->null_value_id();
+      const auto decoder = dictionary_column->attribute_vector()->create_base_decoder();
+
+      // INVALID_VALUE_ID denotes that all values are smaller than the search value
+      const auto to_value_id_bound = [&](const ValueID value_id) -> uint32_t {
+        return value_id == INVALID_VALUE_ID ? dictionary_column->unique_values_count() : value_id;
+      };
+      const auto lower_bound = to_value_id_bound(dictionary_column->lower_bound(_right_value));
+      const auto upper_bound = to_value_id_bound(dictionary_column->upper_bound(_right_value));
+
+      const auto is_null = [&](const ChunkOffset offset) { return decoder->get(offset) == null_value_id; };
+      const auto is_less = [&](const ChunkOffset offset) { return decoder->get(offset) < lower_bound; };
+      const auto is_less_equal = [&](const ChunkOffset offset) { return decoder->get(offset) < upper_bound; };
+
+      _scan_sorted_column_range(size, order_by_mode, is_null, is_less, is_less_equal, chunk_id, begin, end,
+                                matches_out);
+      scanned = true;
+    }
+  });
+
+  return scanned;
+}
+
+template <typename IsNull, typename IsLess, typename IsLessEqual>
+void SingleColumnTableScanImpl::_scan_sorted_column_range(const ChunkOffset size, const OrderByMode order_by_mode,
+                                                          const IsNull& is_null, const IsLess& is_less,
+                                                          const IsLessEqual& is_less_equal, const ChunkID chunk_id,
+                                                          const ChunkOffset begin, const ChunkOffset end,
+                                                          PosList& matches_out) const {
+  // Returns the first offset in [first, last) for which predicate does not hold, assuming that the range is partitioned
+  const auto partition_point = [](ChunkOffset first, ChunkOffset last, const auto& predicate) {
+    while (first < last) {
+      const auto middle = static_cast<ChunkOffset>(first + (last - first) / 2);
+      if (predicate(middle)) {
+        first = middle + 1;
+      } else {
+        last = middle;
+      }
+    }
+    return first;
+  };
+
+  // NULLs are stored contiguously at the front or at the end of the chunk
+  auto non_null_begin = ChunkOffset{0};
+  auto non_null_end = size;
+  if (order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending) {
+    non_null_begin = partition_point(ChunkOffset{0}, size, is_null);
+  } else {
+    non_null_end = partition_point(ChunkOffset{0}, size, [&](const ChunkOffset offset) { return !is_null(offset); });
+  }
+
+  // Split the non-NULL values into the ranges of values smaller than, equal to, and greater than the search value
+  using Range = std::pair<ChunkOffset, ChunkOffset>;
+  auto less_range = Range{};
+  auto equal_range = Range{};
+  auto greater_range = Range{};
+
+  if (order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::AscendingNullsLast) {
+    const auto equal_begin = partition_point(non_null_begin, non_null_end, is_less);
+    const auto equal_end = partition_point(equal_begin, non_null_end, is_less_equal);
+    less_range = {non_null_begin, equal_begin};
+    equal_range = {equal_begin, equal_end};
+    greater_range = {equal_end, non_null_end};
+  } else {
+    const auto equal_begin =
+        partition_point(non_null_begin, non_null_end, [&](const ChunkOffset offset) { return !is_less_equal(offset); });
+    const auto equal_end =
+        partition_point(equal_begin, non_null_end, [&](const ChunkOffset offset) { return !is_less(offset); });
+    greater_range = {non_null_begin, equal_begin};
+    equal_range = {equal_begin, equal_end};
+    less_range = {equal_end, non_null_end};
+  }
+
+  auto ranges = std::vector<Range>{};
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      ranges = {equal_range};
+      break;
+    case PredicateCondition::NotEquals:
+      ranges = {less_range, greater_range};
+      break;
+    case PredicateCondition::LessThan:
+      ranges = {less_range};
+      break;
+    case PredicateCondition::LessThanEquals:
+      ranges = {less_range, equal_range};
+      break;
+    case PredicateCondition::GreaterThan:
+      ranges = {greater_range};
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      ranges = {equal_range, greater_range};
+      break;
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+
+  // Emit the matches in the order in which they are stored, restricted to the scanned range
+  std::sort(ranges.begin(), ranges.end());
+  for (auto& range : ranges) {
+    range.first = std::clamp(range.first, begin, end);
+    range.second = std::clamp(range.second, begin, end);
+  }
+
+  auto match_count = size_t{0};
+  for (const auto& range : ranges) match_count += range.second - range.first;
+  matches_out.reserve(matches_out.size() + match_count);
+
+  for (const auto& range : ranges) {
+    for (auto chunk_offset = range.first; chunk_offset < range.second; ++chunk_offset) {
+      matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+}
+
 bool SingleColumnTableScanImpl::_right_value_matches_all(const BaseDictionaryColumn& column,
                                                          const ValueID search_value_id) const {
   switch (_predicate_condition) {
@@ -13,6 +13,8 @@
 
 namespace opossum {
 
+class Chunk;
+
 /**
  * @brief Compares one column to a constant value
  *
@@ -20,6 +22,8 @@ namespace opossum {
  * - For dictionary columns, we basically look up the value ID of the constant value in the dictionary
  *   in order to avoid having to look up each value ID of the attribute vector in the dictionary. This also
  *   enables us to detect if all or none of the values in the column satisfy the expression.
+ * - If a chunk is known to be sorted by the scanned column (see Chunk::ordered_by()) and the column is a value or
+ *   dictionary column, the matching rows form at most two contiguous ranges, which are found using binary search.
  */
 class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
  public:
@@ -28,6 +32,8 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   PosList scan_chunk(ChunkID) override;
 
+  PosList scan_chunk_range(ChunkID chunk_id, ChunkOffset begin, ChunkOffset end) override;
+
   void handle_column(const BaseValueColumn& base_column, std::shared_ptr<ColumnVisitableContext> base_context) override;
 
   void handle_column(const BaseDictionaryColumn& base_column,
@@ -46,6 +52,28 @@ class SingleColumnTableScanImpl : public BaseSingleColumnTableScanImpl {
 
   ValueID _get_search_value_id(const BaseDictionaryColumn& column) const;
 
+  /**
+   * @defgroup Methods used for scanning sorted columns
+   * @{
+   */
+
+  // Emits the matches within [begin, end) if the chunk is sorted by the scanned column. Returns false if it is not or
+  // if the column type does not support binary search, in which case nothing was written to matches_out.
+  bool _scan_sorted_column(const Chunk& chunk, const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end,
+                           PosList& matches_out) const;
+
+  /**
+   * Emits all matches of a sorted column within [begin, end).
+   * @param is_null         is_null(offset) returns true if the value at offset is NULL
+   * @param is_less         is_less(offset) returns true if the value at offset is smaller than the search value
+   * @param is_less_equal   is_less_equal(offset) returns true if the value at offset is not larger than the search value
+   */
+  template <typename IsNull, typename IsLess, typename IsLessEqual>
+  void _scan_sorted_column_range(const ChunkOffset size, const OrderByMode order_by_mode, const IsNull& is_null,
+                                 const IsLess& is_less, const IsLessEqual& is_less_equal, const ChunkID chunk_id,
+                                 const ChunkOffset begin, const ChunkOffset end, PosList& matches_out) const;
+  /**@}*/
+
   bool _right_value_matches_all(const BaseDictionaryColumn& column, const ValueID search_value_id) const;
 
   bool _right_value_matches_none(const BaseDictionaryColumn& column, const ValueID search_value_id) const;
@@ -34,6 +34,8 @@ Validate::Validate(const std::shared_ptr<AbstractOperator> in) : AbstractReadOnl
 
 const std::string Validate::name() const { return "Validate"; }
 
+bool Validate::is_chunkwise() const { return true; }
+
 std::shared_ptr<AbstractOperator> Validate::_on_recreate(
     const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
     const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
@@ -53,7 +55,8 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
   const auto our_tid = transaction_context->transaction_id();
   const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
 
-  for (ChunkID chunk_id{0}; chunk_id < _in_table->chunk_count(); ++chunk_id) {
+  const auto input_chunk_range = _input_chunk_range();
+  for (auto chunk_id = input_chunk_range.first; chunk_id < input_chunk_range.second; ++chunk_id) {
     const auto chunk_in = _in_table->get_chunk(chunk_id);
 
     ChunkColumns output_columns;
@@ -111,6 +114,11 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
 
     if (!pos_list_out->empty() > 0) {
       output->append_chunk(output_columns);
+
+      // Validate only removes rows, so the output chunk is sorted in the same way as the input chunk
+      if (chunk_in->ordered_by()) {
+        output->get_chunk(static_cast<ChunkID>(output->chunk_count() - 1))->set_ordered_by(chunk_in->ordered_by());
+      }
     }
   }
   return output;
@@ -22,6 +22,8 @@ class Validate : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
 
+  bool is_chunkwise() const override;
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
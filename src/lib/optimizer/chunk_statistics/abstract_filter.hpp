@@ -25,6 +25,9 @@ class AbstractFilter : public std::enable_shared_from_this<AbstractFilter> {
    * on the column/chunk that this filter was created on would yield zero result rows.
   */
   virtual bool can_prune(const AllTypeVariant& value, const PredicateCondition predicate_type) const = 0;
+
+  // Returns the number of bytes held by the filter
+  virtual size_t memory_consumption() const = 0;
 };
 
 }  // namespace opossum
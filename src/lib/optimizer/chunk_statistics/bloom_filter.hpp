@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "optimizer/chunk_statistics/abstract_filter.hpp"
+#include "storage/memory_usage.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+#include "utils/murmur_hash.hpp"
+
+namespace opossum {
+
+//! default probability with which the filter cannot prune a value that is not contained in the column
+static constexpr double DEFAULT_BLOOM_FILTER_FALSE_POSITIVE_RATE = 0.01;
+
+/**
+ * Filter that stores the set of a column's values as a Bloom filter.
+ * Other than the MinMaxFilter and the RangeFilter, it can prune equality predicates on values that lie in between the
+ * column's values, e.g., lookups of random keys such as UUIDs or hashes. It never prunes a value that is contained in
+ * the column and fails to prune a value that is not contained with (roughly) the false positive rate it was built for.
+ * Uses double hashing, i.e., the k bit positions of a value are h1 + i * h2 for i in [0, k).
+*/
+template <typename T>
+class BloomFilter : public AbstractFilter {
+ public:
+  BloomFilter(std::vector<bool> bits, uint32_t hash_function_count)
+      : _bits(std::move(bits)), _hash_function_count(hash_function_count) {}
+  ~BloomFilter() override = default;
+
+  static std::unique_ptr<BloomFilter<T>> build_filter(
+      const pmr_vector<T>& dictionary, double false_positive_rate = DEFAULT_BLOOM_FILTER_FALSE_POSITIVE_RATE);
+
+  bool can_prune(const AllTypeVariant& value, const PredicateCondition predicate_type) const override {
+    if (predicate_type != PredicateCondition::Equals) return false;
+    return !_might_contain(boost::get<T>(value));
+  }
+
+  size_t memory_consumption() const override { return sizeof(*this) + container_memory_usage(_bits); }
+
+ protected:
+  bool _might_contain(const T& value) const {
+    const auto first_hash = _hash(value, FIRST_SEED);
+    const auto second_hash = _hash(value, SECOND_SEED);
+    for (auto hash_function_id = size_t{0}; hash_function_id < _hash_function_count; ++hash_function_id) {
+      if (!_bits[(first_hash + hash_function_id * second_hash) % _bits.size()]) return false;
+    }
+    return true;
+  }
+
+  // Values that compare equal must have the same hash, so -0.0 is hashed as 0.0 and all NaNs as the same NaN
+  static size_t _hash(const T& value, const unsigned int seed) {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(value)) return murmur2<T>(std::numeric_limits<T>::quiet_NaN(), seed);
+      if (value == T{0}) return murmur2<T>(T{0}, seed);
+    }
+    return murmur2<T>(value, seed);
+  }
+
+  static constexpr unsigned int FIRST_SEED = 0x5bd1e995;
+  static constexpr unsigned int SECOND_SEED = 0x1b873593;
+  // Limits the lookup costs for filters over very few values, whose minimum size allows for many hash functions
+  static constexpr uint32_t MAX_HASH_FUNCTION_COUNT = 16;
+
+  const std::vector<bool> _bits;
+  const uint32_t _hash_function_count;
+};
+
+template <typename T>
+std::unique_ptr<BloomFilter<T>> BloomFilter<T>::build_filter(const pmr_vector<T>& dictionary,
+                                                             double false_positive_rate) {
+  DebugAssert(!dictionary.empty(), "Dictionary must not be empty");
+  Assert(false_positive_rate > 0.0 && false_positive_rate < 1.0, "False positive rate must be in (0, 1)");
+
+  // Optimal number of bits m = -n * ln(p) / ln(2)^2 and of hash functions k = m / n * ln(2) for n values
+  const auto value_count = static_cast<double>(dictionary.size());
+  const auto optimal_bit_count = -value_count * std::log(false_positive_rate) / std::pow(std::log(2), 2);
+  const auto bit_count = std::max(size_t{64}, static_cast<size_t>(std::ceil(optimal_bit_count)));
+  const auto optimal_hash_function_count = static_cast<uint32_t>(std::round(bit_count / value_count * std::log(2)));
+  const auto hash_function_count = std::clamp(optimal_hash_function_count, uint32_t{1}, MAX_HASH_FUNCTION_COUNT);
+
+  auto bits = std::vector<bool>(bit_count);
+  for (const auto& value : dictionary) {
+    const auto first_hash = _hash(value, FIRST_SEED);
+    const auto second_hash = _hash(value, SECOND_SEED);
+    for (auto hash_function_id = size_t{0}; hash_function_id < hash_function_count; ++hash_function_id) {
+      bits[(first_hash + hash_function_id * second_hash) % bit_count] = true;
+    }
+  }
+
+  return std::make_unique<BloomFilter<T>>(std::move(bits), hash_function_count);
+}
+
+}  // namespace opossum
@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <iterator>
+#include <optional>
 #include <type_traits>
 #include <unordered_set>
 
 #include "resolve_type.hpp"
 
 #include "optimizer/chunk_statistics/abstract_filter.hpp"
+#include "optimizer/chunk_statistics/bloom_filter.hpp"
 #include "optimizer/chunk_statistics/min_max_filter.hpp"
 #include "optimizer/chunk_statistics/range_filter.hpp"
 #include "storage/base_encoded_column.hpp"
@@ -21,7 +23,8 @@
 namespace opossum {
 
 template <typename T>
-static std::shared_ptr<ChunkColumnStatistics> build_statistics_from_dictionary(const pmr_vector<T>& dictionary) {
+static std::shared_ptr<ChunkColumnStatistics> build_statistics_from_dictionary(
+    const pmr_vector<T>& dictionary, const std::optional<double>& bloom_filter_false_positive_rate) {
   auto statistics = std::make_shared<ChunkColumnStatistics>();
   // only create statistics when the compressed dictionary is not empty
   if (!dictionary.empty()) {
@@ -36,14 +39,21 @@ static std::shared_ptr<ChunkColumnStatistics> build_statistics_from_dictionary(c
       statistics->add_filter(std::move(min_max_filter));
     }
     // clang-format on
+
+    // Range filters over few values are exact, a bloom filter only helps if there are gaps between the ranges
+    const auto range_filter_is_exact = std::is_arithmetic_v<T> && dictionary.size() <= MAX_RANGES_COUNT;
+    if (bloom_filter_false_positive_rate && !range_filter_is_exact) {
+      auto bloom_filter = BloomFilter<T>::build_filter(dictionary, *bloom_filter_false_positive_rate);
+      statistics->add_filter(std::move(bloom_filter));
+    }
   }
   return statistics;
 }
 
-std::shared_ptr<ChunkColumnStatistics> ChunkColumnStatistics::build_statistics(DataType data_type,
-                                                                               std::shared_ptr<BaseColumn> column) {
+std::shared_ptr<ChunkColumnStatistics> ChunkColumnStatistics::build_statistics(
+    DataType data_type, std::shared_ptr<BaseColumn> column, const std::optional<double>& bloom_filter_false_positive_rate) {
   std::shared_ptr<ChunkColumnStatistics> statistics;
-  resolve_data_and_column_type(*column, [&statistics](auto type, auto& typed_column) {
+  resolve_data_and_column_type(*column, [&](auto type, auto& typed_column) {
     using ColumnType = typename std::decay<decltype(typed_column)>::type;
     using DataTypeT = typename decltype(type)::type;
 
@@ -51,10 +61,11 @@ std::shared_ptr<ChunkColumnStatistics> ChunkColumnStatistics::build_statistics(D
     if constexpr(std::is_same_v<ColumnType, DictionaryColumn<DataTypeT>>) {
         // we can use the fact that dictionary columns have an accessor for the dictionary
         const auto& dictionary = *typed_column.dictionary();
-        statistics = build_statistics_from_dictionary(dictionary);
+        statistics = build_statistics_from_dictionary(dictionary, bloom_filter_false_positive_rate);
     } else {
-      if constexpr(std::is_base_of_v<BaseEncodedColumn, ColumnType>) {
-        // if we have a generic encoded column we create the dictionary ourselves
+      if constexpr(std::is_base_of_v<BaseEncodedColumn, ColumnType> ||
+                   std::is_same_v<ColumnType, ValueColumn<DataTypeT>>) {
+        // if we have a generic encoded column or an unencoded column we create the dictionary ourselves
         auto iterable = create_iterable_from_column(typed_column);
         std::unordered_set<DataTypeT> values;
         iterable.for_each([&](const auto& value) {
@@ -65,9 +76,9 @@ std::shared_ptr<ChunkColumnStatistics> ChunkColumnStatistics::build_statistics(D
         });
         pmr_vector<DataTypeT> dictionary{values.cbegin(), values.cend()};
         std::sort(dictionary.begin(), dictionary.end());
-        statistics = build_statistics_from_dictionary(dictionary);
+        statistics = build_statistics_from_dictionary(dictionary, bloom_filter_false_positive_rate);
       } else {
-       Fail("ChunkColumnStatistics should only be built for encoded columns.");
+       Fail("ChunkColumnStatistics should only be built for data columns.");
       }
     }
     // clang-format on
@@ -84,4 +95,12 @@ bool ChunkColumnStatistics::can_prune(const AllTypeVariant& value, const Predica
   }
   return false;
 }
+
+size_t ChunkColumnStatistics::memory_consumption() const {
+  auto bytes = sizeof(*this) + _filters.capacity() * sizeof(std::shared_ptr<AbstractFilter>);
+  for (const auto& filter : _filters) {
+    bytes += filter->memory_consumption();
+  }
+  return bytes;
+}
 }  // namespace opossum
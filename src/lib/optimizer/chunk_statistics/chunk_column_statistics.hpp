@@ -1,12 +1,19 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <vector>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 #include "optimizer/chunk_statistics/abstract_filter.hpp"
+#include "optimizer/chunk_statistics/bloom_filter.hpp"
+#include "optimizer/chunk_statistics/min_max_filter.hpp"
+#include "optimizer/chunk_statistics/range_filter.hpp"
 
 namespace opossum {
 
@@ -18,8 +25,24 @@ class BaseColumn;
  */
 class ChunkColumnStatistics final {
  public:
-  static std::shared_ptr<ChunkColumnStatistics> build_statistics(DataType data_type,
-                                                                 std::shared_ptr<BaseColumn> column);
+  /**
+   * Builds a MinMaxFilter or a RangeFilter and, if a false positive rate is given, a BloomFilter for the column's
+   * values. Bloom filters allow pruning equality predicates on high-cardinality columns (e.g., random keys), for which
+   * the value ranges are too wide.
+   */
+  static std::shared_ptr<ChunkColumnStatistics> build_statistics(
+      DataType data_type, std::shared_ptr<BaseColumn> column,
+      const std::optional<double>& bloom_filter_false_positive_rate = std::nullopt);
+
+  /**
+   * Returns statistics that cover the values described by statistics and all values within [min, max]. Statistics
+   * without filters stand for a column without non-NULL values. The result only consists of a MinMaxFilter, which is
+   * cheap to extend again. BloomFilters are dropped, as they do not cover the new values. Used to maintain the
+   * statistics of mutable chunks while rows are inserted.
+   */
+  template <typename T>
+  static std::shared_ptr<ChunkColumnStatistics> extend_statistics(
+      const std::shared_ptr<const ChunkColumnStatistics>& statistics, const T& min, const T& max);
 
   void add_filter(std::shared_ptr<AbstractFilter> filter);
 
@@ -28,7 +51,46 @@ class ChunkColumnStatistics final {
   */
   bool can_prune(const AllTypeVariant& value, const PredicateCondition predicate_type) const;
 
+  // Returns the number of bytes held by this object and its filters
+  size_t memory_consumption() const;
+
  protected:
   std::vector<std::shared_ptr<AbstractFilter>> _filters;
 };
+
+template <typename T>
+std::shared_ptr<ChunkColumnStatistics> ChunkColumnStatistics::extend_statistics(
+    const std::shared_ptr<const ChunkColumnStatistics>& statistics, const T& min, const T& max) {
+  auto extended_min = min;
+  auto extended_max = max;
+  if (statistics) {
+    for (const auto& filter : statistics->_filters) {
+      if (const auto min_max_filter = std::dynamic_pointer_cast<const MinMaxFilter<T>>(filter)) {
+        extended_min = std::min(extended_min, min_max_filter->min());
+        extended_max = std::max(extended_max, min_max_filter->max());
+        continue;
+      }
+
+      if (std::dynamic_pointer_cast<const BloomFilter<T>>(filter)) continue;
+
+      // Chunks whose columns were all "encoded" as Unencoded remain mutable and carry RangeFilters
+      // clang-format off
+      if constexpr(std::is_arithmetic_v<T>) {
+        if (const auto range_filter = std::dynamic_pointer_cast<const RangeFilter<T>>(filter)) {
+          extended_min = std::min(extended_min, range_filter->min());
+          extended_max = std::max(extended_max, range_filter->max());
+          continue;
+        }
+      }
+      // clang-format on
+
+      Fail("Only statistics that consist of MinMaxFilters, RangeFilters, or BloomFilters can be extended");
+    }
+  }
+
+  auto extended_statistics = std::make_shared<ChunkColumnStatistics>();
+  extended_statistics->add_filter(std::make_shared<MinMaxFilter<T>>(extended_min, extended_max));
+  return extended_statistics;
+}
+
 }  // namespace opossum
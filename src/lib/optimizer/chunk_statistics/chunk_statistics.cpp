@@ -11,4 +11,12 @@ bool ChunkStatistics::can_prune(const ColumnID column_id, const AllTypeVariant&
   return _statistics[column_id]->can_prune(value, scan_type);
 }
 
+size_t ChunkStatistics::memory_consumption() const {
+  auto bytes = sizeof(*this) + _statistics.capacity() * sizeof(std::shared_ptr<ChunkColumnStatistics>);
+  for (const auto& column_statistics : _statistics) {
+    bytes += column_statistics->memory_consumption();
+  }
+  return bytes;
+}
+
 }  // namespace opossum
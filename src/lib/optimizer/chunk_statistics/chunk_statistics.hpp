@@ -24,6 +24,9 @@ class ChunkStatistics final : public std::enable_shared_from_this<ChunkStatistic
    */
   bool can_prune(const ColumnID column_id, const AllTypeVariant& value, const PredicateCondition predicate_type) const;
 
+  // Returns the number of bytes held by this object and the statistics of all columns
+  size_t memory_consumption() const;
+
  protected:
   std::vector<std::shared_ptr<ChunkColumnStatistics>> _statistics;
 };
@@ -2,6 +2,7 @@
 
 #include "all_type_variant.hpp"
 #include "optimizer/chunk_statistics/abstract_filter.hpp"
+#include "storage/memory_usage.hpp"
 #include "type_cast.hpp"
 #include "types.hpp"
 
@@ -37,6 +38,13 @@ class MinMaxFilter : public AbstractFilter {
     }
   }
 
+  size_t memory_consumption() const override {
+    return sizeof(*this) + dynamic_memory_usage(_min) + dynamic_memory_usage(_max);
+  }
+
+  const T& min() const { return _min; }
+  const T& max() const { return _max; }
+
  protected:
   const T _min;
   const T _max;
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "optimizer/chunk_statistics/abstract_filter.hpp"
+#include "storage/memory_usage.hpp"
 
 namespace opossum {
 
@@ -65,6 +66,11 @@ class RangeFilter : public AbstractFilter {
     }
   }
 
+  size_t memory_consumption() const override { return sizeof(*this) + container_memory_usage(_ranges); }
+
+  const T& min() const { return _ranges.front().first; }
+  const T& max() const { return _ranges.back().second; }
+
  protected:
   std::vector<std::pair<T, T>> _ranges;
 };
@@ -54,7 +54,10 @@ bool ChunkPruningRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
   auto table = StorageManager::get().get_table(stored_table->table_name());
   std::vector<std::shared_ptr<ChunkStatistics>> statistics;
   for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-    statistics.push_back(table->get_chunk(chunk_id)->statistics());
+    // Mutable chunks can receive matching rows after the plan has been cached or prepared. They are left to
+    // TableScan, which checks their statistics when it is executed.
+    const auto chunk_is_mutable = table->get_chunk(chunk_id)->is_mutable();
+    statistics.push_back(chunk_is_mutable ? nullptr : table->chunk_statistics(chunk_id));
   }
   std::set<ChunkID> excluded_chunk_ids;
   for (auto& predicate : predicate_nodes) {
@@ -11,70 +11,207 @@
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "operators/primary_key_lookup.hpp"
+#include "operators/table_scan/like_table_scan_impl.hpp"
 #include "optimizer/table_statistics.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_encoded_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-// Only if we expect num_output_rows <= num_input_rows * selectivity_threshold, the ScanType can be set to IndexScan.
-// This value is kind of arbitrarily chosen, but the following paper suggests something similar:
-// Access Path Selection in Main-Memory Optimized Data Systems: Should I Scan or Should I Probe?
-constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
+namespace {
+
+// All costs are relative to scanning one row of a dictionary-encoded column with a TableScan.
+
+// Cost of probing the index of one chunk. It keeps IndexScans from being used for small chunks. The break-even point
+// of about 1000 rows is taken from:
+// Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
+constexpr auto INDEX_PROBE_COST = 1000.0f;
+
+// Cost per position returned by an IndexScan. The positions are not ordered by their chunk offsets, so subsequent
+// operators access the columns randomly. With this value, IndexScans on large chunks pay off below a selectivity of
+// about 1%, which matches the findings of: Access Path Selection in Main-Memory Optimized Data Systems: Should I Scan
+// or Should I Probe?
+constexpr auto INDEX_SCAN_COST_PER_MATCH = 100.0f;
+
+// If only some chunks are indexed, UnionPositions has to sort and merge the results of the IndexScan and the TableScan
+constexpr auto UNION_POSITIONS_COST_PER_ROW = 5.0f;
+
+float table_scan_cost_per_row(const BaseColumn& column) {
+  const auto encoded_column = dynamic_cast<const BaseEncodedColumn*>(&column);
+  if (!encoded_column) return 1.5f;  // Compares the actual values
+
+  switch (encoded_column->encoding_type()) {
+    case EncodingType::Dictionary:
+      return 1.0f;  // Compares ValueIDs of the attribute vector
+    case EncodingType::RunLength:
+      return 0.5f;  // Compares each run only once
+    case EncodingType::FrameOfReference:
+      return 1.2f;  // Decodes every value
+    default:
+      return 1.5f;
+  }
+}
+
+// Registered indices are created for all chunks whose columns are dictionary-encoded
+bool has_registered_group_key_index(const Table& table, const std::vector<ColumnID>& column_ids) {
+  const auto index_infos = table.get_indexes();
+  return std::any_of(index_infos.cbegin(), index_infos.cend(), [&](const auto& index_info) {
+    return index_info.type == ColumnIndexType::GroupKey && index_info.column_ids == column_ids;
+  });
+}
 
-// Only if the number of input rows exceeds num_input_rows, the ScanType can be set to IndexScan.
-// The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
-constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
+}  // namespace
 
 std::string IndexScanRule::name() const { return "Index Scan Rule"; }
 
 bool IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
-  if (node->type() == LQPNodeType::Predicate) {
-    const auto& child = node->left_input();
-
-    if (child->type() == LQPNodeType::StoredTable) {
-      const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
-      const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(child);
-      const auto table = StorageManager::get().get_table(stored_table_node->table_name());
-
-      const auto index_infos = table->get_indexes();
-      for (const auto& index_info : index_infos) {
-        if (_is_index_scan_applicable(index_info, predicate_node)) {
-          predicate_node->set_scan_type(ScanType::IndexScan);
-        }
-      }
+  if (node->type() != LQPNodeType::Predicate) return _apply_to_inputs(node);
+
+  // Collect the PredicateNodes of the chain that node is the top of. The predicates can be reordered freely within
+  // the chain as long as the nodes below the top one are not shared with other parts of the plan.
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto chain_bottom = node;
+  auto current_node = node;
+  while (current_node->type() == LQPNodeType::Predicate || current_node->type() == LQPNodeType::Validate) {
+    if (current_node != node && current_node->output_count() != 1) return _apply_to_inputs(node);
+
+    if (current_node->type() == LQPNodeType::Predicate) {
+      predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(current_node));
+    }
+    chain_bottom = current_node;
+    current_node = current_node->left_input();
+  }
+
+  if (current_node->type() != LQPNodeType::StoredTable) return _apply_to_inputs(node);
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(current_node);
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name());
+
+  // Only one predicate of the chain can directly follow the StoredTableNode, so pick the one that saves the most
+  auto best_predicate_node = std::shared_ptr<PredicateNode>{};
+  auto best_cost_saving = 0.0f;
+  for (const auto& predicate_node : predicate_nodes) {
+    // Only predicates on columns of the stored table can be moved to it
+    if (!stored_table_node->find_output_column_id(predicate_node->column_reference())) continue;
+
+    // A lookup in the primary key index is a single hash probe, so it beats scanning regardless of the selectivity
+    const auto column_id = predicate_node->get_output_column_id(predicate_node->column_reference());
+    if (PrimaryKeyLookup::is_applicable(*table, column_id, predicate_node->predicate_condition(),
+                                        predicate_node->value())) {
+      best_predicate_node = predicate_node;
+      break;
+    }
+
+    if (!_is_index_scan_applicable(*table, predicate_node)) continue;
+
+    const auto cost_saving = _estimate_cost_saving(*table, stored_table_node, predicate_node);
+    if (cost_saving > best_cost_saving) {
+      best_predicate_node = predicate_node;
+      best_cost_saving = cost_saving;
     }
   }
 
-  return _apply_to_inputs(node);
+  if (best_predicate_node) {
+    best_predicate_node->set_scan_type(ScanType::IndexScan);
+    _move_to_stored_table_node(best_predicate_node, chain_bottom);
+  }
+
+  return _apply_to_inputs(stored_table_node);
 }
 
-bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
+bool IndexScanRule::_is_index_scan_applicable(const Table& table,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
-  if (!_is_single_column_index(index_info)) return false;
+  // Currently, we do not support two-column predicates
+  if (!is_variant(predicate_node->value())) return false;
 
-  if (index_info.type != ColumnIndexType::GroupKey) return false;
+  const auto column_id = predicate_node->get_output_column_id(predicate_node->column_reference());
 
-  // Currently, we do not support two-column predicates
-  if (is_column_id(predicate_node->value())) return false;
+  switch (predicate_node->predicate_condition()) {
+    case PredicateCondition::Like: {
+      // Prefix patterns on string columns are answered as index range scans
+      const auto& value = boost::get<AllTypeVariant>(predicate_node->value());
+      if (table.column_data_type(column_id) != DataType::String || variant_is_null(value) ||
+          !LikeTableScanImpl::extract_prefix(type_cast<std::string>(value))) {
+        return false;
+      }
+      break;
+    }
+    case PredicateCondition::NotLike:
+    case PredicateCondition::IsNull:
+    case PredicateCondition::IsNotNull:
+      return false;
+    default:
+      break;
+  }
+
+  const auto column_ids = std::vector<ColumnID>{column_id};
+
+  if (has_registered_group_key_index(table, column_ids)) return true;
 
+  // Indices can also be created on chunks directly
+  const auto chunks = table.chunks();
+  return std::any_of(chunks.cbegin(), chunks.cend(), [&](const auto& chunk) {
+    return chunk->get_index(ColumnIndexType::GroupKey, column_ids);
+  });
+}
+
+float IndexScanRule::_estimate_cost_saving(const Table& table,
+                                           const std::shared_ptr<StoredTableNode>& stored_table_node,
+                                           const std::shared_ptr<PredicateNode>& predicate_node) const {
   const auto column_id = predicate_node->get_output_column_id(predicate_node->column_reference());
-  if (index_info.column_ids[0] != column_id) return false;
+  const auto column_ids = std::vector<ColumnID>{column_id};
 
-  const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
-  if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
+  const auto row_count_table = stored_table_node->derive_statistics_from(nullptr, nullptr)->row_count();
+  if (row_count_table <= 0.0f) return 0.0f;
 
-  const auto row_count_predicate = predicate_node->derive_statistics_from(predicate_node->left_input())->row_count();
-  const float selectivity = row_count_predicate / row_count_table;
+  const auto row_count_predicate = predicate_node->derive_statistics_from(stored_table_node)->row_count();
+  const auto selectivity = row_count_predicate / row_count_table;
 
-  if (selectivity > INDEX_SCAN_SELECTIVITY_THRESHOLD) return false;
+  const auto chunks = table.chunks();
+  auto stored_row_count = 0.0f;
+  for (const auto& chunk : chunks) {
+    stored_row_count += chunk->size();
+  }
+  if (stored_row_count == 0.0f) return 0.0f;
+
+  // The row count of the statistics is distributed over the chunks according to their sizes
+  auto table_scan_cost = 0.0f;
+  auto index_scan_cost = 0.0f;
+  auto has_unindexed_chunks = false;
+  for (const auto& chunk : chunks) {
+    const auto chunk_row_count = row_count_table * static_cast<float>(chunk->size()) / stored_row_count;
+
+    const auto chunk_scan_cost = chunk_row_count * table_scan_cost_per_row(*chunk->get_column(column_id));
+    table_scan_cost += chunk_scan_cost;
+
+    if (chunk->get_index(ColumnIndexType::GroupKey, column_ids)) {
+      index_scan_cost += INDEX_PROBE_COST + chunk_row_count * selectivity * INDEX_SCAN_COST_PER_MATCH;
+    } else {
+      index_scan_cost += chunk_scan_cost;
+      has_unindexed_chunks = true;
+    }
+  }
+
+  if (has_unindexed_chunks) index_scan_cost += row_count_predicate * UNION_POSITIONS_COST_PER_ROW;
 
-  return true;
+  return table_scan_cost - index_scan_cost;
 }
 
-inline bool IndexScanRule::_is_single_column_index(const IndexInfo& index_info) const {
-  return index_info.column_ids.size() == 1;
+void IndexScanRule::_move_to_stored_table_node(const std::shared_ptr<PredicateNode>& predicate_node,
+                                               const std::shared_ptr<AbstractLQPNode>& chain_bottom) const {
+  if (predicate_node == chain_bottom) return;
+
+  // PredicateNodes and ValidateNodes only remove rows, so they can be applied in any order. This is required because
+  // the indices are only accessible when the predicate directly follows the StoredTableNode.
+  const auto stored_table_node = chain_bottom->left_input();
+  predicate_node->remove_from_tree();
+  chain_bottom->set_left_input(predicate_node);
+  predicate_node->set_left_input(stored_table_node);
 }
 
 }  // namespace opossum
@@ -5,24 +5,34 @@
 #include <vector>
 
 #include "abstract_rule.hpp"
-#include "storage/index/index_info.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
+class Table;
 
 /**
- * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
- * for being executed by IndexScans. If the expected selectivity of the predicate falls below a certain threshold, the
- * ScanType of the PredicateNode is set to IndexScan.
+ * This optimizer rule decides which PredicateNodes are executed by IndexScans. It looks at chains of PredicateNodes
+ * (and ValidateNodes) on top of a StoredTableNode. For each predicate, it compares the estimated cost of a TableScan,
+ * which depends on the encoding of the scanned column in each chunk, with the estimated cost of probing the indices
+ * of the chunks and materializing the matching positions. Chunks without an index are scanned by a TableScan, whose
+ * result is merged with that of the IndexScan. The predicate with the largest cost saving is set to IndexScan and, as
+ * the IndexScan operator needs a stored table as its input, moved to the bottom of the chain.
+ *
+ * Selectivities are taken from the TableStatistics. The costs are relative to scanning one row of a dictionary-encoded
+ * column, the constants are given in the translation unit.
  *
  * Note:
- * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
- * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
- * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * For now this rule is only applicable to single-column GroupKeyIndexes, which are the only indices the
+ * LQPTranslator uses. Multi-column predicates (i.e. WHERE a < b) are also not supported. Only one predicate per chain
+ * is executed as an IndexScan.
+ *
+ * Equality predicates on the column of a table's primary key index (see Table::create_primary_key_index()) that
+ * PrimaryKeyLookup::is_applicable() accepts are always executed as IndexScans, which the LQPTranslator turns into a
+ * PrimaryKeyLookup.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -31,9 +41,15 @@ class IndexScanRule : public AbstractRule {
   bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
 
  protected:
-  bool _is_index_scan_applicable(const IndexInfo& indx_info,
-                                 const std::shared_ptr<PredicateNode>& predicate_node) const;
-  inline bool _is_single_column_index(const IndexInfo& indexed_columns) const;
+  bool _is_index_scan_applicable(const Table& table, const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  // Returns how much cheaper an IndexScan is estimated to be than a TableScan, negative if it is more expensive
+  float _estimate_cost_saving(const Table& table, const std::shared_ptr<StoredTableNode>& stored_table_node,
+                              const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  // Moves predicate_node from its chain so that it directly follows the StoredTableNode below chain_bottom
+  void _move_to_stored_table_node(const std::shared_ptr<PredicateNode>& predicate_node,
+                                  const std::shared_ptr<AbstractLQPNode>& chain_bottom) const;
 };
 
 }  // namespace opossum
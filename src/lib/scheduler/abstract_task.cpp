@@ -6,18 +6,50 @@
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "cancellation_token.hpp"
 #include "current_scheduler.hpp"
+#include "scheduler_tracer.hpp"
 #include "task_queue.hpp"
 #include "worker.hpp"
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// The Task currently executing on this thread. Tasks it schedules inherit its session and cancellation token.
+thread_local opossum::AbstractTask* this_thread_task = nullptr;
+
+}  // namespace
+
 namespace opossum {
 
 TaskID AbstractTask::id() const { return _id; }
 
 NodeID AbstractTask::node_id() const { return _node_id; }
 
+SessionID AbstractTask::session_id() const { return _session_id; }
+
+void AbstractTask::set_session_id(SessionID session_id) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the session after the Task was scheduled");
+
+  _session_id = session_id;
+}
+
+const std::shared_ptr<CancellationToken>& AbstractTask::cancellation_token() const { return _cancellation_token; }
+
+void AbstractTask::set_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the cancellation token after the Task was scheduled");
+
+  _cancellation_token = cancellation_token;
+}
+
+const std::shared_ptr<CancellationToken>& AbstractTask::this_thread_cancellation_token() {
+  static const auto no_cancellation_token = std::shared_ptr<CancellationToken>{};
+  return ::this_thread_task ? ::this_thread_task->_cancellation_token : no_cancellation_token;
+}
+
+bool AbstractTask::was_cancelled() const { return _was_cancelled; }
+
 bool AbstractTask::is_ready() const { return _predecessor_counter == 0; }
 
 bool AbstractTask::is_done() const { return _done; }
@@ -50,6 +82,11 @@ void AbstractTask::set_done_callback(const std::function<void()>& done_callback)
 }
 
 void AbstractTask::schedule(NodeID preferred_node_id, SchedulePriority priority) {
+  if (::this_thread_task) {
+    if (_session_id == INVALID_SESSION_ID) _session_id = ::this_thread_task->_session_id;
+    if (!_cancellation_token) _cancellation_token = ::this_thread_task->_cancellation_token;
+  }
+
   _mark_as_scheduled();
 
   if (CurrentScheduler::is_set()) {
@@ -87,7 +124,25 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  // Tasks might be executed while another one waits on the same thread, e.g., without a Scheduler
+  auto* const previous_task = ::this_thread_task;
+  ::this_thread_task = this;
+
+  if (_cancellation_token && _cancellation_token->is_cancelled()) {
+    _was_cancelled = true;
+  } else {
+    try {
+      _on_execute();
+    } catch (const QueryCancelledException&) {
+      // The query was cancelled while the Task was executing. Its successors will skip their execution as well.
+      _was_cancelled = true;
+    } catch (...) {
+      ::this_thread_task = previous_task;
+      throw;
+    }
+  }
+
+  ::this_thread_task = previous_task;
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -117,7 +172,14 @@ void AbstractTask::_on_predecessor_done() {
       auto worker = Worker::get_this_thread_worker();
       DebugAssert(static_cast<bool>(worker), "No worker");
 
-      worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::High));
+      // The successor is pulled next by the worker (LIFO), as it likely works on the data that was just produced.
+      // Successors of a session are served round-robin with the tasks of the other sessions instead.
+      SchedulerTracer::on_task_enqueued(*this);
+      if (_session_id != INVALID_SESSION_ID) {
+        worker->queue()->push(shared_from_this(), static_cast<uint32_t>(SchedulePriority::Normal));
+      } else {
+        worker->deque().push(shared_from_this());
+      }
     } else {
       if (_is_scheduled) execute();
       // Otherwise it will get execute()d once it is scheduled. It is entirely possible for Tasks to "become ready"
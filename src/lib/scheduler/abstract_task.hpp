@@ -12,6 +12,7 @@
 
 namespace opossum {
 
+class CancellationToken;
 class Worker;
 
 /**
@@ -20,6 +21,8 @@ class Worker;
  * Derive and implement logic in _on_execute()
  */
 class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
+  friend class SchedulerTracer;
+  friend class TaskDeque;
   friend class Worker;
 
  public:
@@ -31,6 +34,32 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   TaskID id() const;
   NodeID node_id() const;
 
+  /**
+   * The client session (or query) the Task belongs to, used for fair-share scheduling between sessions.
+   * Tasks that are scheduled without a session inherit the session of the Task executing on the scheduling thread,
+   * e.g., the jobs and operator tasks of a query that is executed by a server task.
+   */
+  SessionID session_id() const;
+  void set_session_id(SessionID session_id);
+
+  /**
+   * The token used to cancel the query the Task belongs to, nullptr if it cannot be cancelled. Tasks of a cancelled
+   * query are not executed. Tasks that are scheduled without a token inherit it just like the session.
+   */
+  const std::shared_ptr<CancellationToken>& cancellation_token() const;
+  void set_cancellation_token(const std::shared_ptr<CancellationToken>& cancellation_token);
+
+  /**
+   * The cancellation token of the Task executing on the calling thread, nullptr if there is none
+   */
+  static const std::shared_ptr<CancellationToken>& this_thread_cancellation_token();
+
+  /**
+   * Whether _on_execute() was skipped or aborted because the query was cancelled. A query whose Tasks all executed
+   * completely has a complete result, even if it was cancelled afterwards. Valid once the Task is done.
+   */
+  bool was_cancelled() const;
+
   /**
    * @return All dependencies are done
    */
@@ -99,7 +128,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   bool try_mark_as_enqueued();
 
   /**
-   * Executes the task in the current Thread, blocks until all operations are finished
+   * Executes the task in the current Thread, blocks until all operations are finished. If the query of the Task was
+   * cancelled, _on_execute() is skipped or its QueryCancelledException is swallowed - the Task is done either way.
    */
   void execute();
 
@@ -129,6 +159,9 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   TaskID _id = INVALID_TASK_ID;
   NodeID _node_id = INVALID_NODE_ID;
+  SessionID _session_id = INVALID_SESSION_ID;
+  std::shared_ptr<CancellationToken> _cancellation_token;
+  bool _was_cancelled = false;
   bool _done = false;
   std::function<void()> _done_callback;
 
@@ -142,6 +175,9 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic_bool _is_enqueued{false};
   std::atomic_bool _is_scheduled{false};
 
+  // Keeps the Task alive while it is stored in a TaskDeque, which only holds raw pointers
+  std::shared_ptr<AbstractTask> _deque_reference;
+
   // For making Tasks join()-able
   std::condition_variable _done_condition_variable;
   std::mutex _done_mutex;
@@ -151,6 +187,9 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
 
   // To make sure a task is never executed twice
   std::atomic_bool _started{false};
+
+  // When the Task was last put into a queue or deque as a ready Task, only set while tracing (see SchedulerTracer)
+  int64_t _trace_enqueue_time{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,208 @@
+#include "admission_control.hpp"
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "current_scheduler.hpp"
+#include "operator_task.hpp"
+#include "worker.hpp"
+
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/primary_key_lookup.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/validate.hpp"
+#include "optimizer/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Returns the estimated statistics of the output of op if it filters a stored table, i.e., if it is a GetTable followed
+ * by Validates, TableScans, IndexScans, and PrimaryKeyLookups. Returns nullptr for all other operators.
+ */
+std::shared_ptr<TableStatistics> estimate_filtered_table_statistics(const AbstractOperator& op) {
+  if (const auto get_table = dynamic_cast<const GetTable*>(&op)) {
+    if (!StorageManager::get().has_table(get_table->table_name())) return nullptr;
+    return StorageManager::get().get_table(get_table->table_name())->table_statistics();
+  }
+
+  const auto table_scan = dynamic_cast<const TableScan*>(&op);
+  const auto index_scan = dynamic_cast<const IndexScan*>(&op);
+  const auto primary_key_lookup = dynamic_cast<const PrimaryKeyLookup*>(&op);
+  const auto validate = dynamic_cast<const Validate*>(&op);
+  if (!table_scan && !index_scan && !primary_key_lookup && !validate) return nullptr;
+
+  auto statistics = estimate_filtered_table_statistics(*op.input_left());
+  if (!statistics || validate) return statistics;
+
+  if (table_scan) {
+    return statistics->predicate_statistics(table_scan->left_column_id(), table_scan->predicate_condition(),
+                                            table_scan->right_parameter());
+  }
+
+  if (primary_key_lookup) {
+    return statistics->predicate_statistics(primary_key_lookup->column_id(), PredicateCondition::Equals,
+                                            primary_key_lookup->value());
+  }
+
+  // A multi-column index is probed with one value per column
+  const auto& right_values2 = index_scan->right_values2();
+  for (auto column_idx = size_t{0}; column_idx < index_scan->left_column_ids().size(); ++column_idx) {
+    const auto value2 = column_idx < right_values2.size() ? std::optional<AllTypeVariant>{right_values2[column_idx]}
+                                                          : std::nullopt;
+    statistics = statistics->predicate_statistics(index_scan->left_column_ids()[column_idx],
+                                                  index_scan->predicate_condition(),
+                                                  index_scan->right_values()[column_idx], value2);
+  }
+  return statistics;
+}
+
+// Adds the estimated number of stored rows that op and its inputs process to row_count
+void add_estimated_row_count(const AbstractOperator& op, std::unordered_set<const AbstractOperator*>& visited_ops,
+                             float& row_count) {
+  if (!visited_ops.emplace(&op).second) return;
+
+  if (const auto statistics = estimate_filtered_table_statistics(op)) {
+    // Operators above the filters process the filtered rows only. The filters themselves are not visited again.
+    row_count += statistics->row_count();
+    for (auto input = op.input_left(); input; input = input->input_left()) {
+      visited_ops.emplace(input.get());
+    }
+    return;
+  }
+
+  if (op.input_left()) add_estimated_row_count(*op.input_left(), visited_ops, row_count);
+  if (op.input_right()) add_estimated_row_count(*op.input_right(), visited_ops, row_count);
+}
+
+}  // namespace
+
+namespace opossum {
+
+AdmissionControl& AdmissionControl::get() {
+  static AdmissionControl instance;
+  return instance;
+}
+
+void AdmissionControl::reset() {
+  auto& admission_control = get();
+  std::lock_guard<std::mutex> lock(admission_control._mutex);
+
+  DebugAssert(admission_control._admitted_heavy_query_count == 0, "Cannot reset while heavy queries are executed");
+
+  admission_control._max_concurrent_heavy_queries = DEFAULT_MAX_CONCURRENT_HEAVY_QUERIES;
+  admission_control._heavy_query_row_count = DEFAULT_HEAVY_QUERY_ROW_COUNT;
+}
+
+size_t AdmissionControl::max_concurrent_heavy_queries() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _max_concurrent_heavy_queries;
+}
+
+void AdmissionControl::set_max_concurrent_heavy_queries(const size_t max_concurrent_heavy_queries) {
+  Assert(max_concurrent_heavy_queries > 0, "At least one heavy query has to be admitted");
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_concurrent_heavy_queries = max_concurrent_heavy_queries;
+  }
+
+  // Waiting queries might be admitted now
+  _admission_condition_variable.notify_all();
+}
+
+uint64_t AdmissionControl::heavy_query_row_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _heavy_query_row_count;
+}
+
+void AdmissionControl::set_heavy_query_row_count(const uint64_t heavy_query_row_count) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _heavy_query_row_count = heavy_query_row_count;
+}
+
+size_t AdmissionControl::admitted_heavy_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _admitted_heavy_query_count;
+}
+
+bool AdmissionControl::is_heavy_query(const std::vector<std::shared_ptr<OperatorTask>>& tasks) const {
+  auto row_count = 0.0f;
+  auto visited_ops = std::unordered_set<const AbstractOperator*>{};
+
+  // Consumers are ordered after their inputs (see OperatorTask::make_tasks_from_operator()). Visiting them first
+  // ensures that a filtered stored table is estimated as a whole, and not by its unfiltered GetTable. The roots of
+  // subselects are not inputs of other operators, but they are tasks of their own.
+  for (auto task_it = tasks.rbegin(); task_it != tasks.rend(); ++task_it) {
+    add_estimated_row_count(*(*task_it)->get_operator(), visited_ops, row_count);
+  }
+
+  return row_count >= static_cast<float>(heavy_query_row_count());
+}
+
+void AdmissionControl::schedule_and_wait_for_query(const std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  if (!CurrentScheduler::is_set()) {
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    return;
+  }
+
+  if (!is_heavy_query(tasks)) {
+    for (const auto& task : tasks) {
+      task->schedule(CURRENT_NODE_ID, SchedulePriority::High);
+    }
+    CurrentScheduler::wait_for_tasks(tasks);
+    return;
+  }
+
+  _admit_heavy_query();
+
+  try {
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  } catch (...) {
+    _release_heavy_query();
+    throw;
+  }
+
+  _release_heavy_query();
+}
+
+void AdmissionControl::_admit_heavy_query() {
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  const auto ticket = _next_ticket++;
+  const auto is_admitted = [&]() {
+    return ticket == _next_admitted_ticket && _admitted_heavy_query_count < _max_concurrent_heavy_queries;
+  };
+
+  if (!is_admitted()) {
+    // Let another Worker use the CPU while this one is blocked
+    if (const auto worker = Worker::get_this_thread_worker()) worker->_hand_off_active_worker_token();
+
+    _admission_condition_variable.wait(lock, is_admitted);
+  }
+
+  ++_next_admitted_ticket;
+  ++_admitted_heavy_query_count;
+
+  // The query with the next ticket might be admitted as well
+  _admission_condition_variable.notify_all();
+}
+
+void AdmissionControl::_release_heavy_query() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    DebugAssert(_admitted_heavy_query_count > 0, "No heavy query was admitted");
+    --_admitted_heavy_query_count;
+  }
+
+  _admission_condition_variable.notify_all();
+}
+
+}  // namespace opossum
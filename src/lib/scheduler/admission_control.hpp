@@ -0,0 +1,77 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorTask;
+
+/**
+ * Decides when the tasks of a query are executed, so that a few large analytical queries cannot occupy all Workers
+ * and starve the short transactional queries of other sessions.
+ *
+ * Queries are classified by the estimated number of rows they process (see is_heavy_query()). Short queries
+ * are executed right away and their tasks are scheduled with SchedulePriority::High. Of the heavy queries, at most
+ * max_concurrent_heavy_queries() are executed at the same time, the others wait until they are admitted, in the order
+ * in which they arrived. A Worker waiting for the admission of a query hands its CPU over to another Worker.
+ *
+ * Without a Scheduler, tasks are executed by the threads that schedule them and queries are not coordinated.
+ */
+class AdmissionControl final : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_MAX_CONCURRENT_HEAVY_QUERIES = size_t{2};
+  static constexpr auto DEFAULT_HEAVY_QUERY_ROW_COUNT = uint64_t{1'000'000};
+
+  static AdmissionControl& get();
+
+  // Restores the default settings, must not be called while queries are executed
+  static void reset();
+
+  size_t max_concurrent_heavy_queries() const;
+  void set_max_concurrent_heavy_queries(const size_t max_concurrent_heavy_queries);
+
+  // Queries that are estimated to process at least this many rows of stored tables are heavy
+  uint64_t heavy_query_row_count() const;
+  void set_heavy_query_row_count(const uint64_t heavy_query_row_count);
+
+  size_t admitted_heavy_query_count() const;
+
+  /**
+   * Estimates the rows of stored tables that the query processes after the predicates on them (TableScans, IndexScans,
+   * and PrimaryKeyLookups) have been applied, using the optimizer's statistics. Thus, a point query on a large table
+   * is short, while a query that aggregates most of a table is heavy.
+   */
+  bool is_heavy_query(const std::vector<std::shared_ptr<OperatorTask>>& tasks) const;
+
+  /**
+   * Schedules the tasks of a query once it is admitted and waits for them to finish. To be used instead of
+   * CurrentScheduler::schedule_and_wait_for_tasks() for executing the tasks of a whole query.
+   */
+  void schedule_and_wait_for_query(const std::vector<std::shared_ptr<OperatorTask>>& tasks);
+
+ protected:
+  AdmissionControl() = default;
+
+  // Blocks until a heavy query can be executed
+  void _admit_heavy_query();
+  void _release_heavy_query();
+
+  mutable std::mutex _mutex;
+  std::condition_variable _admission_condition_variable;
+
+  size_t _max_concurrent_heavy_queries{DEFAULT_MAX_CONCURRENT_HEAVY_QUERIES};
+  uint64_t _heavy_query_row_count{DEFAULT_HEAVY_QUERY_ROW_COUNT};
+  size_t _admitted_heavy_query_count{0};
+
+  // Waiting heavy queries draw a ticket and are admitted in ticket order
+  uint64_t _next_ticket{0};
+  uint64_t _next_admitted_ticket{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#include "cancellation_token.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+#include "abstract_task.hpp"
+
+namespace {
+
+int64_t steady_clock_nanoseconds() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+}  // namespace
+
+namespace opossum {
+
+void CancellationToken::cancel() { _cancelled = true; }
+
+void CancellationToken::cancel_after(std::chrono::milliseconds timeout) {
+  const auto timeout_nanoseconds = std::chrono::nanoseconds{std::min(timeout, MAX_TIMEOUT)}.count();
+
+  // Avoid 0, which means that there is no deadline
+  _deadline = std::max(steady_clock_nanoseconds() + timeout_nanoseconds, int64_t{1});
+}
+
+bool CancellationToken::is_cancelled() const {
+  if (_cancelled) return true;
+
+  const auto deadline = _deadline.load();
+  return deadline != 0 && steady_clock_nanoseconds() >= deadline;
+}
+
+void CancellationToken::check() const {
+  if (_cancelled) throw QueryCancelledException("Query was cancelled");
+
+  const auto deadline = _deadline.load();
+  if (deadline != 0 && steady_clock_nanoseconds() >= deadline) {
+    throw QueryCancelledException("Query was cancelled because it exceeded the statement timeout");
+  }
+}
+
+void CancellationToken::check_this_thread() {
+  const auto& cancellation_token = AbstractTask::this_thread_cancellation_token();
+  if (cancellation_token) cancellation_token->check();
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Thrown by CancellationToken::check() if the query was cancelled or exceeded its timeout. Within a Task, the
+ * exception ends the execution of the Task (see AbstractTask::execute()); it is rethrown to the client by the
+ * SQLPipelineStatement.
+ */
+class QueryCancelledException : public std::runtime_error {
+ public:
+  explicit QueryCancelledException(const std::string& what) : std::runtime_error(what) {}
+};
+
+/**
+ * Cooperative cancellation of a query. The token is shared by all Tasks of a query: The SQLPipelineStatement sets it
+ * on the OperatorTasks and every Task scheduled while executing a Task inherits its token, e.g., the jobs of an
+ * operator.
+ *
+ * Nothing is interrupted forcefully. Instead,
+ *   - Tasks of a cancelled query are not started (their successors are still notified, so waiting for them works),
+ *   - operators check the token when they start and between chunks (parallel_for() does so for every index or
+ *     morsel) and give up by throwing a QueryCancelledException.
+ *
+ * A timeout is not enforced by a timer, but checked whenever the token is, i.e., the query is cancelled on its next
+ * check after the deadline.
+ */
+class CancellationToken final : private Noncopyable {
+ public:
+  // The deadline is stored in nanoseconds, longer timeouts are capped. Leaves room for the steady clock's current time.
+  static constexpr auto MAX_TIMEOUT =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::nanoseconds::max()) / 2;
+
+  void cancel();
+
+  // Cancels the query once timeout has passed from now on
+  void cancel_after(std::chrono::milliseconds timeout);
+
+  bool is_cancelled() const;
+
+  // Throws a QueryCancelledException if the query was cancelled
+  void check() const;
+
+  // Checks the token of the Task executing on the calling thread, if any
+  static void check_this_thread();
+
+ private:
+  std::atomic_bool _cancelled{false};
+
+  // Nanoseconds since the epoch of the steady clock, 0 if there is no timeout
+  std::atomic<int64_t> _deadline{0};
+};
+
+}  // namespace opossum
@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "cancellation_token.hpp"
 #include "utils/assert.hpp"
 #include "worker.hpp"
 
@@ -63,6 +64,9 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
   } else {
     for (auto& task : tasks) task->join();
   }
+
+  // Tasks of a cancelled query might have been skipped, so the caller must not use their results
+  CancellationToken::check_this_thread();
 }
 
 template <typename TaskType>
@@ -9,12 +9,22 @@
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
 #include "processing_unit.hpp"
+#include "scheduler_tracer.hpp"
 #include "task_queue.hpp"
 #include "topology.hpp"
+#include "worker.hpp"
 
 #include "uid_allocator.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// Parked workers are woken up when tasks are scheduled. The timeout only bounds the delay of tasks that did not wake
+// up a worker, e.g., Unstealable tasks for a node whose workers are parked while a worker of another node spins.
+constexpr auto PARK_TIMEOUT = std::chrono::milliseconds{50};
+
+}  // namespace
+
 namespace opossum {
 
 NodeQueueScheduler::NodeQueueScheduler(std::shared_ptr<Topology> topology) : AbstractScheduler(topology) {
@@ -67,11 +77,15 @@ void NodeQueueScheduler::finish() {
     std::this_thread::sleep_for(std::chrono::milliseconds(10));
   }
 
-  // All queues SHOULD be empty by now
+  // All queues and deques SHOULD be empty by now
   if (IS_DEBUG) {
     for ([[gnu::unused]] auto& queue : _queues) {
       DebugAssert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for ([[gnu::unused]] auto& processing_unit : _processing_units) {
+      DebugAssert(processing_unit->deques_empty(),
+                  "NodeQueueScheduler bug: Deque wasn't empty even though all tasks finished");
+    }
   }
 
   for (auto& processing_unit : _processing_units) {
@@ -85,16 +99,22 @@ void NodeQueueScheduler::finish() {
   _processing_units = {};
   _queues = {};
   _task_counter = 0;
+  _num_spinning_workers = 0;
+  _num_parked_workers = 0;
 
   _shut_down = true;
 }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<ProcessingUnit>>& NodeQueueScheduler::processing_units() const {
+  return _processing_units;
+}
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
-   * Add task to the queue of the preferred node.
+   * Add task to the deque of the current worker or to the queue of the preferred node.
    */
   DebugAssert((!_shut_down), "Can't schedule more tasks after the NodeQueueScheduler was shut down");
   DebugAssert((task->is_scheduled()), "Don't call NodeQueueScheduler::schedule(), call schedule() on the task");
@@ -104,9 +124,21 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
+  SchedulerTracer::on_task_enqueued(*task);
+
+  auto worker = Worker::get_this_thread_worker();
+
+  // Tasks scheduled by a worker stay with it (unless they are meant for another node, should be executed before other
+  // work, or belong to a session, see FAIR SHARE in the header) and can be stolen from there.
+  if (worker && priority == SchedulePriority::Normal && task->session_id() == INVALID_SESSION_ID &&
+      (preferred_node_id == CURRENT_NODE_ID || preferred_node_id == worker->queue()->node_id())) {
+    worker->deque().push(std::move(task));
+    _wake_idle_worker(worker->queue()->node_id());
+    return;
+  }
+
   // Lookup node id for current worker.
   if (preferred_node_id == CURRENT_NODE_ID) {
-    auto worker = Worker::get_this_thread_worker();
     if (worker) {
       preferred_node_id = worker->queue()->node_id();
     } else {
@@ -120,5 +152,55 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   auto queue = _queues[preferred_node_id];
   queue->push(std::move(task), static_cast<uint32_t>(priority));
+  _wake_idle_worker(preferred_node_id);
+}
+
+size_t NodeQueueScheduler::num_parked_workers() const { return _num_parked_workers; }
+
+void NodeQueueScheduler::_wake_idle_worker(const NodeID node_id) {
+  // Pairs with the fence in _park_worker(): Either the parking worker sees the new task or this sees the worker
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (_num_spinning_workers > 0 || _num_parked_workers == 0) return;
+
+  // The woken up worker counts as spinning right away, so that concurrently scheduled tasks do not wake up more
+  auto expected_spinning_workers = 0u;
+  if (!_num_spinning_workers.compare_exchange_strong(expected_spinning_workers, 1u)) return;
+
+  for (const auto& processing_unit : _processing_units) {
+    if (processing_unit->node_id() == node_id && processing_unit->unpark()) return;
+  }
+  for (const auto& processing_unit : _processing_units) {
+    if (processing_unit->node_id() != node_id && processing_unit->unpark()) return;
+  }
+
+  --_num_spinning_workers;
+}
+
+bool NodeQueueScheduler::_park_worker(ProcessingUnit& processing_unit) {
+  processing_unit.mark_as_parked();
+  ++_num_parked_workers;
+
+  // Tasks that were added before the worker was counted as parked did not wake it up, so check for them once more
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto woken_up = false;
+  if (_work_available()) {
+    // If unparking fails, _wake_idle_worker() was faster
+    woken_up = !processing_unit.unpark();
+  } else {
+    woken_up = processing_unit.wait_until_unparked(PARK_TIMEOUT);
+  }
+
+  --_num_parked_workers;
+  return woken_up;
+}
+
+bool NodeQueueScheduler::_work_available() const {
+  for (const auto& queue : _queues) {
+    if (!queue->empty()) return true;
+  }
+  for (const auto& processing_unit : _processing_units) {
+    if (!processing_unit->deques_empty()) return true;
+  }
+  return false;
 }
 }  // namespace opossum
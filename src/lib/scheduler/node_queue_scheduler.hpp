@@ -56,18 +56,43 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
+ * Work stealing is useful to avoid idle workers (and therefore idle CPUs) while there are still tasks in the system
+ * that need to be processed.
+ * The TaskQueue of a node only receives tasks that are scheduled from outside of the workers (e.g., the operator tasks
+ * of a query), for an explicitly chosen node, with high priority, or that belong to a session (see below). Other tasks
+ * that a worker schedules itself, i.e., the jobs of the task it is executing and the successors that become ready when
+ * it finishes a task, are pushed to the worker's own TaskDeque.
+ * The worker takes them from there in LIFO order, so that it continues with the work whose data is most likely still
+ * in its cache. This also avoids that all workers of a node contend on the node's TaskQueue for fine-grained jobs.
+ * A worker gets idle if neither its TaskDeque nor the TaskQueue of its node contain a ready task. It then steals the
+ * oldest task (FIFO) from the TaskDeques of the other workers of its node - starting with those of its own CPU, which
+ * are usually waiting for the jobs they scheduled.
+ * Only if there is no local work either, the worker checks remote queues and deques. Checking them means accessing
  * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
  * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ *
+ *
+ * FAIR SHARE AND ADMISSION CONTROL
+ *
+ * Tasks belong to a session (see AbstractTask::session_id()), e.g., a connection of the server. The Normal tasks in a
+ * TaskQueue are served round-robin over their sessions, and workers check the TaskQueue of their node before their
+ * own TaskDeque. TaskDeques do not know about sessions, so the jobs and successors of tasks that belong to a session
+ * go to the TaskQueue as well, at the cost of the cache locality of LIFO execution. Otherwise, a large query would
+ * fill all TaskDeques and the other sessions would only get a worker for the tasks that start their queries. Tasks
+ * without a session, e.g., those of the SQL pipeline outside of the server, stay in the TaskDeques. Short queries
+ * schedule their tasks with SchedulePriority::High, so that they are executed before all other work, while the number
+ * of concurrently executed heavy queries is limited (see AdmissionControl).
+ *
+ * IDLE WORKERS
+ *
+ * An active worker that does not find a task spins for a while, i.e., keeps looking for tasks with exponential
+ * backoff between the attempts. If it finds none, it parks: It sleeps on a condition variable while keeping the
+ * active worker token of its processing unit. Thus, an idle server does not burn CPU time. The number of attempts
+ * adapts to the load: It grows when spinning was successful and shrinks when the worker had to park.
+ * When a task is scheduled while no worker is spinning, one parked worker is woken up. It counts as spinning, so that
+ * a burst of tasks does not wake up all workers at once. Instead, a spinning worker that finds a task wakes up the
+ * next one if it was the last spinning worker or if there is more work in its queue or deque. This way, the number of
+ * running workers follows the number of available tasks.
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -81,6 +106,8 @@ class UidAllocator;
  * Schedules Tasks
  */
 class NodeQueueScheduler : public AbstractScheduler {
+  friend class Worker;
+
  public:
   explicit NodeQueueScheduler(std::shared_ptr<Topology> setup);
   ~NodeQueueScheduler();
@@ -95,20 +122,50 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<ProcessingUnit>>& processing_units() const;
+
   /**
    * @param task
-   * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
-   * @param priority Determines whether tasks are inserted at the beginning or end of the queue.
+   * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later.
+   *                          If called from a Worker with CURRENT_NODE_ID or the Worker's node, the Task is added to
+   *                          the Worker's TaskDeque instead of the node's TaskQueue.
+   * @param priority Determines the level of the node's TaskQueue the task is added to. High priority and Unstealable
+   *                 tasks are always added to the node's TaskQueue.
    */
   void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
                 SchedulePriority priority = SchedulePriority::Normal) override;
 
+  /**
+   * Number of processing units whose active worker is parked (see IDLE WORKERS above)
+   */
+  size_t num_parked_workers() const;
+
  private:
+  /**
+   * Wakes up a parked worker, preferably one of the node, unless a worker is spinning already
+   */
+  void _wake_idle_worker(NodeID node_id);
+
+  /**
+   * Parks the active worker of processing_unit. Returns whether it was woken up by _wake_idle_worker(), in which case
+   * it counts as spinning.
+   */
+  bool _park_worker(ProcessingUnit& processing_unit);
+
+  /**
+   * Returns whether any TaskQueue or TaskDeque holds a task
+   */
+  bool _work_available() const;
+
+
   std::atomic<TaskID> _task_counter{TaskID{0}};
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   std::vector<std::shared_ptr<TaskQueue>> _queues;
   std::vector<std::shared_ptr<ProcessingUnit>> _processing_units;
   std::atomic_bool _shut_down{false};
+
+  std::atomic_uint _num_spinning_workers{0};
+  std::atomic_uint _num_parked_workers{0};
 };
 
 }  // namespace opossum
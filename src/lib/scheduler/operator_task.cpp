@@ -1,6 +1,10 @@
 #include "operator_task.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -8,45 +12,161 @@
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/operator_pipeline.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection.hpp"
 
 #include "scheduler/job_task.hpp"
 #include "scheduler/processing_unit.hpp"
 #include "scheduler/worker.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The root operators of the subselects of a Projection that have not been executed yet. They do not depend on the
+// input of the Projection (subselects are uncorrelated), so they are executed by tasks of their own.
+std::vector<std::shared_ptr<AbstractOperator>> pending_subselects(const std::shared_ptr<AbstractOperator>& op) {
+  auto subselects = std::vector<std::shared_ptr<AbstractOperator>>{};
+
+  const auto projection = std::dynamic_pointer_cast<Projection>(op);
+  if (!projection) return subselects;
+
+  for (const auto& column_expression : projection->column_expressions()) {
+    if (!column_expression->is_subselect() || column_expression->has_subselect_table()) continue;
+    if (column_expression->subselect_operator()->get_output()) continue;
+    subselects.emplace_back(column_expression->subselect_operator());
+  }
+
+  return subselects;
+}
+
+// Counts the consumers of each operator of the PQP. Each operator is visited once, also in diamond shapes.
+void count_consumers(const std::shared_ptr<AbstractOperator>& op,
+                     std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_count,
+                     std::unordered_set<std::shared_ptr<AbstractOperator>>& visited_ops) {
+  if (!visited_ops.emplace(op).second) return;
+
+  for (const auto& input : {op->mutable_input_left(), op->mutable_input_right()}) {
+    if (!input) continue;
+    ++consumer_count[input];
+    count_consumers(input, consumer_count, visited_ops);
+  }
+
+  for (const auto& subselect : pending_subselects(op)) {
+    count_consumers(subselect, consumer_count, visited_ops);
+  }
+}
+
+/**
+ * Orders the tasks by the length of their critical path, i.e., the longest chain of operators from the task to the
+ * root. As a task's critical path is longer than those of its successors, the order stays topological.
+ * All ready tasks are scheduled at once (see make_tasks_from_operator()), and the queues hand them to the workers in
+ * this order. Thus, the subtree that takes the longest to reach the root is started first, instead of, e.g., the left
+ * input of a join only because it was added first.
+ */
+void order_by_critical_path(std::vector<std::shared_ptr<OperatorTask>>& tasks) {
+  std::unordered_map<const AbstractTask*, size_t> critical_path_length;
+
+  // Successors come after their predecessors, so walk back from the root
+  for (auto task_it = tasks.rbegin(); task_it != tasks.rend(); ++task_it) {
+    const auto& task = *task_it;
+
+    auto successor_path_length = size_t{0};
+    for (const auto& successor : task->successors()) {
+      successor_path_length = std::max(successor_path_length, critical_path_length[successor.get()]);
+    }
+
+    const auto& pipeline = task->get_pipeline();
+    critical_path_length[task.get()] = successor_path_length + (pipeline ? pipeline->operators().size() : 1);
+  }
+
+  std::stable_sort(tasks.begin(), tasks.end(), [&](const auto& lhs, const auto& rhs) {
+    return critical_path_length.at(lhs.get()) > critical_path_length.at(rhs.get());
+  });
+}
+
+}  // namespace
+
 namespace opossum {
 OperatorTask::OperatorTask(std::shared_ptr<AbstractOperator> op) : _op(std::move(op)) {}
 
+OperatorTask::OperatorTask(std::shared_ptr<OperatorPipeline> pipeline)
+    : _op(pipeline->operators().back()), _pipeline(std::move(pipeline)) {}
+
 std::string OperatorTask::description() const {
-  return "OperatorTask with id: " + std::to_string(id()) + " for op: " + _op->description();
+  return "OperatorTask with id: " + std::to_string(id()) +
+         " for op: " + (_pipeline ? _pipeline->description() : _op->description());
 }
 
 const std::vector<std::shared_ptr<OperatorTask>> OperatorTask::make_tasks_from_operator(
-    std::shared_ptr<AbstractOperator> op) {
+    std::shared_ptr<AbstractOperator> op, const UsePipelining use_pipelining) {
   std::vector<std::shared_ptr<OperatorTask>> tasks;
   std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>> task_by_op;
-  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op);
+
+  // An operator with more than one consumer cannot be pipelined, as all consumers need its whole output
+  std::unordered_map<std::shared_ptr<AbstractOperator>, size_t> consumer_count;
+  if (use_pipelining == UsePipelining::Yes) {
+    std::unordered_set<std::shared_ptr<AbstractOperator>> visited_ops;
+    count_consumers(op, consumer_count, visited_ops);
+  }
+
+  OperatorTask::_add_tasks_from_operator(op, tasks, task_by_op, consumer_count);
+  order_by_critical_path(tasks);
   return tasks;
 }
 
 std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
     std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
-    std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op) {
+    std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+    const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_count) {
   const auto task_by_op_it = task_by_op.find(op);
   if (task_by_op_it != task_by_op.end()) return task_by_op_it->second;
 
-  const auto task = std::make_shared<OperatorTask>(op);
+  // Extend the pipeline ending in op downwards as long as the inputs are chunk-wise and only consumed by the pipeline
+  auto pipelined_ops = std::vector<std::shared_ptr<AbstractOperator>>{op};
+  if (op->is_chunkwise()) {
+    while (true) {
+      const auto input = pipelined_ops.front()->mutable_input_left();
+      if (!input || !input->is_chunkwise()) break;
+
+      const auto consumer_count_it = consumer_count.find(input);
+      if (consumer_count_it == consumer_count.end() || consumer_count_it->second != 1) break;
+
+      pipelined_ops.insert(pipelined_ops.begin(), input);
+    }
+  }
+
+  const auto task = pipelined_ops.size() > 1
+                        ? std::make_shared<OperatorTask>(std::make_shared<OperatorPipeline>(pipelined_ops))
+                        : std::make_shared<OperatorTask>(op);
   task_by_op.emplace(op, task);
 
-  if (auto left = op->mutable_input_left()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op);
+  // The inputs of a pipeline are the inputs of its first operator
+  const auto& first_op = pipelined_ops.front();
+
+  if (auto left = first_op->mutable_input_left()) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(left, tasks, task_by_op, consumer_count);
     subtree_root->set_as_predecessor_of(task);
   }
 
-  if (auto right = op->mutable_input_right()) {
-    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op);
+  if (auto right = first_op->mutable_input_right()) {
+    auto subtree_root = OperatorTask::_add_tasks_from_operator(right, tasks, task_by_op, consumer_count);
     subtree_root->set_as_predecessor_of(task);
   }
 
+  // Subselects are executed concurrently to the inputs and before the Projection that uses their result
+  for (const auto& pipelined_op : pipelined_ops) {
+    for (const auto& subselect : pending_subselects(pipelined_op)) {
+      if (pipelined_op->transaction_context_is_set() && !subselect->transaction_context_is_set()) {
+        subselect->set_transaction_context_recursively(pipelined_op->transaction_context());
+      }
+
+      auto subtree_root = OperatorTask::_add_tasks_from_operator(subselect, tasks, task_by_op, consumer_count);
+      subtree_root->set_as_predecessor_of(task);
+    }
+  }
+
   // Add AFTER the inputs to establish a task order where predecessor get executed before successors
   tasks.push_back(task);
 
@@ -55,6 +175,8 @@ std::shared_ptr<OperatorTask> OperatorTask::_add_tasks_from_operator(
 
 const std::shared_ptr<AbstractOperator>& OperatorTask::get_operator() const { return _op; }
 
+const std::shared_ptr<OperatorPipeline>& OperatorTask::get_pipeline() const { return _pipeline; }
+
 void OperatorTask::_on_execute() {
   auto context = _op->transaction_context();
   if (context) {
@@ -79,7 +201,11 @@ void OperatorTask::_on_execute() {
     }
   }
 
-  _op->execute();
+  if (_pipeline) {
+    _pipeline->execute();
+  } else {
+    _op->execute();
+  }
 
   /**
    * Check whether the operator is a ReadWrite operator, and if it is, whether it failed.
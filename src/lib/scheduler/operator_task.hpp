@@ -5,10 +5,12 @@
 #include <unordered_map>
 
 #include "scheduler/abstract_task.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
+class OperatorPipeline;
 
 /**
  * Makes an AbstractOperator scheduleable
@@ -17,14 +19,25 @@ class OperatorTask : public AbstractTask {
  public:
   explicit OperatorTask(std::shared_ptr<AbstractOperator> op);
 
+  // Creates a task that executes the pipeline, whose last operator is the task's operator
+  explicit OperatorTask(std::shared_ptr<OperatorPipeline> pipeline);
+
   /**
    * Create tasks recursively from result operator and set task dependencies automatically.
+   * With pipelining, chains of chunk-wise operators are executed by a single task each, see OperatorPipeline.
+   * The subselects of Projections get tasks of their own that precede the Projection's task, so that independent
+   * subtrees (join inputs, union branches, subselects) can all run concurrently.
+   * The tasks are ordered topologically, longest critical path first, i.e., scheduling them in order starts the
+   * subtrees that take longest to reach the result first. The result operator's task is the last one.
    */
   static const std::vector<std::shared_ptr<OperatorTask>> make_tasks_from_operator(
-      std::shared_ptr<AbstractOperator> op);
+      std::shared_ptr<AbstractOperator> op, const UsePipelining use_pipelining = UsePipelining::No);
 
   const std::shared_ptr<AbstractOperator>& get_operator() const;
 
+  // The pipeline executed by this task, or nullptr
+  const std::shared_ptr<OperatorPipeline>& get_pipeline() const;
+
   std::string description() const override;
 
  protected:
@@ -32,13 +45,16 @@ class OperatorTask : public AbstractTask {
 
   /**
    * Create tasks recursively. Called by `make_tasks_from_operator`. Returns the root of the subtree that was added.
-   * @param task_by_op  Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param task_by_op      Cache to avoid creating duplicate Tasks for diamond shapes
+   * @param consumer_count  Number of consumers of each operator if pipelining is used, empty otherwise
    */
   static std::shared_ptr<OperatorTask> _add_tasks_from_operator(
       std::shared_ptr<AbstractOperator> op, std::vector<std::shared_ptr<OperatorTask>>& tasks,
-      std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op);
+      std::unordered_map<std::shared_ptr<AbstractOperator>, std::shared_ptr<OperatorTask>>& task_by_op,
+      const std::unordered_map<std::shared_ptr<AbstractOperator>, size_t>& consumer_count);
 
  private:
   std::shared_ptr<AbstractOperator> _op;
+  std::shared_ptr<OperatorPipeline> _pipeline;
 };
 }  // namespace opossum
@@ -0,0 +1,240 @@
+#include "parallel_for.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+#include "cancellation_token.hpp"
+#include "current_scheduler.hpp"
+#include "job_task.hpp"
+#include "topology.hpp"
+
+namespace {
+
+// Morsels are sized so that processing one of them takes about this long: Long enough to amortize claiming it and
+// creating its output, short enough to balance the load between the workers.
+constexpr auto TARGET_MORSEL_NANOSECONDS = 1'000'000.0;
+
+// Size of the morsels until the first one has been measured, and lower bound of the adaptive size
+constexpr auto MIN_MORSEL_SIZE = size_t{10'000};
+
+/**
+ * Shared by the calling thread and the helper tasks of a parallel loop. Owned via shared_ptr, as helpers that get to
+ * run only after the loop finished still access it - but never the functor, which might have gone out of scope by then.
+ * Sub classes implement process(), which claims and processes work until there is none left or the loop is stopped.
+ */
+struct ParallelLoopState {
+  // Stops the loop and keeps the first exception thrown by any of its threads
+  void fail(std::exception_ptr exception_ptr) {
+    std::lock_guard<std::mutex> lock(exception_mutex);
+    if (!exception) exception = std::move(exception_ptr);
+    stopped = true;
+  }
+
+  std::atomic<size_t> active_helper_count{0};
+  std::atomic_bool stopped{false};
+
+  std::mutex exception_mutex;
+  std::exception_ptr exception;
+};
+
+struct ParallelForState : ParallelLoopState {
+  ParallelForState(size_t size, const std::function<void(size_t)>& functor) : size(size), functor(functor) {}
+
+  void process() {
+    while (!stopped) {
+      const auto offset = next_offset++;
+      if (offset >= size) return;
+      opossum::CancellationToken::check_this_thread();
+      functor(offset);
+    }
+  }
+
+  const size_t size;
+  const std::function<void(size_t)>& functor;
+
+  std::atomic<size_t> next_offset{0};
+};
+
+struct ParallelMorselState : ParallelLoopState {
+  ParallelMorselState(std::vector<size_t> unit_begins, bool split_units, size_t worker_count,
+                      const std::function<void(size_t, size_t, size_t)>& functor)
+      : unit_begins(std::move(unit_begins)),
+        row_count(this->unit_begins.back()),
+        split_units(split_units),
+        worker_count(worker_count),
+        functor(functor) {}
+
+  void process() {
+    while (!stopped) {
+      auto begin = next_row.load();
+      auto end = size_t{0};
+      do {
+        if (begin >= row_count) return;
+        end = morsel_end(begin);
+      } while (!next_row.compare_exchange_weak(begin, end));
+
+      opossum::CancellationToken::check_this_thread();
+
+      const auto start_time = std::chrono::steady_clock::now();
+
+      for (auto unit = unit_of(begin); unit_begins[unit] < end; ++unit) {
+        const auto unit_begin = unit_begins[unit];
+        const auto unit_end = unit_begins[unit + 1];
+        if (unit_begin == unit_end) continue;
+
+        functor(unit, std::max(begin, unit_begin) - unit_begin, std::min(end, unit_end) - unit_begin);
+      }
+
+      const auto nanoseconds =
+          std::chrono::duration<double, std::nano>{std::chrono::steady_clock::now() - start_time}.count();
+      const auto sample = nanoseconds / static_cast<double>(end - begin);
+
+      // Concurrent updates of the estimate might get lost, which only delays its adaptation
+      const auto previous_estimate = nanoseconds_per_row.load();
+      nanoseconds_per_row = previous_estimate > 0.0 ? 0.75 * previous_estimate + 0.25 * sample : sample;
+    }
+  }
+
+  // Returns the unit that contains the row. Empty units are skipped, as they share their begin with the next unit.
+  size_t unit_of(size_t row) const {
+    return std::upper_bound(unit_begins.cbegin(), unit_begins.cend(), row) - unit_begins.cbegin() - 1;
+  }
+
+  size_t morsel_end(size_t begin) const {
+    const auto remaining_rows = row_count - begin;
+
+    auto morsel_size = MIN_MORSEL_SIZE;
+    const auto estimate = nanoseconds_per_row.load();
+    if (estimate > 0.0) {
+      morsel_size = std::max(static_cast<size_t>(TARGET_MORSEL_NANOSECONDS / estimate), MIN_MORSEL_SIZE);
+    }
+
+    // Towards the end, morsels shrink so that the workers finish at about the same time
+    morsel_size = std::min(morsel_size, std::max(remaining_rows / worker_count, MIN_MORSEL_SIZE));
+
+    if (morsel_size >= remaining_rows) return row_count;
+
+    const auto end = begin + morsel_size;
+    const auto end_unit = unit_of(end);
+    if (unit_begins[end_unit] == end) return end;
+
+    // Morsels either consist of whole units or lie within a single unit, so that units are not split needlessly.
+    // If units must not be split at all, the morsel is extended to the end of the unit.
+    if (!split_units) return unit_begins[end_unit + 1];
+    return end_unit == unit_of(begin) ? end : unit_begins[end_unit];
+  }
+
+  // Offsets of the first row of each unit within all rows, followed by the total number of rows
+  const std::vector<size_t> unit_begins;
+  const size_t row_count;
+  const bool split_units;
+  const size_t worker_count;
+  const std::function<void(size_t, size_t, size_t)>& functor;
+
+  std::atomic<size_t> next_row{0};
+  std::atomic<double> nanoseconds_per_row{0.0};
+};
+
+/**
+ * Calls state->process() from the calling thread and from helper_count JobTasks and returns once all of them are
+ * finished. The first exception thrown by any of them stops the loop and is rethrown by the calling thread after the
+ * helpers stopped.
+ */
+template <typename State>
+void run_parallel_loop(const std::shared_ptr<State>& state, const size_t helper_count) {
+  for (auto helper_id = size_t{0}; helper_id < helper_count; ++helper_id) {
+    std::make_shared<opossum::JobTask>([state]() {
+      // Registering as active before checking whether the loop was stopped makes sure that the calling thread either
+      // waits for this helper or that this helper does not touch the functor anymore.
+      ++state->active_helper_count;
+      try {
+        state->process();
+      } catch (...) {
+        state->fail(std::current_exception());
+      }
+      --state->active_helper_count;
+    })->schedule();
+  }
+
+  try {
+    state->process();
+  } catch (...) {
+    state->fail(std::current_exception());
+  }
+
+  // All work has been claimed (or an exception occurred). Wait for the calls the helpers are still executing.
+  state->stopped = true;
+  while (state->active_helper_count > 0) {
+    std::this_thread::yield();
+  }
+
+  // The helpers are done, so the exception is not written anymore
+  if (state->exception) std::rethrow_exception(state->exception);
+
+  // The helpers inherited the token of the calling thread. Do not return if they stopped because of it.
+  opossum::CancellationToken::check_this_thread();
+}
+
+// Returns the number of helper tasks worth scheduling for a loop of at most max_parallelism concurrent calls
+size_t helper_count_for(const size_t max_parallelism) {
+  const auto& scheduler = opossum::CurrentScheduler::get();
+  if (!scheduler || max_parallelism == 0) return 0;
+  return std::min(max_parallelism, scheduler->topology()->num_cpus()) - 1;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void parallel_for_offsets(const size_t size, const std::function<void(size_t)>& functor) {
+  const auto helper_count = helper_count_for(size);
+
+  if (helper_count == 0) {
+    for (auto offset = size_t{0}; offset < size; ++offset) {
+      CancellationToken::check_this_thread();
+      functor(offset);
+    }
+    return;
+  }
+
+  run_parallel_loop(std::make_shared<ParallelForState>(size, functor), helper_count);
+}
+
+void parallel_for_morsels(const std::vector<size_t>& unit_sizes, const bool split_units,
+                          const std::function<void(size_t, size_t, size_t)>& functor) {
+  auto unit_begins = std::vector<size_t>(unit_sizes.size() + 1);
+  auto non_empty_unit_count = size_t{0};
+  for (auto unit = size_t{0}; unit < unit_sizes.size(); ++unit) {
+    unit_begins[unit + 1] = unit_begins[unit] + unit_sizes[unit];
+    if (unit_sizes[unit] > 0) ++non_empty_unit_count;
+  }
+
+  const auto row_count = unit_begins.back();
+  const auto max_morsel_count =
+      split_units ? (row_count + MIN_MORSEL_SIZE - 1) / MIN_MORSEL_SIZE : non_empty_unit_count;
+  const auto helper_count = helper_count_for(max_morsel_count);
+
+  if (helper_count == 0) {
+    for (auto unit = size_t{0}; unit < unit_sizes.size(); ++unit) {
+      if (unit_sizes[unit] == 0) continue;
+      CancellationToken::check_this_thread();
+      functor(unit, 0, unit_sizes[unit]);
+    }
+    return;
+  }
+
+  run_parallel_loop(
+      std::make_shared<ParallelMorselState>(std::move(unit_begins), split_units, helper_count + 1, functor),
+      helper_count);
+}
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Calls functor(index) for every index in [begin, end), in parallel if a Scheduler is active, and returns once all
+ * calls have finished. Meant for intra-operator parallelism, e.g., processing the chunks of a table:
+ *
+ *   parallel_for(ChunkID{0}, table->chunk_count(), [&](const ChunkID chunk_id) { ... });
+ *
+ * Other than scheduling one JobTask per index, this does not create a task object (with its mutex, condition variable,
+ * and successor list) per index. Instead, the indices are claimed from a shared atomic counter by the calling thread
+ * and by at most one helper task per additional CPU. Thus, the work is balanced dynamically and idle helpers return
+ * immediately. The calling thread participates in the loop and only waits (using a counter of active helpers, not a
+ * condition variable) for the calls that helpers are still executing once all indices have been claimed.
+ *
+ * The first exception thrown by a call of functor, in any thread, stops the loop and is rethrown in the calling thread
+ * once the helpers stopped. Before each call, the cancellation token of the calling Task is checked, so that loops of
+ * cancelled queries stop early by throwing a QueryCancelledException.
+ */
+template <typename Index, typename Functor>
+void parallel_for(const Index begin, const Index end, const Functor& functor);
+
+/**
+ * Non-template implementation of parallel_for(), calls functor(offset) for every offset in [0, size).
+ */
+void parallel_for_offsets(size_t size, const std::function<void(size_t)>& functor);
+
+/**
+ * Morsel-driven variant of parallel_for() for loops over the rows of a sequence of units, usually the chunks of a
+ * table. Calls functor(unit, begin, end) for the rows [begin, end) of the units, so that every row of every unit is
+ * processed exactly once, and returns once all calls have finished. Empty units are not passed to functor.
+ *
+ * Work is claimed in morsels of rows instead of in units, so that a few large chunks are still processed by all CPUs
+ * and many small chunks do not cause one claim each. A morsel either consists of one or more whole units or lies
+ * within a single unit. Units are only split if split_units is true, otherwise morsels are extended to the end of a
+ * unit - use this if the functor needs whole units, e.g., to build per-chunk data structures.
+ *
+ * The morsel size adapts to the functor: The time per row is measured for every morsel and morsels are sized so that
+ * they take about a millisecond. Towards the end of the loop, morsels shrink so that the CPUs finish at the same time.
+ * Without a Scheduler, functor is called once for each whole unit, in order.
+ */
+void parallel_for_morsels(const std::vector<size_t>& unit_sizes, bool split_units,
+                          const std::function<void(size_t, size_t, size_t)>& functor);
+
+template <typename Index, typename Functor>
+void parallel_for(const Index begin, const Index end, const Functor& functor) {
+  const auto first = static_cast<size_t>(begin);
+  const auto last = static_cast<size_t>(end);
+  if (first >= last) return;
+
+  parallel_for_offsets(last - first, [&](const size_t offset) { functor(static_cast<Index>(first + offset)); });
+}
+
+}  // namespace opossum
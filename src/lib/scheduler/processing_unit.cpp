@@ -3,6 +3,8 @@
 #include <functional>
 #include <memory>
 
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
 #include "uid_allocator.hpp"
 #include "worker.hpp"
 
@@ -16,6 +18,8 @@ namespace opossum {
 ProcessingUnit::ProcessingUnit(std::shared_ptr<TaskQueue> queue, std::shared_ptr<UidAllocator> worker_id_allocator,
                                CpuID cpu_id)
     : _queue(queue), _worker_id_allocator(worker_id_allocator), _cpu_id(cpu_id) {
+  _workers.reserve(MAX_WORKERS_PER_CORE);
+
   // Do not start worker yet, the object is still under construction and no shared_ptr of it is held right now -
   // shared_from_this will fail!
 }
@@ -59,6 +63,7 @@ void ProcessingUnit::wake_or_create_worker() {
     if (_workers.size() < MAX_WORKERS_PER_CORE) {
       auto worker = std::make_shared<Worker>(shared_from_this(), _queue, _worker_id_allocator->allocate(), _cpu_id);
       _workers.emplace_back(worker);
+      _num_workers.store(_workers.size(), std::memory_order_release);
 
       auto fn = std::bind(&Worker::operator(), worker.get());
       _threads.emplace_back(fn);
@@ -69,6 +74,33 @@ void ProcessingUnit::wake_or_create_worker() {
   }
 }
 
+void ProcessingUnit::mark_as_parked() { _parked = true; }
+
+bool ProcessingUnit::wait_until_unparked(std::chrono::milliseconds timeout) {
+  {
+    std::unique_lock<std::mutex> lock(_hibernation_mutex);
+    _park_cv.wait_for(lock, timeout, [&]() { return _shutdown_flag || !_parked; });
+  }
+
+  // If this fails, someone else unparked the Worker
+  return !unpark();
+}
+
+bool ProcessingUnit::unpark() {
+  auto expected = true;
+  if (!_parked.compare_exchange_strong(expected, false)) return false;
+
+  // Locking makes sure that the Worker either is already waiting or still has to check _parked
+  {
+    std::lock_guard<std::mutex> lock(_hibernation_mutex);
+  }
+  _park_cv.notify_one();
+
+  return true;
+}
+
+bool ProcessingUnit::is_parked() const { return _parked; }
+
 void ProcessingUnit::join() {
   for (auto& thread : _threads) {
     thread.join();
@@ -81,12 +113,32 @@ void ProcessingUnit::shutdown() {
     _shutdown_flag = true;
   }
   _hibernation_cv.notify_all();
+  _park_cv.notify_all();
 }
 
 bool ProcessingUnit::shutdown_flag() const { return _shutdown_flag; }
 
+NodeID ProcessingUnit::node_id() const { return _queue->node_id(); }
+
 void ProcessingUnit::on_worker_finished_task() { _num_finished_tasks++; }
 
 uint64_t ProcessingUnit::num_finished_tasks() const { return _num_finished_tasks; }
 
+std::shared_ptr<AbstractTask> ProcessingUnit::steal_task() {
+  const auto num_workers = _num_workers.load(std::memory_order_acquire);
+  for (auto worker_idx = size_t{0}; worker_idx < num_workers; ++worker_idx) {
+    auto task = _workers[worker_idx]->deque().steal();
+    if (task) return task;
+  }
+  return nullptr;
+}
+
+bool ProcessingUnit::deques_empty() const {
+  const auto num_workers = _num_workers.load(std::memory_order_acquire);
+  for (auto worker_idx = size_t{0}; worker_idx < num_workers; ++worker_idx) {
+    if (!_workers[worker_idx]->deque().empty()) return false;
+  }
+  return true;
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -11,6 +12,7 @@
 
 namespace opossum {
 
+class AbstractTask;
 class UidAllocator;
 class TaskQueue;
 class Worker;
@@ -25,6 +27,8 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
 
   bool shutdown_flag() const;
 
+  NodeID node_id() const;
+
   /**
    * In order to be allowed to pull new Tasks, a Worker must be the active worker, i.e. call this method with its id
    * and receive true from it.
@@ -49,12 +53,39 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
    */
   void wake_or_create_worker();
 
+  /**
+   * Parking is the idle state of the active Worker, see NodeQueueScheduler::_park_worker(). Other than hibernated
+   * Workers, the parked Worker keeps the active worker token. mark_as_parked() announces that the active Worker is
+   * about to park, wait_until_unparked() then blocks it until unpark() is called, the Scheduler shuts down, or timeout
+   * passed. It returns whether unpark() was called by someone else.
+   */
+  void mark_as_parked();
+  bool wait_until_unparked(std::chrono::milliseconds timeout);
+
+  /**
+   * Wakes up the parked Worker. Returns false if it was not parked (anymore). Can be called from any thread.
+   */
+  bool unpark();
+
+  bool is_parked() const;
+
   /**
    * Increments the local counter of finished tasks to allow the Scheduler to determine whether all tasks finished.
    * Typically called by Workers
    */
   void on_worker_finished_task();
 
+  /**
+   * Steals the oldest task from the TaskDeque of one of this ProcessingUnit's Workers. Returns nullptr if there is
+   * none. Can be called from any thread.
+   */
+  std::shared_ptr<AbstractTask> steal_task();
+
+  /**
+   * @return the TaskDeques of all Workers are empty
+   */
+  bool deques_empty() const;
+
   /**
    * To be called by the Scheduler
    */
@@ -66,14 +97,19 @@ class ProcessingUnit final : public std::enable_shared_from_this<ProcessingUnit>
   std::shared_ptr<TaskQueue> _queue;
   std::shared_ptr<UidAllocator> _worker_id_allocator;
   CpuID _cpu_id;
-  std::mutex _mutex;  // Synchronizes access to _threads, _workers
+  std::mutex _mutex;  // Synchronizes adding to _threads, _workers
   std::vector<std::thread> _threads;
+  // Reserved upfront so that _workers is never reallocated and the first _num_workers entries can be read without
+  // locking _mutex, e.g., for work stealing
   std::vector<std::shared_ptr<Worker>> _workers;
+  std::atomic<size_t> _num_workers{0};
   std::atomic_bool _shutdown_flag{false};
   std::atomic<WorkerID> _active_worker_token{INVALID_WORKER_ID};
   std::mutex _hibernation_mutex;
   std::condition_variable _hibernation_cv;
   std::atomic_uint _num_hibernated_workers{0};
+  std::atomic_bool _parked{false};
+  std::condition_variable _park_cv;  // Uses _hibernation_mutex
   std::atomic<uint64_t> _num_finished_tasks{0};
 };
 }  // namespace opossum
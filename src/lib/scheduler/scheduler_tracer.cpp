@@ -0,0 +1,252 @@
+#include "scheduler_tracer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "task_queue.hpp"
+#include "worker.hpp"
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The Chrome trace format expects microseconds. Tasks that started before the tracing are clamped to its start.
+std::string format_microseconds(const int64_t nanoseconds) {
+  const auto clamped_nanoseconds = std::max(nanoseconds, int64_t{0});
+  const auto fraction = std::to_string(clamped_nanoseconds % 1000);
+  return std::to_string(clamped_nanoseconds / 1000) + "." + std::string(3 - fraction.size(), '0') + fraction;
+}
+
+void write_json_string(std::ostream& stream, const char* string) {
+  stream << '"';
+  for (const auto* character = string; *character != '\0'; ++character) {
+    switch (*character) {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      case '\t':
+        stream << "\\t";
+        break;
+      default:
+        // Other control characters are not expected in task descriptions
+        if (static_cast<unsigned char>(*character) >= 0x20) stream << *character;
+    }
+  }
+  stream << '"';
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Ring buffer written by a single thread. Readers may see torn events if they read while the buffer is written.
+ */
+class SchedulerTracer::RingBuffer final : private Noncopyable {
+ public:
+  RingBuffer(const uint64_t generation, const size_t capacity) : generation(generation), _events(capacity) {}
+
+  void push(const SchedulerTraceEvent& event) {
+    const auto size = _size.load(std::memory_order_relaxed);
+    _events[size % _events.size()] = event;
+    _size.store(size + 1, std::memory_order_release);
+  }
+
+  void copy_to(std::vector<SchedulerTraceEvent>& events) const {
+    const auto size = _size.load(std::memory_order_acquire);
+    const auto begin = size > _events.size() ? size - _events.size() : uint64_t{0};
+    for (auto event_idx = begin; event_idx < size; ++event_idx) {
+      events.emplace_back(_events[event_idx % _events.size()]);
+    }
+  }
+
+  const uint64_t generation;
+
+ private:
+  std::vector<SchedulerTraceEvent> _events;
+  std::atomic<uint64_t> _size{0};
+};
+
+std::atomic_bool SchedulerTracer::_is_enabled{false};
+
+SchedulerTracer& SchedulerTracer::get() {
+  static SchedulerTracer instance;
+  return instance;
+}
+
+void SchedulerTracer::reset() {
+  auto& tracer = get();
+  tracer.disable();
+
+  std::lock_guard<std::mutex> lock(tracer._buffers_mutex);
+  ++tracer._generation;
+  tracer._buffers.clear();
+}
+
+void SchedulerTracer::enable(const size_t buffer_capacity) {
+  Assert(buffer_capacity > 0, "Trace buffers need a capacity");
+
+  {
+    std::lock_guard<std::mutex> lock(_buffers_mutex);
+    _buffer_capacity = buffer_capacity;
+    _start_time = now();
+    ++_generation;
+    _buffers.clear();
+  }
+
+  _is_enabled = true;
+}
+
+void SchedulerTracer::disable() { _is_enabled = false; }
+
+std::vector<SchedulerTraceEvent> SchedulerTracer::events() const {
+  std::lock_guard<std::mutex> lock(_buffers_mutex);
+
+  auto events = std::vector<SchedulerTraceEvent>{};
+  for (const auto& buffer : _buffers) {
+    buffer->copy_to(events);
+  }
+
+  return events;
+}
+
+void SchedulerTracer::export_chrome_trace(std::ostream& stream) const {
+  const auto events = this->events();
+
+  stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+  auto is_first_event = true;
+  const auto begin_event = [&]() {
+    stream << (is_first_event ? "\n" : ",\n");
+    is_first_event = false;
+  };
+
+  // Name the processes (nodes) and threads (Workers)
+  auto nodes = std::set<NodeID>{};
+  auto workers = std::set<std::pair<NodeID, WorkerID>>{};
+  for (const auto& event : events) {
+    nodes.emplace(event.node_id);
+    workers.emplace(event.node_id, event.worker_id);
+  }
+
+  for (const auto& node_id : nodes) {
+    begin_event();
+    stream << R"({"name":"process_name","ph":"M","pid":)" << node_id << R"(,"args":{"name":"Node )" << node_id
+           << "\"}}";
+  }
+
+  for (const auto& [node_id, worker_id] : workers) {
+    begin_event();
+    stream << R"({"name":"thread_name","ph":"M","pid":)" << node_id << R"(,"tid":)" << worker_id
+           << R"(,"args":{"name":"Worker )" << worker_id << "\"}}";
+  }
+
+  for (const auto& event : events) {
+    begin_event();
+    switch (event.type) {
+      case SchedulerTraceEventType::TaskExecution:
+        stream << R"({"name":)";
+        write_json_string(stream, event.description);
+        stream << R"(,"cat":"task","ph":"X","ts":)" << format_microseconds(event.start_time)
+               << R"(,"dur":)" << format_microseconds(event.end_time - event.start_time) << R"(,"pid":)"
+               << event.node_id << R"(,"tid":)" << event.worker_id << R"(,"args":{"task_id":)" << event.task_id
+               << R"(,"queue_wait_us":)" << format_microseconds(event.queue_wait) << "}}";
+        break;
+
+      case SchedulerTraceEventType::Steal:
+        stream << R"({"name":"steal","cat":"steal","ph":"i","s":"t","ts":)" << format_microseconds(event.start_time)
+               << R"(,"pid":)" << event.node_id << R"(,"tid":)" << event.worker_id << R"(,"args":{"task_id":)"
+               << event.task_id << R"(,"victim_node":)" << event.victim_node_id << R"(,"victim":")"
+               << (event.stolen_from_queue ? "queue" : "deque") << "\"}}";
+        break;
+    }
+  }
+
+  stream << "\n]}\n";
+}
+
+void SchedulerTracer::export_chrome_trace(const std::string& file_name) const {
+  std::ofstream stream(file_name);
+  Assert(stream.good(), "Cannot open trace file " + file_name);
+
+  export_chrome_trace(stream);
+}
+
+int64_t SchedulerTracer::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void SchedulerTracer::record_task_execution(const AbstractTask& task, const Worker& worker, const int64_t start_time) {
+  const auto end_time = now();
+  const auto trace_start_time = _start_time.load();
+
+  auto event = SchedulerTraceEvent{};
+  event.type = SchedulerTraceEventType::TaskExecution;
+  event.task_id = task.id();
+  event.worker_id = worker.id();
+  event.node_id = worker.queue()->node_id();
+  event.start_time = start_time - trace_start_time;
+  event.end_time = end_time - trace_start_time;
+  event.queue_wait = task._trace_enqueue_time >= trace_start_time ? start_time - task._trace_enqueue_time : 0;
+  event.victim_node_id = INVALID_NODE_ID;
+  event.stolen_from_queue = false;
+
+  const auto description = task.description();
+  const auto description_length = std::min(description.size(), sizeof(event.description) - 1);
+  description.copy(event.description, description_length);
+  event.description[description_length] = '\0';
+
+  _this_thread_buffer().push(event);
+}
+
+void SchedulerTracer::record_steal(const AbstractTask& task, const Worker& worker, const NodeID victim_node_id,
+                                   const bool stolen_from_queue) {
+  const auto time = now() - _start_time.load();
+
+  auto event = SchedulerTraceEvent{};
+  event.type = SchedulerTraceEventType::Steal;
+  event.task_id = task.id();
+  event.worker_id = worker.id();
+  event.node_id = worker.queue()->node_id();
+  event.start_time = time;
+  event.end_time = time;
+  event.queue_wait = 0;
+  event.victim_node_id = victim_node_id;
+  event.stolen_from_queue = stolen_from_queue;
+  event.description[0] = '\0';
+
+  _this_thread_buffer().push(event);
+}
+
+void SchedulerTracer::_on_task_enqueued(AbstractTask& task) { task._trace_enqueue_time = now(); }
+
+SchedulerTracer::RingBuffer& SchedulerTracer::_this_thread_buffer() {
+  static thread_local std::shared_ptr<RingBuffer> this_thread_buffer;
+
+  if (!this_thread_buffer || this_thread_buffer->generation != _generation.load()) {
+    std::lock_guard<std::mutex> lock(_buffers_mutex);
+    this_thread_buffer = std::make_shared<RingBuffer>(_generation.load(), _buffer_capacity.load());
+    _buffers.emplace_back(this_thread_buffer);
+  }
+
+  return *this_thread_buffer;
+}
+
+}  // namespace opossum
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+class Worker;
+
+enum class SchedulerTraceEventType : uint8_t { TaskExecution, Steal };
+
+/**
+ * An event recorded by the SchedulerTracer. Timestamps are nanoseconds since the tracing was enabled.
+ */
+struct SchedulerTraceEvent {
+  SchedulerTraceEventType type;
+  TaskID task_id;
+
+  // The Worker that executed or stole the task and its node
+  WorkerID worker_id;
+  NodeID node_id;
+
+  // TaskExecution: When the task was started and finished, and how long it waited in a queue or deque since it was
+  // ready. The wait is 0 if the task became ready before tracing was enabled.
+  // Steal: When the task was stolen (start_time == end_time)
+  int64_t start_time;
+  int64_t end_time;
+  int64_t queue_wait;
+
+  // Steal: The node of the deque or queue the task was stolen from and whether it was a queue
+  NodeID victim_node_id;
+  bool stolen_from_queue;
+
+  // The description of the task, truncated, only for TaskExecution
+  char description[64];
+};
+
+/**
+ * Records what the Workers do - which task they execute when and for how long, how long tasks waited for a Worker,
+ * and which tasks they steal from where - and exports it in the Chrome trace format, which can be viewed in
+ * chrome://tracing or ui.perfetto.dev. In the trace, every NUMA node is a process and every Worker a thread.
+ *
+ * Tracing is disabled by default and costs a single relaxed load per task then. When enabled, every Worker thread
+ * writes its events into a ring buffer of its own, without any synchronization with other Workers. If a buffer is
+ * full, the oldest events are overwritten. Events of a buffer that is written while it is read, i.e., while events are
+ * exported during tracing, may be inconsistent, so export after the workload of interest has finished.
+ *
+ * Only tasks executed by Workers are traced, i.e., not tasks executed without a Scheduler.
+ */
+class SchedulerTracer final : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_BUFFER_CAPACITY = size_t{64 * 1024};
+
+  static SchedulerTracer& get();
+
+  // Disables tracing and drops all events, must not be called while Workers record events
+  static void reset();
+
+  static bool is_enabled() { return _is_enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * Starts recording events. Each Worker thread keeps the last buffer_capacity events.
+   * Enabling tracing again drops the events recorded so far.
+   */
+  void enable(const size_t buffer_capacity = DEFAULT_BUFFER_CAPACITY);
+  void disable();
+
+  // The recorded events, ordered by Worker and time
+  std::vector<SchedulerTraceEvent> events() const;
+
+  void export_chrome_trace(std::ostream& stream) const;
+  void export_chrome_trace(const std::string& file_name) const;
+
+  // To be called when a ready task is put into a queue or deque, so that its wait time can be traced
+  static void on_task_enqueued(AbstractTask& task) {
+    if (is_enabled()) get()._on_task_enqueued(task);
+  }
+
+  // To be called by Workers
+  static int64_t now();
+  void record_task_execution(const AbstractTask& task, const Worker& worker, const int64_t start_time);
+  void record_steal(const AbstractTask& task, const Worker& worker, const NodeID victim_node_id,
+                    const bool stolen_from_queue);
+
+ protected:
+  class RingBuffer;
+
+  SchedulerTracer() = default;
+
+  void _on_task_enqueued(AbstractTask& task);
+
+  // The buffer of the calling thread, which is created on the first call after tracing was enabled
+  RingBuffer& _this_thread_buffer();
+
+  static std::atomic_bool _is_enabled;
+
+  // Incremented whenever tracing is enabled, so that threads notice that their buffer belongs to an earlier trace
+  std::atomic<uint64_t> _generation{0};
+  std::atomic<size_t> _buffer_capacity{DEFAULT_BUFFER_CAPACITY};
+
+  // Steady clock time at which the tracing was enabled
+  std::atomic<int64_t> _start_time{0};
+
+  // Only locked when a thread creates its buffer and when the events are read
+  mutable std::mutex _buffers_mutex;
+  std::vector<std::shared_ptr<RingBuffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,112 @@
+#include "task_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TaskDeque::Buffer::Buffer(size_t capacity)
+    : capacity(capacity), slots(std::make_unique<std::atomic<AbstractTask*>[]>(capacity)) {
+  DebugAssert((capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+}
+
+AbstractTask* TaskDeque::Buffer::get(int64_t index) const {
+  return slots[static_cast<size_t>(index) & (capacity - 1)].load(std::memory_order_relaxed);
+}
+
+void TaskDeque::Buffer::put(int64_t index, AbstractTask* task) {
+  slots[static_cast<size_t>(index) & (capacity - 1)].store(task, std::memory_order_relaxed);
+}
+
+TaskDeque::TaskDeque(NodeID node_id) : _node_id(node_id) {
+  _buffers.emplace_back(std::make_unique<Buffer>(INITIAL_CAPACITY));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+bool TaskDeque::empty() const {
+  return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+}
+
+NodeID TaskDeque::node_id() const { return _node_id; }
+
+void TaskDeque::push(std::shared_ptr<AbstractTask> task) {
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_node_id);
+
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top >= static_cast<int64_t>(buffer->capacity)) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  // The deque only stores raw pointers, as shared_ptrs cannot be exchanged atomically. The task references itself
+  // until the Worker that pulls or steals it takes over that reference.
+  auto raw_task = task.get();
+  raw_task->_deque_reference = std::move(task);
+
+  buffer->put(bottom, raw_task);
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> TaskDeque::pull() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque is empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto raw_task = buffer->get(bottom);
+
+  if (top == bottom) {
+    // This is the last task, thieves might try to take it as well
+    const auto won_race =
+        _top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    if (!won_race) return nullptr;
+  }
+
+  return std::move(raw_task->_deque_reference);
+}
+
+std::shared_ptr<AbstractTask> TaskDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  auto raw_task = _buffer.load(std::memory_order_acquire)->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Another thief or the owner took the task
+    return nullptr;
+  }
+
+  return std::move(raw_task->_deque_reference);
+}
+
+TaskDeque::Buffer* TaskDeque::_grow(Buffer* buffer, int64_t top, int64_t bottom) {
+  _buffers.emplace_back(std::make_unique<Buffer>(buffer->capacity * 2));
+  auto grown_buffer = _buffers.back().get();
+
+  for (auto index = top; index < bottom; ++index) {
+    grown_buffer->put(index, buffer->get(index));
+  }
+
+  _buffer.store(grown_buffer, std::memory_order_release);
+  return grown_buffer;
+}
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Holds the tasks a single Worker scheduled itself, e.g., the jobs of the task it is executing or the successors of
+ * the tasks it finished. Implemented as a Chase-Lev work-stealing deque [1]: Only the owning Worker pushes and pulls
+ * tasks at the bottom (LIFO), so that it continues with the most recently created and thus most likely cache-resident
+ * work. All other Workers steal the oldest tasks from the top (FIFO), which are usually the largest remaining chunks
+ * of work. push() and pull() are wait-free unless the deque grows, steal() is lock-free.
+ *
+ * The buffer grows if it runs full. Previous buffers are kept until the deque is destroyed, as concurrent thieves
+ * might still read from them.
+ *
+ * [1] Lê et al., "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013
+ */
+class TaskDeque final : private Noncopyable {
+ public:
+  explicit TaskDeque(NodeID node_id);
+
+  bool empty() const;
+
+  NodeID node_id() const;
+
+  /**
+   * Adds a task at the bottom. Must only be called by the owning Worker.
+   */
+  void push(std::shared_ptr<AbstractTask> task);
+
+  /**
+   * Returns the most recently pushed task and removes it from the deque. Must only be called by the owning Worker.
+   */
+  std::shared_ptr<AbstractTask> pull();
+
+  /**
+   * Returns the least recently pushed task and removes it from the deque. Can be called from any thread. Returns
+   * nullptr if the deque is empty or if another thread took the task first.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+ private:
+  static constexpr size_t INITIAL_CAPACITY = 64;
+
+  struct Buffer {
+    explicit Buffer(size_t capacity);
+
+    AbstractTask* get(int64_t index) const;
+    void put(int64_t index, AbstractTask* task);
+
+    const size_t capacity;
+    std::unique_ptr<std::atomic<AbstractTask*>[]> slots;
+  };
+
+  Buffer* _grow(Buffer* buffer, int64_t top, int64_t bottom);
+
+  NodeID _node_id;
+  std::atomic<int64_t> _top{0};
+  std::atomic<int64_t> _bottom{0};
+  std::atomic<Buffer*> _buffer;
+
+  // Owns the current and all previous buffers. Only modified by the owning Worker.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -21,36 +21,94 @@ void TaskQueue::push(std::shared_ptr<AbstractTask> task, uint32_t priority) {
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+
+  switch (static_cast<SchedulePriority>(priority)) {
+    case SchedulePriority::High:
+      _high_priority_queue.push(std::move(task));
+      break;
+
+    case SchedulePriority::Normal: {
+      std::lock_guard<std::mutex> lock(_session_queues_mutex);
+      const auto session_id = task->session_id();
+      auto& session_queue = _session_queues[session_id];
+      if (session_queue.empty()) _session_round_robin.push(session_id);
+      session_queue.push(std::move(task));
+      _num_session_tasks++;
+      break;
+    }
+
+    case SchedulePriority::Unstealable:
+      _unstealable_queue.push(std::move(task));
+      break;
+  }
 
   _num_tasks++;
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    queue.try_pop(task);
+  if (empty()) return nullptr;
 
-    if (task) {
-      _num_tasks--;
-      return task;
-    }
+  for (auto priority : {SchedulePriority::High, SchedulePriority::Normal, SchedulePriority::Unstealable}) {
+    auto task = _pop(priority);
+    if (task) return task;
   }
   return nullptr;
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
-  std::shared_ptr<AbstractTask> task;
-  for (auto i : {SchedulePriority::High, SchedulePriority::Normal}) {
-    auto& queue = _queues[static_cast<uint32_t>(i)];
-    queue.try_pop(task);
+  if (empty()) return nullptr;
 
-    if (task) {
-      _num_tasks--;
-      return task;
-    }
+  for (auto priority : {SchedulePriority::High, SchedulePriority::Normal}) {
+    auto task = _pop(priority);
+    if (task) return task;
   }
   return nullptr;
 }
 
+std::shared_ptr<AbstractTask> TaskQueue::_pop(SchedulePriority priority) {
+  std::shared_ptr<AbstractTask> task;
+  switch (priority) {
+    case SchedulePriority::High:
+      _high_priority_queue.try_pop(task);
+      break;
+    case SchedulePriority::Normal:
+      task = _pop_round_robin();
+      break;
+    case SchedulePriority::Unstealable:
+      _unstealable_queue.try_pop(task);
+      break;
+  }
+
+  if (task) _num_tasks--;
+  return task;
+}
+
+std::shared_ptr<AbstractTask> TaskQueue::_pop_round_robin() {
+  // Avoid locking if there are no Normal tasks, which is the common case for Workers looking for work
+  if (_num_session_tasks == 0) return nullptr;
+
+  std::lock_guard<std::mutex> lock(_session_queues_mutex);
+  if (_session_round_robin.empty()) return nullptr;
+
+  const auto session_id = _session_round_robin.front();
+  _session_round_robin.pop();
+
+  auto session_queue_it = _session_queues.find(session_id);
+  DebugAssert(session_queue_it != _session_queues.end(), "Session in round-robin order has no queued tasks");
+
+  auto& session_queue = session_queue_it->second;
+  auto task = std::move(session_queue.front());
+  session_queue.pop();
+  _num_session_tasks--;
+
+  // The session goes to the back of the round-robin order if it has more tasks
+  if (session_queue.empty()) {
+    _session_queues.erase(session_queue_it);
+  } else {
+    _session_round_robin.push(session_id);
+  }
+
+  return task;
+}
+
 }  // namespace opossum
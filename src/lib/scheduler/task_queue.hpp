@@ -2,9 +2,11 @@
 
 #include <stdint.h>
 #include <tbb/concurrent_queue.h>
-#include <array>
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <queue>
+#include <unordered_map>
 
 #include "types.hpp"
 
@@ -14,6 +16,14 @@ class AbstractTask;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Tasks with SchedulePriority::Normal are queued per session (see AbstractTask::session_id()) and the sessions with
+ * queued tasks are served round-robin, i.e., deficit round-robin with a quantum of one task. Thus, a session that
+ * schedules many tasks at once, e.g., a large analytical query, does not delay the tasks of the other sessions until
+ * all of its tasks have been pulled. Tasks with SchedulePriority::High are pulled before all others.
+ *
+ * The round-robin only covers the tasks in this queue. Thus, the NodeQueueScheduler does not put tasks of a session
+ * into the TaskDeques of the Workers, from which they would be pulled regardless of the other sessions.
  */
 class TaskQueue {
  public:
@@ -38,8 +48,21 @@ class TaskQueue {
   std::shared_ptr<AbstractTask> steal();
 
  private:
+  std::shared_ptr<AbstractTask> _pop(SchedulePriority priority);
+
+  // Returns the oldest Normal task of the next session in round-robin order, or nullptr
+  std::shared_ptr<AbstractTask> _pop_round_robin();
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  tbb::concurrent_queue<std::shared_ptr<AbstractTask>> _high_priority_queue;
+  tbb::concurrent_queue<std::shared_ptr<AbstractTask>> _unstealable_queue;
+
+  std::mutex _session_queues_mutex;
+  std::unordered_map<SessionID, std::queue<std::shared_ptr<AbstractTask>>> _session_queues;
+  // Sessions with queued tasks, each contained once
+  std::queue<SessionID> _session_round_robin;
+  std::atomic_uint _num_session_tasks{0};
+
   std::atomic_uint _num_tasks{0};
 };
 
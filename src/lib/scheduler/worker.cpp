@@ -4,6 +4,7 @@
 #include <sched.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -13,6 +14,8 @@
 #include "abstract_scheduler.hpp"
 #include "abstract_task.hpp"
 #include "current_scheduler.hpp"
+#include "node_queue_scheduler.hpp"
+#include "scheduler_tracer.hpp"
 #include "task_queue.hpp"
 
 namespace {
@@ -22,6 +25,31 @@ namespace {
  * Uses a weak_ptr, because otherwise the ref-count of it would not reach zero within the main() scope of the program.
  */
 thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
+
+// An idle worker looks for tasks for a number of rounds (spinning) before it parks. The number adapts between these
+// bounds: It doubles when spinning found a task and halves when the worker had to park.
+constexpr auto MIN_SPIN_ROUNDS = 4u;
+constexpr auto MAX_SPIN_ROUNDS = 64u;
+
+// Between two rounds, a spinning worker backs off for 2^round pause instructions. Beyond 2^MAX_BACKOFF_EXPONENT, it
+// yields the CPU instead, so that other threads (e.g., hibernating workers that are about to finish) can run.
+constexpr auto MAX_BACKOFF_EXPONENT = 10u;
+
+void back_off(const uint32_t spin_round) {
+  if (spin_round > MAX_BACKOFF_EXPONENT) {
+    std::this_thread::yield();
+    return;
+  }
+
+  for (auto pause_idx = 0u; pause_idx < (1u << spin_round); ++pause_idx) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+}
+
 }  // namespace
 
 namespace opossum {
@@ -30,12 +58,19 @@ std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_
 
 Worker::Worker(std::weak_ptr<ProcessingUnit> processing_unit, std::shared_ptr<TaskQueue> queue, WorkerID id,
                CpuID cpu_id)
-    : _processing_unit(processing_unit), _queue(queue), _id(id), _cpu_id(cpu_id) {}
+    : _processing_unit(processing_unit),
+      _queue(queue),
+      _deque(queue->node_id()),
+      _id(id),
+      _cpu_id(cpu_id),
+      _spin_rounds(MIN_SPIN_ROUNDS) {}
 
 WorkerID Worker::id() const { return _id; }
 
 std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
+TaskDeque& Worker::deque() { return _deque; }
+
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
 std::weak_ptr<ProcessingUnit> Worker::processing_unit() const { return _processing_unit; }
@@ -47,59 +82,144 @@ void Worker::operator()() {
 
   _set_affinity();
 
-  auto scheduler = CurrentScheduler::get();
+  // Workers are only created by the NodeQueueScheduler, which also manages idle workers
+  auto scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(CurrentScheduler::get());
 
-  DebugAssert(static_cast<bool>(scheduler), "No scheduler");
+  DebugAssert(static_cast<bool>(scheduler), "No NodeQueueScheduler");
 
   auto processing_unit = _processing_unit.lock();
 
   DebugAssert(static_cast<bool>(processing_unit), "No processing unit");
 
+  // Victims for work stealing. The own ProcessingUnit comes first, as its other Workers are usually waiting for the
+  // jobs in their deques.
+  auto local_victims = std::vector<std::shared_ptr<ProcessingUnit>>{processing_unit};
+  auto remote_victims = std::vector<std::shared_ptr<ProcessingUnit>>{};
+  for (const auto& victim : scheduler->processing_units()) {
+    if (victim == processing_unit) continue;
+    auto& victims = victim->node_id() == _queue->node_id() ? local_victims : remote_victims;
+    victims.emplace_back(victim);
+  }
+
+  // While spinning, the number of rounds without finding a task, 0 otherwise
+  auto spin_round = 0u;
+
   while (!processing_unit->shutdown_flag()) {
     // Hibernate if this is not the active worker.
     {
       auto this_worker_is_active = processing_unit->try_acquire_active_worker_token(_id);
       if (!this_worker_is_active) {
+        // Tasks that became ready when this worker finished its last task are left to the other workers
+        if (!_deque.empty()) scheduler->_wake_idle_worker(_queue->node_id());
+
         processing_unit->hibernate_calling_worker();
         continue;  // Re-try to become the active worker
       }
     }
 
     auto task = _queue->pull();
+    if (!task) task = _deque.pull();
 
     // TODO(all): this might shutdown the worker and leave non-ready tasks in the queue.
     // Figure out how we want to deal with that later.
     if (!task) {
-      // Simple work stealing without explicitly transferring data between nodes.
-      auto work_stealing_successful = false;
-      for (auto& queue : scheduler->queues()) {
-        if (queue == _queue) {
+      task = _steal_task(local_victims, remote_victims, scheduler->queues());
+
+      // Spin or park iff there is no ready task in our deque or queue and work stealing was not successful.
+      if (!task) {
+        if (spin_round == 0) ++scheduler->_num_spinning_workers;
+
+        if (spin_round < _spin_rounds) {
+          back_off(spin_round);
+          ++spin_round;
           continue;
         }
 
-        task = queue->steal();
-        if (task) {
-          task->set_node_id(_queue->node_id());
-          work_stealing_successful = true;
-          break;
-        }
-      }
+        --scheduler->_num_spinning_workers;
+        _spin_rounds = std::max(_spin_rounds / 2, MIN_SPIN_ROUNDS);
 
-      // Sleep iff there is no ready task in our queue and work stealing was not successful.
-      if (!work_stealing_successful) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        // If woken up by a scheduled task, the worker is counted as spinning already
+        spin_round = scheduler->_park_worker(*processing_unit) ? 1u : 0u;
         continue;
       }
     }
 
+    // There might be more work than this worker can handle. If it was the last one looking for tasks, wake up another
+    // one, which then looks for the remaining tasks. Thus, the number of running workers ramps up during bursts.
+    auto was_last_spinning_worker = false;
+    if (spin_round > 0) {
+      was_last_spinning_worker = --scheduler->_num_spinning_workers == 0;
+      _spin_rounds = std::min(_spin_rounds * 2, MAX_SPIN_ROUNDS);
+      spin_round = 0;
+    }
+    if (was_last_spinning_worker || !_queue->empty() || !_deque.empty()) {
+      scheduler->_wake_idle_worker(_queue->node_id());
+    }
+
+    const auto is_tracing = SchedulerTracer::is_enabled();
+    const auto trace_start_time = is_tracing ? SchedulerTracer::now() : int64_t{0};
+
     task->execute();
 
+    if (is_tracing) SchedulerTracer::get().record_task_execution(*task, *this, trace_start_time);
+
     // This is part of the Scheduler shutdown system. Count the number of tasks a ProcessingUnit executed to allow the
     // Scheduler to determine whether all tasks finished
     processing_unit->on_worker_finished_task();
   }
 
+  if (spin_round > 0) --scheduler->_num_spinning_workers;
+
+  processing_unit->yield_active_worker_token(_id);
+}
+
+void Worker::_hand_off_active_worker_token() {
+  auto processing_unit = _processing_unit.lock();
+  DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
+
   processing_unit->yield_active_worker_token(_id);
+  processing_unit->wake_or_create_worker();
+}
+
+std::shared_ptr<AbstractTask> Worker::_steal_task(const std::vector<std::shared_ptr<ProcessingUnit>>& local_victims,
+                                                  const std::vector<std::shared_ptr<ProcessingUnit>>& remote_victims,
+                                                  const std::vector<std::shared_ptr<TaskQueue>>& queues) {
+  const auto trace_steal = [&](const std::shared_ptr<AbstractTask>& task, const NodeID victim_node_id,
+                               const bool stolen_from_queue) {
+    if (!SchedulerTracer::is_enabled()) return;
+    SchedulerTracer::get().record_steal(*task, *this, victim_node_id, stolen_from_queue);
+  };
+
+  for (const auto& victim : local_victims) {
+    auto task = victim->steal_task();
+    if (task) {
+      trace_steal(task, victim->node_id(), false);
+      return task;
+    }
+  }
+
+  // Simple work stealing from remote nodes without explicitly transferring data between nodes.
+  for (const auto& queue : queues) {
+    if (queue == _queue) continue;
+
+    auto task = queue->steal();
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      trace_steal(task, queue->node_id(), true);
+      return task;
+    }
+  }
+
+  for (const auto& victim : remote_victims) {
+    auto task = victim->steal_task();
+    if (task) {
+      task->set_node_id(_queue->node_id());
+      trace_steal(task, victim->node_id(), false);
+      return task;
+    }
+  }
+
+  return nullptr;
 }
 
 void Worker::_set_affinity() {
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "processing_unit.hpp"
+#include "task_deque.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -14,9 +15,17 @@ class TaskQueue;
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * Tasks scheduled from the Worker's thread are kept in its own TaskDeque, unless they belong to a session (see FAIR
+ * SHARE in node_queue_scheduler.hpp). The active Worker takes tasks from, in this order, the TaskQueue of its node,
+ * its TaskDeque (newest first), the TaskDeques of the other Workers of its node (oldest first), and finally the
+ * TaskQueues and TaskDeques of remote nodes. The TaskQueue comes first, as it holds the tasks that start new queries,
+ * high priority tasks, and the tasks of sessions, which should not wait for the work already in progress.
+ * If there is no task at all, the active Worker spins and then parks (see IDLE WORKERS in node_queue_scheduler.hpp).
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractTask;
+  friend class AdmissionControl;
   friend class CurrentScheduler;
   friend class NodeQueueScheduler;
 
@@ -30,6 +39,7 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   WorkerID id() const;
   std::shared_ptr<TaskQueue> queue() const;
+  TaskDeque& deque();
   std::weak_ptr<ProcessingUnit> processing_unit() const;
   CpuID cpu_id() const;
 
@@ -45,17 +55,19 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
      * This method blocks the calling thread (worker) until all tasks have been completed.
      * It hands off the active worker token so that another worker can execute tasks while the calling worker is blocked.
      */
-    auto processing_unit = _processing_unit.lock();
-    DebugAssert(static_cast<bool>(processing_unit), "Bug: Locking the processing unit failed");
-
-    processing_unit->yield_active_worker_token(_id);
-    processing_unit->wake_or_create_worker();
+    _hand_off_active_worker_token();
 
     for (auto& task : tasks) {
       task->_join_without_replacement_worker();
     }
   }
 
+  /**
+   * To be called before the calling thread (worker) blocks. Yields the active worker token and wakes up or creates
+   * another worker of the ProcessingUnit, which executes tasks in the meantime.
+   */
+  void _hand_off_active_worker_token();
+
  private:
   /**
    * Pin a worker to a particular core.
@@ -63,10 +75,22 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  /**
+   * Steals a task from another Worker's TaskDeque or a remote TaskQueue, preferring victims on the own node.
+   * Returns nullptr if no task could be stolen.
+   */
+  std::shared_ptr<AbstractTask> _steal_task(const std::vector<std::shared_ptr<ProcessingUnit>>& local_victims,
+                                            const std::vector<std::shared_ptr<ProcessingUnit>>& remote_victims,
+                                            const std::vector<std::shared_ptr<TaskQueue>>& queues);
+
   std::weak_ptr<ProcessingUnit> _processing_unit;
   std::shared_ptr<TaskQueue> _queue;
+  TaskDeque _deque;
   WorkerID _id;
   CpuID _cpu_id;
+
+  // Number of rounds the Worker looks for tasks before it parks, adapted to the load
+  uint32_t _spin_rounds;
 };
 
 }  // namespace opossum
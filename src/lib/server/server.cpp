@@ -12,10 +12,11 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-Server::Server(boost::asio::io_service& io_service, uint16_t port)
+Server::Server(boost::asio::io_service& io_service, uint16_t port, std::chrono::milliseconds statement_timeout)
     : _io_service(io_service),
       _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-      _socket(io_service) {
+      _socket(io_service),
+      _statement_timeout(statement_timeout) {
   accept_next_connection();
 }
 
@@ -27,7 +28,7 @@ void Server::start_session(boost::system::error_code error) {
   if (!error) {
     auto connection = std::make_shared<ClientConnection>(std::move(_socket));
     auto task_runner = std::make_shared<TaskRunner>(_io_service);
-    auto session = std::make_unique<ServerSession>(connection, task_runner);
+    auto session = std::make_unique<ServerSession>(connection, task_runner, _statement_timeout);
     // Start the session and release it once it has terminated
     session->start() >> then >> [session = std::move(session)]() mutable { session.reset(); };
   }
@@ -3,11 +3,15 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <chrono>
+
 namespace opossum {
 
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  // statement_timeout is the initial statement timeout of every session, 0 disables it
+  Server(boost::asio::io_service& io_service, uint16_t port,
+         std::chrono::milliseconds statement_timeout = std::chrono::milliseconds{0});
 
  protected:
   void accept_next_connection();
@@ -16,6 +20,7 @@ class Server {
   boost::asio::io_service& _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   boost::asio::ip::tcp::socket _socket;
+  const std::chrono::milliseconds _statement_timeout;
 };
 
 }  // namespace opossum
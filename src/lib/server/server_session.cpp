@@ -164,18 +164,18 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string sql) {
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    return _dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true, _statement_timeout));
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
     auto task = std::make_shared<LoadServerFileTask>(file_name, table_name);
-    return _task_runner->dispatch_server_task(task) >> then >>
+    return _dispatch_server_task(task) >> then >>
            [=]() { return _connection->send_notice("Successfully loaded " + table_name); };
   };
 
   auto execute_sql_pipeline = [=](std::shared_ptr<SQLPipeline> sql_pipeline) {
     auto task = std::make_shared<ExecuteServerQueryTask>(sql_pipeline);
-    return _task_runner->dispatch_server_task(task) >> then >> [=]() { return sql_pipeline; };
+    return _dispatch_server_task(task) >> then >> [=]() { return sql_pipeline; };
   };
 
   // A simple query command invalidates unnamed statements and portals
@@ -185,6 +185,9 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
   return create_sql_pipeline() >> then >> [=](std::unique_ptr<CreatePipelineResult> result) {
     if (result->load_table.has_value()) {
       return load_table_file(result->load_table.value().first, result->load_table.value().second);
+    } else if (result->statement_timeout.has_value()) {
+      _statement_timeout = result->statement_timeout.value();
+      return _connection->send_command_complete("SET");
     } else {
       return execute_sql_pipeline(result->sql_pipeline) >> then >>
              [=](std::shared_ptr<SQLPipeline> sql_pipeline) { return _send_simple_query_response(sql_pipeline); };
@@ -206,7 +209,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_c
     _prepared_statements.erase(statement_it);
   }
 
-  return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(parse_info.query)) >> then >>
+  return _dispatch_server_task(std::make_shared<CreatePipelineTask>(parse_info.query)) >> then >>
          [=](std::unique_ptr<CreatePipelineResult> result) {
            // We know that SQLPipeline is set because the load table command is not allowed in this context
            _prepared_statements.insert(std::make_pair(prepared_statement_name, result->sql_pipeline));
@@ -236,7 +239,7 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
   auto statement_type = sql_pipeline->get_parsed_sql_statements().front()->getStatements().front()->type();
 
   auto task = std::make_shared<BindServerPreparedStatementTask>(sql_pipeline, std::move(packet.params));
-  return _task_runner->dispatch_server_task(task) >> then >>
+  return _dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<SQLQueryPlan> query_plan) {
            std::shared_ptr<SQLQueryPlan> shared_query_plan = std::move(query_plan);
            auto portal = std::make_pair(statement_type, shared_query_plan);
@@ -281,7 +284,9 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
 
   query_plan->set_transaction_context(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(query_plan)) >> then >>
+  auto execute_task = std::make_shared<ExecuteServerPreparedStatementTask>(query_plan, _statement_timeout);
+
+  return _dispatch_server_task(execute_task) >> then >>
          [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
            if (!result_table)
@@ -4,6 +4,7 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <chrono>
 #include <memory>
 
 #include "client_connection.hpp"
@@ -11,18 +12,37 @@
 #include "sql/sql_pipeline.hpp"
 #include "task_runner.hpp"
 #include "types.hpp"
+#include "uid_allocator.hpp"
 
 namespace opossum {
 
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl {
  public:
-  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
-      : _connection(connection), _task_runner(task_runner) {}
+  // Statements that execute for longer than statement_timeout are cancelled, 0 disables the timeout. Clients can change
+  // it for their session with SET statement_timeout = <milliseconds>.
+  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner,
+                             std::chrono::milliseconds statement_timeout = std::chrono::milliseconds{0})
+      : _connection(connection),
+        _task_runner(task_runner),
+        _session_id(_allocate_session_id()),
+        _statement_timeout(statement_timeout) {}
 
   boost::future<void> start();
 
  protected:
+  static SessionID _allocate_session_id() {
+    static UidAllocator session_id_allocator;
+    return session_id_allocator.allocate();
+  }
+
+  // Tags the task (and thus the tasks it schedules) with the session, so that sessions get a fair share of the CPUs
+  template <typename TTask>
+  auto _dispatch_server_task(std::shared_ptr<TTask> task) {
+    task->set_session_id(_session_id);
+    return _task_runner->dispatch_server_task(task);
+  }
+
   boost::future<void> _perform_session_startup();
 
   boost::future<void> _handle_client_requests();
@@ -38,6 +58,8 @@ class ServerSessionImpl {
 
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
+  const SessionID _session_id;
+  std::chrono::milliseconds _statement_timeout;
 
   std::shared_ptr<TransactionContext> _transaction;
   std::unordered_map<std::string, std::shared_ptr<SQLPipeline>> _prepared_statements;
@@ -7,7 +7,8 @@ namespace opossum {
 
 SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
                          const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
-                         const PreparedStatementCache& prepared_statements)
+                         const PreparedStatementCache& prepared_statements, const UsePipelining use_pipelining,
+                         const std::chrono::milliseconds statement_timeout)
     : _transaction_context(transaction_context), _optimizer(optimizer) {
   DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
               "The transaction context cannot have been committed already.");
@@ -66,7 +67,8 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
     sql_string_offset += statement_string_length;
 
     auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
-        statement_string, std::move(parsed_statement), use_mvcc, transaction_context, optimizer, prepared_statements);
+        statement_string, std::move(parsed_statement), use_mvcc, transaction_context, optimizer, prepared_statements,
+        use_pipelining, statement_timeout);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -193,6 +195,12 @@ std::shared_ptr<const Table> SQLPipeline::get_result_table() {
   return _result_table;
 }
 
+void SQLPipeline::cancel() {
+  for (const auto& pipeline_statement : _sql_pipeline_statements) {
+    pipeline_statement->cancel();
+  }
+}
+
 std::shared_ptr<TransactionContext> SQLPipeline::transaction_context() const { return _transaction_context; }
 
 std::shared_ptr<SQLPipelineStatement> SQLPipeline::failed_pipeline_statement() const {
@@ -34,7 +34,8 @@ class SQLPipeline : public Noncopyable {
  public:
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
-              const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements);
+              const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements,
+              const UsePipelining use_pipelining, const std::chrono::milliseconds statement_timeout);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -58,6 +59,9 @@ class SQLPipeline : public Noncopyable {
   // Executes all tasks, waits for them to finish, and returns the resulting table of the last statement.
   std::shared_ptr<const Table> get_result_table();
 
+  // Cancels the execution of all statements, see SQLPipelineStatement::cancel(). Can be called from any thread.
+  void cancel();
+
   // Returns the TransactionContext that was passed to the SQLPipelineStatement, or nullptr if none was passed in.
   std::shared_ptr<TransactionContext> transaction_context() const;
 
@@ -28,19 +28,31 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_transaction_context(
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_pipelining(const UsePipelining use_pipelining) {
+  _use_pipelining = use_pipelining;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_statement_timeout(const std::chrono::milliseconds statement_timeout) {
+  _statement_timeout = statement_timeout;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() { return with_mvcc(UseMvcc::No); }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql, _transaction_context, _use_mvcc, optimizer, _prepared_statements};
+  return {_sql, _transaction_context, _use_mvcc, optimizer, _prepared_statements, _use_pipelining,
+          _statement_timeout};
 }
 
 SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
     std::shared_ptr<hsql::SQLParserResult> parsed_sql) const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql, parsed_sql, _use_mvcc, _transaction_context, optimizer, _prepared_statements};
+  return {_sql, parsed_sql, _use_mvcc, _transaction_context, optimizer, _prepared_statements, _use_pipelining,
+          _statement_timeout};
 }
 
 }  // namespace opossum
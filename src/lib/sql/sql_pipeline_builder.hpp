@@ -1,5 +1,6 @@
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 
@@ -27,6 +28,8 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer() is used.
+ *  - Pipelining is disabled, i.e., every operator materializes its complete output before its consumers start
+ *  - There is no statement timeout
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -40,6 +43,12 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_optimizer(const std::shared_ptr<Optimizer>& optimizer);
   SQLPipelineBuilder& with_prepared_statement_cache(const PreparedStatementCache& prepared_statements);
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
+  SQLPipelineBuilder& with_pipelining(const UsePipelining use_pipelining);
+
+  /**
+   * Cancel each statement that executes for longer than statement_timeout, 0 disables the timeout
+   */
+  SQLPipelineBuilder& with_statement_timeout(const std::chrono::milliseconds statement_timeout);
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -61,6 +70,8 @@ class SQLPipelineBuilder final {
   std::shared_ptr<TransactionContext> _transaction_context;
   std::shared_ptr<Optimizer> _optimizer;
   PreparedStatementCache _prepared_statements;
+  UsePipelining _use_pipelining{UsePipelining::No};
+  std::chrono::milliseconds _statement_timeout{0};
 };
 
 }  // namespace opossum
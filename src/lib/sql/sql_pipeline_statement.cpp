@@ -2,6 +2,7 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
 #include <iomanip>
 #include <utility>
 
@@ -9,7 +10,7 @@
 #include "concurrency/transaction_manager.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "optimizer/optimizer.hpp"
-#include "scheduler/current_scheduler.hpp"
+#include "scheduler/admission_control.hpp"
 #include "sql/hsql_expr_translator.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_query_plan.hpp"
@@ -22,9 +23,13 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const UseMvcc use_mvcc,
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const PreparedStatementCache& prepared_statements)
+                                           const PreparedStatementCache& prepared_statements,
+                                           const UsePipelining use_pipelining,
+                                           const std::chrono::milliseconds statement_timeout)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
+      _use_pipelining(use_pipelining),
+      _statement_timeout(statement_timeout),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
       _transaction_context(transaction_context),
       _optimizer(optimizer),
@@ -196,7 +201,11 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
               "Physical query qlan creation returned no or more than one plan for a single statement.");
 
   const auto& root = query_plan->tree_roots().front();
-  _tasks = OperatorTask::make_tasks_from_operator(root);
+  _tasks = OperatorTask::make_tasks_from_operator(root, _use_pipelining);
+  for (const auto& task : _tasks) {
+    task->set_cancellation_token(_cancellation_token);
+  }
+
   return _tasks;
 }
 
@@ -218,7 +227,22 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  if (_statement_timeout.count() > 0) _cancellation_token->cancel_after(_statement_timeout);
+
+  AdmissionControl::get().schedule_and_wait_for_query(tasks);
+
+  // If some operators did not execute (completely) because the query was cancelled, neither their changes nor the
+  // result must be used. The transaction is aborted, just like when a read/write operator fails. A query that was
+  // cancelled only after all of its operators executed has a complete result.
+  const auto was_cancelled =
+      std::any_of(tasks.cbegin(), tasks.cend(), [](const auto& task) { return task->was_cancelled(); });
+  if (was_cancelled) {
+    if (_transaction_context && _transaction_context->phase() == TransactionPhase::Active) {
+      _transaction_context->rollback();
+    }
+    // The token stays cancelled, so this throws
+    _cancellation_token->check();
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -234,6 +258,8 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   return _result_table;
 }
 
+void SQLPipelineStatement::cancel() { _cancellation_token->cancel(); }
+
 const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_context() const {
   return _transaction_context;
 }
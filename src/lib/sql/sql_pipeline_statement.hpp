@@ -1,11 +1,13 @@
 #pragma once
 
+#include <chrono>
 #include <string>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "storage/table.hpp"
@@ -34,7 +36,8 @@ class SQLPipelineStatement : public Noncopyable {
   // Prefer using the SQLPipelineBuilder for constructing SQLPipelineStatements conveniently
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
-                       const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements);
+                       const std::shared_ptr<Optimizer>& optimizer, const PreparedStatementCache& prepared_statements,
+                       const UsePipelining use_pipelining, const std::chrono::milliseconds statement_timeout);
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -55,8 +58,13 @@ class SQLPipelineStatement : public Noncopyable {
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // Throws a QueryCancelledException if the statement was cancelled or exceeded its timeout before all of its operators
+  // executed. In that case, the transaction is rolled back.
   const std::shared_ptr<const Table>& get_result_table();
 
+  // Cancels the execution of the statement. Can be called from any thread, before or during get_result_table().
+  void cancel();
+
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
   // This can be a nullptr if no transaction management is wanted.
   const std::shared_ptr<TransactionContext>& transaction_context() const;
@@ -72,6 +80,11 @@ class SQLPipelineStatement : public Noncopyable {
  private:
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
+  const UsePipelining _use_pipelining;
+
+  // Cancels the execution once it exceeds the timeout, 0 if there is none
+  const std::chrono::milliseconds _statement_timeout;
+  const std::shared_ptr<CancellationToken> _cancellation_token = std::make_shared<CancellationToken>();
 
   // Perform MVCC commit right after the Statement was executed
   const bool _auto_commit;
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "all_type_variant.hpp"
+#include "memory_usage.hpp"
 #include "types.hpp"
 #include "utils/format_bytes.hpp"
 
@@ -41,6 +42,10 @@ class BaseColumn : private Noncopyable {
   // data, such as strings who memory usage is implementation defined
   virtual size_t estimate_memory_usage() const = 0;
 
+  // Returns the memory held by the Column, broken down by component. Shared components (e.g., the PosList of a
+  // ReferenceColumn) are counted in full.
+  virtual MemoryUsage memory_usage() const = 0;
+
  private:
   const DataType _data_type;
 };
@@ -4,12 +4,17 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "base_column.hpp"
 #include "chunk.hpp"
+#include "base_dictionary_column.hpp"
+#include "index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "index/base_index.hpp"
+#include "index/group_key/composite_group_key_index.hpp"
+#include "index/group_key/group_key_index.hpp"
 #include "optimizer/chunk_statistics/chunk_statistics.hpp"
 #include "reference_column.hpp"
 #include "resolve_type.hpp"
@@ -47,6 +52,10 @@ void Chunk::replace_column(size_t column_id, std::shared_ptr<BaseColumn> column)
 void Chunk::append(const std::vector<AllTypeVariant>& values) {
   DebugAssert(is_mutable(), "Can't append to immutable Chunk");
 
+  // The appended row is not necessarily in order and not covered by the statistics
+  _ordered_by.reset();
+  if (_statistics) std::atomic_store(&_statistics, std::shared_ptr<ChunkStatistics>{});
+
   // Do this first to ensure that the first thing to exist in a row are the MVCC columns.
   if (has_mvcc_columns()) mvcc_columns()->grow_by(1u, MvccColumns::MAX_COMMIT_ID);
 
@@ -98,6 +107,7 @@ SharedScopedLockingPtr<const MvccColumns> Chunk::mvcc_columns() const {
 std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(
     const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
   auto result = std::vector<std::shared_ptr<BaseIndex>>();
+  std::shared_lock<std::shared_mutex> lock(_index_mutex);
   std::copy_if(_indices.cbegin(), _indices.cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(columns); });
   return result;
@@ -110,6 +120,7 @@ std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indices(const std::vector<Col
 
 std::shared_ptr<BaseIndex> Chunk::get_index(const ColumnIndexType index_type,
                                             const std::vector<std::shared_ptr<const BaseColumn>>& columns) const {
+  std::shared_lock<std::shared_mutex> lock(_index_mutex);
   auto index_it = std::find_if(_indices.cbegin(), _indices.cend(), [&](const auto& index) {
     return index->is_index_for(columns) && index->type() == index_type;
   });
@@ -123,7 +134,28 @@ std::shared_ptr<BaseIndex> Chunk::get_index(const ColumnIndexType index_type,
   return get_index(index_type, columns);
 }
 
+std::shared_ptr<BaseIndex> Chunk::create_index(const ColumnIndexType index_type,
+                                               const std::vector<ColumnID>& column_ids) {
+  switch (index_type) {
+    case ColumnIndexType::GroupKey:
+      return create_index<GroupKeyIndex>(column_ids);
+    case ColumnIndexType::CompositeGroupKey:
+      return create_index<CompositeGroupKeyIndex>(column_ids);
+    case ColumnIndexType::AdaptiveRadixTree:
+      return create_index<AdaptiveRadixTreeIndex>(column_ids);
+    default:
+      Fail("Unknown index type");
+  }
+}
+
+bool Chunk::columns_are_indexable(const std::vector<ColumnID>& column_ids) const {
+  return std::all_of(column_ids.cbegin(), column_ids.cend(), [&](const auto column_id) {
+    return std::dynamic_pointer_cast<const BaseDictionaryColumn>(get_column(column_id)) != nullptr;
+  });
+}
+
 void Chunk::remove_index(std::shared_ptr<BaseIndex> index) {
+  std::unique_lock<std::shared_mutex> lock(_index_mutex);
   auto it = std::find(_indices.cbegin(), _indices.cend(), index);
   DebugAssert(it != _indices.cend(), "Trying to remove a non-existing index");
   _indices.erase(it);
@@ -151,8 +183,11 @@ bool Chunk::references_exactly_one_table() const {
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   // Migrating chunks with indices is not implemented yet.
-  if (_indices.size() > 0) {
-    Fail("Cannot migrate Chunk with Indices.");
+  {
+    std::shared_lock<std::shared_mutex> lock(_index_mutex);
+    if (_indices.size() > 0) {
+      Fail("Cannot migrate Chunk with Indices.");
+    }
   }
 
   _alloc = PolymorphicAllocator<size_t>(memory_source);
@@ -185,6 +220,40 @@ size_t Chunk::estimate_memory_usage() const {
   return bytes;
 }
 
+MemoryUsage Chunk::memory_usage() const {
+  auto usage = MemoryUsage{};
+  usage.metadata = sizeof(*this) + container_memory_usage(_columns);
+
+  // All ReferenceColumns of a Chunk usually share the same PosList
+  auto counted_pos_lists = std::unordered_set<const PosList*>{};
+  for (const auto& column : _columns) {
+    auto column_usage = column->memory_usage();
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      if (!counted_pos_lists.emplace(reference_column->pos_list().get()).second) column_usage.pos_lists = 0u;
+    }
+    usage += column_usage;
+  }
+
+  if (_mvcc_columns) {
+    usage.mvcc = sizeof(MvccColumns) + container_memory_usage(_mvcc_columns->tids) +
+                 container_memory_usage(_mvcc_columns->begin_cids) + container_memory_usage(_mvcc_columns->end_cids);
+  }
+
+  if (_access_counter) usage.metadata += sizeof(ChunkAccessCounter);
+
+  {
+    std::shared_lock<std::shared_mutex> lock(_index_mutex);
+    usage.indices = container_memory_usage(_indices);
+    for (const auto& index : _indices) {
+      usage.indices += index->memory_consumption();
+    }
+  }
+
+  if (_statistics) usage.statistics = _statistics->memory_consumption();
+
+  return usage;
+}
+
 std::vector<std::shared_ptr<const BaseColumn>> Chunk::get_columns_for_ids(
     const std::vector<ColumnID>& column_ids) const {
   DebugAssert(([&]() {
@@ -201,12 +270,19 @@ std::vector<std::shared_ptr<const BaseColumn>> Chunk::get_columns_for_ids(
   return columns;
 }
 
-std::shared_ptr<ChunkStatistics> Chunk::statistics() const { return _statistics; }
+std::shared_ptr<ChunkStatistics> Chunk::statistics() const { return std::atomic_load(&_statistics); }
 
 void Chunk::set_statistics(std::shared_ptr<ChunkStatistics> chunk_statistics) {
   DebugAssert(chunk_statistics->statistics().size() == column_count(),
               "ChunkStatistics must have same column amount as Chunk");
-  _statistics = chunk_statistics;
+  std::atomic_store(&_statistics, chunk_statistics);
+}
+
+const std::optional<std::pair<ColumnID, OrderByMode>>& Chunk::ordered_by() const { return _ordered_by; }
+
+void Chunk::set_ordered_by(const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by) {
+  DebugAssert(!ordered_by || ordered_by->first < column_count(), "ColumnID out of range");
+  _ordered_by = ordered_by;
 }
 
 }  // namespace opossum
@@ -11,12 +11,14 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "index/column_index_type.hpp"
 
 #include "all_type_variant.hpp"
 #include "chunk_access_counter.hpp"
+#include "memory_usage.hpp"
 #include "mvcc_columns.hpp"
 #include "table_column_definition.hpp"
 #include "types.hpp"
@@ -39,6 +41,9 @@ using ChunkColumns = pmr_vector<std::shared_ptr<BaseColumn>>;
  * Find more information about this in our wiki: https://github.com/hyrise/hyrise/wiki/chunk-concept
  */
 class Chunk : private Noncopyable {
+  // Shares the MVCC columns of evicted chunks with the chunk that replaces them
+  friend class Table;
+
  public:
   static const ChunkOffset MAX_SIZE;
 
@@ -100,6 +105,10 @@ class Chunk : private Noncopyable {
                                        const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
   std::shared_ptr<BaseIndex> get_index(const ColumnIndexType index_type, const std::vector<ColumnID> column_ids) const;
 
+  /**
+   * Indices can be created and removed while other threads look them up. An index is built without holding a lock and
+   * only published under _index_mutex.
+   */
   template <typename Index>
   std::shared_ptr<BaseIndex> create_index(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns) {
     DebugAssert(([&]() {
@@ -112,6 +121,8 @@ class Chunk : private Noncopyable {
                 "All columns must be part of the chunk.");
 
     auto index = std::make_shared<Index>(index_columns);
+
+    std::unique_lock<std::shared_mutex> lock(_index_mutex);
     _indices.emplace_back(index);
     return index;
   }
@@ -122,6 +133,12 @@ class Chunk : private Noncopyable {
     return create_index<Index>(columns);
   }
 
+  // Creates an index of the given type at runtime, see create_index<Index>()
+  std::shared_ptr<BaseIndex> create_index(const ColumnIndexType index_type, const std::vector<ColumnID>& column_ids);
+
+  // Indices can only be created on dictionary-encoded columns
+  bool columns_are_indexable(const std::vector<ColumnID>& column_ids) const;
+
   void remove_index(std::shared_ptr<BaseIndex> index);
 
   void migrate(boost::container::pmr::memory_resource* memory_source);
@@ -132,15 +149,33 @@ class Chunk : private Noncopyable {
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
 
+  /**
+   * The statistics (zone maps) of a chunk are built when it is encoded and extended by the Insert operator while it is
+   * mutable. They can be replaced while the chunk is scanned, so they are read and written atomically.
+   */
   std::shared_ptr<ChunkStatistics> statistics() const;
 
   void set_statistics(std::shared_ptr<ChunkStatistics> statistics);
 
+  /**
+   * The order in which the rows of this Chunk are physically stored, if known. It is set by operators that produce
+   * sorted output (e.g., Sort) or when a Chunk is physically re-sorted (see ChunkCompressionTask) and used by operators
+   * to binary search instead of scanning or to skip sorting. Appending rows invalidates it.
+   */
+  const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by() const;
+  void set_ordered_by(const std::optional<std::pair<ColumnID, OrderByMode>>& ordered_by);
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Chunk and its Columns
    */
   size_t estimate_memory_usage() const;
 
+  /**
+   * Returns the memory held by this Chunk, broken down by component. Other than estimate_memory_usage(), this includes
+   * indices and statistics. A PosList shared by multiple ReferenceColumns is only counted once.
+   */
+  MemoryUsage memory_usage() const;
+
  private:
   std::vector<std::shared_ptr<const BaseColumn>> get_columns_for_ids(const std::vector<ColumnID>& column_ids) const;
 
@@ -150,7 +185,9 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccColumns> _mvcc_columns;
   std::shared_ptr<ChunkAccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+  mutable std::shared_mutex _index_mutex;
   std::shared_ptr<ChunkStatistics> _statistics;
+  std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
 };
 
 }  // namespace opossum
@@ -25,12 +25,15 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   std::vector<std::shared_ptr<ChunkColumnStatistics>> column_statistics;
   for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
     const auto spec = chunk_encoding_spec[column_id];
+    const auto data_type = data_types[column_id];
 
     if (spec.encoding_type == EncodingType::Unencoded) {
-      column_statistics.push_back(nullptr);
+      // Unencoded columns get zone maps as well, so that scans can skip the chunk independently of its encoding
+      const auto column = chunk->get_mutable_column(column_id);
+      column_statistics.push_back(
+          ChunkColumnStatistics::build_statistics(data_type, column, spec.bloom_filter_false_positive_rate));
       continue;
     }
-    const auto data_type = data_types[column_id];
     const auto base_column = chunk->get_column(column_id);
     const auto value_column = std::dynamic_pointer_cast<const BaseValueColumn>(base_column);
 
@@ -39,7 +42,8 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
     auto encoded_column = encode_column(spec.encoding_type, data_type, value_column, spec.vector_compression_type);
     chunk->replace_column(column_id, encoded_column);
 
-    column_statistics.push_back(ChunkColumnStatistics::build_statistics(data_type, encoded_column));
+    column_statistics.push_back(
+        ChunkColumnStatistics::build_statistics(data_type, encoded_column, spec.bloom_filter_false_positive_rate));
   }
 
   chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
@@ -66,6 +70,7 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
     const auto chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
 
     encode_chunk(chunk, data_types, chunk_encoding_spec);
+    table->create_missing_indexes(chunk_id);
   }
 }
 
@@ -78,6 +83,7 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
     auto chunk = table->get_chunk(chunk_id);
 
     encode_chunk(chunk, data_types, column_encoding_spec);
+    table->create_missing_indexes(chunk_id);
   }
 }
 
@@ -92,6 +98,7 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
 
     encode_chunk(chunk, column_types, chunk_encoding_spec);
+    table->create_missing_indexes(chunk_id);
   }
 }
 
@@ -103,6 +110,7 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     auto chunk = table->get_chunk(chunk_id);
 
     encode_chunk(chunk, column_types, column_encoding_spec);
+    table->create_missing_indexes(chunk_id);
   }
 }
 
@@ -9,6 +9,7 @@
 #include "all_type_variant.hpp"
 #include "types.hpp"
 
+#include "optimizer/chunk_statistics/bloom_filter.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/vector_compression/vector_compression.hpp"
 
@@ -25,6 +26,13 @@ struct ColumnEncodingSpec {
 
   EncodingType encoding_type;
   std::optional<VectorCompressionType> vector_compression_type;
+
+  /**
+   * False positive rate of the column's BloomFilter statistics, e.g., DEFAULT_BLOOM_FILTER_FALSE_POSITIVE_RATE. Bloom
+   * filters only pay off for columns with equality lookups of values that lie in between the chunk's values, so none
+   * is built by default.
+   */
+  std::optional<double> bloom_filter_false_positive_rate;
 };
 
 using ChunkEncodingSpec = std::vector<ColumnEncodingSpec>;
@@ -34,6 +42,8 @@ using ChunkEncodingSpec = std::vector<ColumnEncodingSpec>;
  *
  * The methods provided are not thread-safe and might lead to race conditions
  * if there are other operations manipulating the chunks at the same time.
+ *
+ * The methods taking a table also create the table's indices (see Table::get_indexes()) for the encoded chunks.
  */
 class ChunkEncoder {
  public:
@@ -135,6 +135,11 @@ class ColumnIterable {
  * reference column (see chunk_offset_mapping.hpp). When such a list is
  * passed, the used iterators only iterate over the chunk offsets that
  * were included in the pos_list; everything else is skipped.
+ *
+ * Furthermore, the iterators can be restricted to a contiguous range of
+ * chunk offsets (e.g., the morsel of a chunk that is processed by one task).
+ * In contrast to passing mapped chunk offsets, these are the same sequential
+ * iterators as without a range, only starting and ending at other positions.
  */
 template <typename Derived>
 class PointAccessibleColumnIterable : public ColumnIterable<Derived> {
@@ -150,6 +155,16 @@ class PointAccessibleColumnIterable : public ColumnIterable<Derived> {
     }
   }
 
+  /**
+   * @param begin_chunk_offset, end_chunk_offset denote the range [begin_chunk_offset, end_chunk_offset) of rows
+   */
+  template <typename Functor>
+  void with_iterators(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset,
+                      const Functor& functor) const {
+    DebugAssert(begin_chunk_offset <= end_chunk_offset, "Invalid chunk offset range");
+    _self()._on_with_iterators(begin_chunk_offset, end_chunk_offset, functor);
+  }
+
   using ColumnIterable<Derived>::for_each;  // needed because of “name hiding”
 
   template <typename Functor>
@@ -161,6 +176,16 @@ class PointAccessibleColumnIterable : public ColumnIterable<Derived> {
     });
   }
 
+  template <typename Functor>
+  void for_each(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset,
+                const Functor& functor) const {
+    with_iterators(begin_chunk_offset, end_chunk_offset, [&functor](auto it, auto end) {
+      for (; it != end; ++it) {
+        functor(*it);
+      }
+    });
+  }
+
  private:
   const Derived& _self() const { return static_cast<const Derived&>(*this); }
 };
@@ -77,6 +77,20 @@ class AnyColumnIterable : public PointAccessibleColumnIterable<AnyColumnIterable
     });
   }
 
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset,
+                          const Functor& functor) const {
+    _iterable._on_with_iterators(begin_chunk_offset, end_chunk_offset, [&functor](auto it, auto end) {
+      using ColumnIteratorValueT = typename std::iterator_traits<decltype(it)>::value_type;
+      using DataTypeT = typename ColumnIteratorValueT::Type;
+
+      auto any_it = AnyColumnIterator<DataTypeT>{it};
+      auto any_end = AnyColumnIterator<DataTypeT>{end};
+
+      functor(any_it, any_end);
+    });
+  }
+
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
     _iterable._on_with_iterators(mapped_chunk_offsets, [&functor](auto it, auto end) {
@@ -62,6 +62,15 @@ size_t DictionaryColumn<T>::estimate_memory_usage() const {
          _attribute_vector->data_size();
 }
 
+template <typename T>
+MemoryUsage DictionaryColumn<T>::memory_usage() const {
+  auto usage = MemoryUsage{};
+  usage.dictionaries = container_memory_usage(*_dictionary);
+  usage.attribute_vectors = _attribute_vector->data_size();
+  usage.metadata = sizeof(*this);
+  return usage;
+}
+
 template <typename T>
 CompressedVectorType DictionaryColumn<T>::compressed_vector_type() const {
   return _attribute_vector->type();
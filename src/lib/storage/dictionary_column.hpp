@@ -37,6 +37,8 @@ class DictionaryColumn : public BaseDictionaryColumn {
   std::shared_ptr<BaseColumn> copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const final;
 
   size_t estimate_memory_usage() const final;
+
+  MemoryUsage memory_usage() const final;
   /**@}*/
 
   /**
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/base_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Builds a DictionaryColumn from rows of existing DictionaryColumns
+ *
+ * Materializing operators (e.g., Sort) use this to keep their output dictionary-encoded instead of decoding the
+ * values into a ValueColumn. Only value ids are collected while appending. When building the column, the input
+ * dictionary is shared if all rows stem from the same dictionary. Otherwise, a new dictionary is created that only
+ * contains the distinct values that were actually appended.
+ *
+ * The builder holds on to the appended columns. Columns are identified by their shared_ptr and not by their address,
+ * which can be reused once a column is freed (e.g., when its chunk is evicted and reloaded).
+ */
+template <typename T>
+class DictionaryColumnBuilder {
+ public:
+  explicit DictionaryColumnBuilder(const size_t capacity = 0u) { _rows.reserve(capacity); }
+
+  /**
+   * Appends the value at chunk_offset of column. ReferenceColumns are resolved to the column they reference.
+   *
+   * @return false if the value is not stored in a DictionaryColumn<T>. Nothing is appended in that case.
+   */
+  bool append(const std::shared_ptr<const BaseColumn>& column, const ChunkOffset chunk_offset) {
+    if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+      const auto& row_id = (*reference_column->pos_list())[chunk_offset];
+      if (row_id.is_null()) {
+        append_null();
+        return true;
+      }
+
+      const auto referenced_chunk = reference_column->referenced_table()->get_chunk(row_id.chunk_id);
+      return append(referenced_chunk->get_column(reference_column->referenced_column_id()), row_id.chunk_offset);
+    }
+
+    const auto source_index = _source_index(column);
+    if (source_index == INVALID_SOURCE) return false;
+
+    auto& source = _sources[source_index];
+    const auto value_id = ValueID{source.decoder->get(chunk_offset)};
+    if (value_id == source.null_value_id) {
+      append_null();
+    } else {
+      _rows.emplace_back(source.dictionary_index, value_id);
+    }
+
+    return true;
+  }
+
+  void append_null() { _rows.emplace_back(INVALID_SOURCE, NULL_VALUE_ID); }
+
+  size_t size() const { return _rows.size(); }
+
+  std::shared_ptr<DictionaryColumn<T>> build() const {
+    auto attribute_vector = pmr_vector<uint32_t>{};
+    attribute_vector.reserve(_rows.size());
+
+    auto dictionary = std::shared_ptr<const pmr_vector<T>>{};
+
+    if (_dictionaries.size() <= 1u) {
+      // All values stem from the same dictionary (or all are NULL), so neither the dictionary nor the value ids change
+      dictionary = _dictionaries.empty() ? std::make_shared<pmr_vector<T>>() : _dictionaries.front();
+      const auto null_value_id = static_cast<uint32_t>(dictionary->size());
+      for (const auto& [dictionary_index, value_id] : _rows) {
+        attribute_vector.push_back(dictionary_index == INVALID_SOURCE ? null_value_id : value_id.t);
+      }
+    } else {
+      // Merge the referenced values of all dictionaries, copying each distinct value only once
+      auto used_value_ids = std::vector<std::vector<bool>>(_dictionaries.size());
+      for (auto dictionary_index = size_t{0}; dictionary_index < _dictionaries.size(); ++dictionary_index) {
+        used_value_ids[dictionary_index].resize(_dictionaries[dictionary_index]->size());
+      }
+      for (const auto& [dictionary_index, value_id] : _rows) {
+        if (dictionary_index != INVALID_SOURCE) used_value_ids[dictionary_index][value_id] = true;
+      }
+
+      auto used_values = std::vector<const T*>{};
+      for (auto dictionary_index = size_t{0}; dictionary_index < _dictionaries.size(); ++dictionary_index) {
+        const auto& input_dictionary = *_dictionaries[dictionary_index];
+        for (auto value_id = size_t{0}; value_id < input_dictionary.size(); ++value_id) {
+          if (used_value_ids[dictionary_index][value_id]) used_values.push_back(&input_dictionary[value_id]);
+        }
+      }
+
+      const auto less = [](const T* lhs, const T* rhs) { return *lhs < *rhs; };
+      const auto equal = [](const T* lhs, const T* rhs) { return *lhs == *rhs; };
+      std::sort(used_values.begin(), used_values.end(), less);
+      used_values.erase(std::unique(used_values.begin(), used_values.end(), equal), used_values.end());
+
+      auto merged_dictionary = std::make_shared<pmr_vector<T>>();
+      merged_dictionary->reserve(used_values.size());
+      for (const auto value : used_values) {
+        merged_dictionary->push_back(*value);
+      }
+
+      // Translate the value ids of each input dictionary into value ids of the merged dictionary
+      auto value_id_mappings = std::vector<std::vector<uint32_t>>(_dictionaries.size());
+      for (auto dictionary_index = size_t{0}; dictionary_index < _dictionaries.size(); ++dictionary_index) {
+        const auto& input_dictionary = *_dictionaries[dictionary_index];
+        auto& mapping = value_id_mappings[dictionary_index];
+        mapping.resize(input_dictionary.size());
+        for (auto value_id = size_t{0}; value_id < input_dictionary.size(); ++value_id) {
+          if (!used_value_ids[dictionary_index][value_id]) continue;
+          const auto it =
+              std::lower_bound(merged_dictionary->cbegin(), merged_dictionary->cend(), input_dictionary[value_id]);
+          mapping[value_id] = static_cast<uint32_t>(std::distance(merged_dictionary->cbegin(), it));
+        }
+      }
+
+      const auto null_value_id = static_cast<uint32_t>(merged_dictionary->size());
+      for (const auto& [dictionary_index, value_id] : _rows) {
+        attribute_vector.push_back(dictionary_index == INVALID_SOURCE ? null_value_id
+                                                                      : value_id_mappings[dictionary_index][value_id]);
+      }
+
+      dictionary = merged_dictionary;
+    }
+
+    // We need to increment the dictionary size here because of possible null values (see DictionaryEncoder).
+    const auto max_value = static_cast<uint32_t>(dictionary->size() + 1u);
+    auto compressed_attribute_vector = std::shared_ptr<const BaseCompressedVector>(
+        compress_vector(attribute_vector, VectorCompressionType::FixedSizeByteAligned,
+                        attribute_vector.get_allocator(), {max_value}));
+
+    return std::make_shared<DictionaryColumn<T>>(dictionary, compressed_attribute_vector,
+                                                 ValueID{static_cast<uint32_t>(dictionary->size())});
+  }
+
+ private:
+  static constexpr auto INVALID_SOURCE = std::numeric_limits<uint32_t>::max();
+
+  struct Source {
+    uint32_t dictionary_index;
+    ValueID null_value_id;
+    std::shared_ptr<const BaseColumn> column;
+    std::unique_ptr<BaseVectorDecompressor> decoder;
+  };
+
+  // Returns the index of the source for column in _sources or INVALID_SOURCE if it is not a DictionaryColumn<T>
+  uint32_t _source_index(const std::shared_ptr<const BaseColumn>& column) {
+    // Consecutive rows usually stem from the same column
+    if (column == _last_column) return _last_source_index;
+
+    auto source_index = INVALID_SOURCE;
+    const auto source_it = _source_index_by_column.find(column);
+    if (source_it != _source_index_by_column.end()) {
+      source_index = source_it->second;
+    } else if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(column)) {
+      const auto dictionary = dictionary_column->dictionary();
+      const auto dictionary_it = std::find(_dictionaries.cbegin(), _dictionaries.cend(), dictionary);
+      const auto dictionary_index = static_cast<uint32_t>(std::distance(_dictionaries.cbegin(), dictionary_it));
+      if (dictionary_it == _dictionaries.cend()) _dictionaries.push_back(dictionary);
+
+      source_index = static_cast<uint32_t>(_sources.size());
+      _sources.push_back(Source{dictionary_index, dictionary_column->null_value_id(), column,
+                                dictionary_column->attribute_vector()->create_base_decoder()});
+      _source_index_by_column.emplace(column, source_index);
+    }
+
+    _last_column = column;
+    _last_source_index = source_index;
+    return source_index;
+  }
+
+  // Pairs of index into _dictionaries (INVALID_SOURCE for NULL) and value id within that dictionary
+  std::vector<std::pair<uint32_t, ValueID>> _rows;
+
+  std::vector<std::shared_ptr<const pmr_vector<T>>> _dictionaries;
+  std::vector<Source> _sources;
+  std::unordered_map<std::shared_ptr<const BaseColumn>, uint32_t> _source_index_by_column;
+
+  std::shared_ptr<const BaseColumn> _last_column;
+  uint32_t _last_source_index = INVALID_SOURCE;
+};
+
+}  // namespace opossum
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/iterator/advance.hpp>
+
 #include <type_traits>
 
 #include "storage/column_iterables.hpp"
@@ -27,6 +29,26 @@ class DictionaryColumnIterable : public PointAccessibleColumnIterable<Dictionary
     });
   }
 
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset,
+                          const Functor& functor) const {
+    resolve_compressed_vector_type(*_column.attribute_vector(), [&](const auto& vector) {
+      using ZsIteratorType = decltype(vector.cbegin());
+
+      // Constant time for random access iterators, iterators of sequentially decoded vectors decode the skipped values
+      auto begin_attribute_it = vector.cbegin();
+      boost::iterators::advance(begin_attribute_it, begin_chunk_offset);
+      auto end_attribute_it = begin_attribute_it;
+      boost::iterators::advance(end_attribute_it, end_chunk_offset - begin_chunk_offset);
+
+      auto begin = Iterator<ZsIteratorType>{*_column.dictionary(), _column.null_value_id(), begin_attribute_it,
+                                            begin_chunk_offset};
+      auto end =
+          Iterator<ZsIteratorType>{*_column.dictionary(), _column.null_value_id(), end_attribute_it, end_chunk_offset};
+      functor(begin, end);
+    });
+  }
+
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
     resolve_compressed_vector_type(*_column.attribute_vector(), [&](const auto& vector) {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/iterator/advance.hpp>
+
 #include <type_traits>
 
 #include "storage/column_iterables.hpp"
@@ -20,7 +22,7 @@ class FrameOfReferenceIterable : public PointAccessibleColumnIterable<FrameOfRef
       using OffsetValueIteratorT = decltype(offset_values.cbegin());
 
       auto begin = Iterator<OffsetValueIteratorT>{_column.block_minima().cbegin(), offset_values.cbegin(),
-                                                  _column.null_values().cbegin()};
+                                                  _column.null_values().cbegin(), ChunkOffset{0u}};
 
       auto end = Iterator<OffsetValueIteratorT>{offset_values.cend()};
 
@@ -28,6 +30,30 @@ class FrameOfReferenceIterable : public PointAccessibleColumnIterable<FrameOfRef
     });
   }
 
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset,
+                          const Functor& functor) const {
+    resolve_compressed_vector_type(_column.offset_values(), [&](const auto& offset_values) {
+      using OffsetValueIteratorT = decltype(offset_values.cbegin());
+      static constexpr auto block_size = FrameOfReferenceColumn<T>::block_size;
+
+      // Constant time for random access iterators, iterators of sequentially decoded vectors decode the skipped values
+      auto begin_offset_value_it = offset_values.cbegin();
+      boost::iterators::advance(begin_offset_value_it, begin_chunk_offset);
+      auto end_offset_value_it = begin_offset_value_it;
+      boost::iterators::advance(end_offset_value_it, end_chunk_offset - begin_chunk_offset);
+
+      auto begin = Iterator<OffsetValueIteratorT>{_column.block_minima().cbegin() + begin_chunk_offset / block_size,
+                                                  begin_offset_value_it,
+                                                  _column.null_values().cbegin() + begin_chunk_offset,
+                                                  begin_chunk_offset};
+
+      auto end = Iterator<OffsetValueIteratorT>{end_offset_value_it};
+
+      functor(begin, end);
+    });
+  }
+
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
     resolve_compressed_vector_type(_column.offset_values(), [&](const auto& vector) {
@@ -54,17 +80,17 @@ class FrameOfReferenceIterable : public PointAccessibleColumnIterable<FrameOfRef
     using NullValueIterator = typename pmr_vector<bool>::const_iterator;
 
    public:
-    // Begin Iterator
+    // Begin Iterator, block_minimum_it points to the minimum of the block that contains chunk_offset
     explicit Iterator(ReferenceFrameIterator block_minimum_it, OffsetValueIteratorT offset_value_it,
-                      NullValueIterator null_value_it)
+                      NullValueIterator null_value_it, const ChunkOffset chunk_offset)
         : _block_minimum_it{block_minimum_it},
           _offset_value_it{offset_value_it},
           _null_value_it{null_value_it},
-          _index_within_frame{0u},
-          _chunk_offset{0u} {}
+          _index_within_frame{chunk_offset % FrameOfReferenceColumn<T>::block_size},
+          _chunk_offset{chunk_offset} {}
 
     // End iterator
-    explicit Iterator(OffsetValueIteratorT offset_value_it) : Iterator{{}, offset_value_it, {}} {}
+    explicit Iterator(OffsetValueIteratorT offset_value_it) : Iterator{{}, offset_value_it, {}, ChunkOffset{0u}} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
@@ -73,6 +73,16 @@ size_t FrameOfReferenceColumn<T, U>::estimate_memory_usage() const {
          _null_values.size() / bits_per_byte;
 }
 
+template <typename T, typename U>
+MemoryUsage FrameOfReferenceColumn<T, U>::memory_usage() const {
+  auto usage = MemoryUsage{};
+  usage.data = container_memory_usage(_block_minima);
+  usage.attribute_vectors = _offset_values->data_size();
+  usage.null_values = container_memory_usage(_null_values);
+  usage.metadata = sizeof(*this);
+  return usage;
+}
+
 template <typename T, typename U>
 EncodingType FrameOfReferenceColumn<T, U>::encoding_type() const {
   return EncodingType::FrameOfReference;
@@ -61,6 +61,8 @@ class FrameOfReferenceColumn : public BaseEncodedColumn {
 
   size_t estimate_memory_usage() const final;
 
+  MemoryUsage memory_usage() const final;
+
   /**@}*/
 
   /**
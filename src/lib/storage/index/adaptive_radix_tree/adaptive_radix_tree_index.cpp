@@ -4,12 +4,14 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 #include <vector>
 
 #include "adaptive_radix_tree_nodes.hpp"
 #include "storage/base_dictionary_column.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/memory_usage.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -22,20 +24,37 @@ AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr
   DebugAssert(static_cast<bool>(_index_column), "AdaptiveRadixTree only works with dictionary columns for now");
   DebugAssert((index_columns.size() == 1), "AdaptiveRadixTree only works with a single column");
 
-  // For each value ID in the attribute vector, create a pair consisting of a BinaryComparable of
-  // this value ID and its ChunkOffset (needed for bulk-inserting).
-  std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
-  pairs_to_insert.reserve(_index_column->attribute_vector()->size());
+  // Sort the ChunkOffsets by their ValueIDs using a counting sort. NULL values have the largest ValueID.
+  const auto& attribute_vector = *_index_column->attribute_vector();
+  const auto value_id_count = static_cast<size_t>(_index_column->null_value_id()) + 1u;
 
-  resolve_compressed_vector_type(*_index_column->attribute_vector(), [&](const auto& attribute_vector) {
+  // positions[value_id] is the position of the first ChunkOffset of value_id in _chunk_offsets
+  auto positions = std::vector<uint32_t>(value_id_count + 1u, 0u);
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& typed_attribute_vector) {
+    for (auto value_id_it = typed_attribute_vector.cbegin(); value_id_it != typed_attribute_vector.cend();
+         ++value_id_it) {
+      ++positions[*value_id_it + 1u];
+    }
+  });
+  std::partial_sum(positions.begin(), positions.end(), positions.begin());
+
+  _chunk_offsets.resize(attribute_vector.size());
+  auto next_positions = positions;
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& typed_attribute_vector) {
     auto chunk_offset = ChunkOffset{0u};
-    auto value_id_it = attribute_vector.cbegin();
-    for (; value_id_it != attribute_vector.cend(); ++value_id_it, ++chunk_offset) {
-      pairs_to_insert.emplace_back(BinaryComparable(ValueID{*value_id_it}), chunk_offset);
+    auto value_id_it = typed_attribute_vector.cbegin();
+    for (; value_id_it != typed_attribute_vector.cend(); ++value_id_it, ++chunk_offset) {
+      _chunk_offsets[next_positions[*value_id_it]++] = chunk_offset;
     }
   });
 
-  _root = _bulk_insert(pairs_to_insert);
+  auto leaves = std::vector<std::pair<ValueID, ARTNodeReference>>{};
+  for (auto value_id = ValueID{0u}; value_id < value_id_count; ++value_id) {
+    if (positions[value_id] == positions[value_id + 1u]) continue;
+    leaves.emplace_back(value_id, _nodes.add_leaf(value_id, positions[value_id], positions[value_id + 1u]));
+  }
+
+  _root = _build_tree(std::move(leaves));
 }
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
@@ -44,7 +63,7 @@ BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTy
   if (valueID == INVALID_VALUE_ID) {
     return _chunk_offsets.end();
   }
-  return _root->lower_bound(BinaryComparable(valueID), 0);
+  return _chunk_offsets.cbegin() + _lower_bound_position(valueID);
 }
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
@@ -53,7 +72,7 @@ BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTy
   if (valueID == INVALID_VALUE_ID) {
     return _chunk_offsets.end();
   } else {
-    return _root->lower_bound(BinaryComparable(valueID), 0);
+    return _chunk_offsets.cbegin() + _lower_bound_position(valueID);
   }
 }
 
@@ -61,70 +80,91 @@ BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offs
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const { return _chunk_offsets.cend(); }
 
-std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
-    const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values) {
-  DebugAssert(!(values.empty()), "Index on empty column is not defined");
-  _chunk_offsets.reserve(values.size());
-  Iterator begin = _chunk_offsets.cbegin();
-  return _bulk_insert(values, static_cast<size_t>(0u), begin);
-}
-
-std::shared_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(
-    const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values, size_t depth, BaseIndex::Iterator& it) {
-  // This is the anchor of the recursion: if all values have the same key, create a leaf.
-  if (std::all_of(values.begin(), values.end(), [&values](const std::pair<BinaryComparable, ChunkOffset>& pair) {
-        return values.front().first == pair.first;
-      })) {
-    // copy the Iterator in the _chunk_offsets - vector --> this is the lower_bound of the leaf
-    Iterator lower = it;
-    // insert the ChunkOffsets into the vector and push the Iterator further
-    auto old_capacity = _chunk_offsets.capacity();
-    for (const auto& pair : values) {
-      _chunk_offsets.emplace_back(pair.second);
-    }
-    std::advance(it, values.size());
-    auto new_capacity = _chunk_offsets.capacity();
-    // we are not allowed to change the size of the vector as it would invalidate all our Iterators
-    Assert(old_capacity == new_capacity, "_chunk_offsets capacity changes, all Iterators are invalidated");
-
-    // "it" points to the position after the last inserted ChunkOffset --> this is the upper_bound of the leave
-    Iterator upper = it;
-    return std::make_shared<Leaf>(lower, upper);
-  }
-
-  // radix-partition on the depths-byte into 256 partitions
-  std::array<std::vector<std::pair<BinaryComparable, ChunkOffset>>, std::numeric_limits<uint8_t>::max() + 1> partitions;
-  for (const auto& pair : values) {
-    partitions[pair.first[depth]].emplace_back(pair);
+/**
+ * Descends the tree along the partial keys of value_id. If a node does not have a child for the partial key, the
+ * result is the beginning of the next larger child's subtree or, if there is none, the end of the node's subtree.
+ *
+ *                          04 | 06 | 07 | 08
+ *                           |    |    |    |
+ *                   |-------|    |    |    |---------|
+ *                   |            |    |              |
+ *        01| 02 |ff|ff  01|02|03|04  06|07|bb|ff    00|a2|b7|fe
+ *         |  |    |      |  |  |  |   |  |  |        |  |  |  |
+ *
+ * case0: partial_key (e.g. 06) matches a child of the node -> descend into the child
+ * case1: partial_key (e.g. 09) is larger than any partial key in the node -> end of the node's subtree
+ * case2: partial_key (e.g. 05) is not contained, but smaller than a partial key in the node -> beginning of the next
+ *        larger child's subtree (e.g. 06)
+ */
+size_t AdaptiveRadixTreeIndex::_lower_bound_position(const ValueID value_id) const {
+  const auto key = BinaryComparable(value_id);
+
+  auto node = _root;
+  for (auto depth = size_t{0}; node.type() != ARTNodeType::Leaf; ++depth) {
+    const auto partial_key_and_child = _nodes.find_child(node, key[depth]);
+    const auto& child = partial_key_and_child.second;
+
+    if (!child.is_valid()) return _nodes.end(node);                             // case1
+    if (partial_key_and_child.first != key[depth]) return _nodes.begin(child);  // case2
+    node = child;                                                               // case0
   }
 
-  // call recursively for each non-empty partition and gather the children
-  std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>> children;
+  // Leaves can be located above the maximum depth, so the remaining bytes of the key might differ from the leaf's
+  const auto& leaf = _nodes.leaf(node);
+  return value_id <= leaf.value_id ? leaf.begin : leaf.end;
+}
 
-  for (uint16_t partition_id = 0; partition_id < partitions.size(); ++partition_id) {
-    if (!partitions[partition_id].empty()) {
-      auto child =
-          std::make_pair(static_cast<uint8_t>(partition_id), _bulk_insert(partitions[partition_id], depth + 1, it));
-      children.emplace_back(std::move(child));
+ARTNodeReference AdaptiveRadixTreeIndex::_build_tree(std::vector<std::pair<ValueID, ARTNodeReference>> leaves) {
+  DebugAssert(!(leaves.empty()), "Index on empty column is not defined");
+
+  const auto key_bits = [](const ValueID value_id) { return static_cast<uint64_t>(value_id.t); };
+
+  // Starting with the least significant byte of the keys, all nodes whose keys only differ in the current byte are
+  // grouped into a new parent node. A single leaf is passed on to the next level instead of getting a parent of its
+  // own, so that each subtree containing only one key is represented by a leaf.
+  auto nodes = std::move(leaves);
+  auto children = std::vector<std::pair<uint8_t, ARTNodeReference>>{};
+  for (auto depth = sizeof(ValueID); depth-- > 0;) {
+    const auto partial_key_shift = 8u * (sizeof(ValueID) - depth - 1u);
+    const auto prefix_shift = partial_key_shift + 8u;
+
+    auto parents = std::vector<std::pair<ValueID, ARTNodeReference>>{};
+    for (auto group_begin = size_t{0}; group_begin < nodes.size();) {
+      const auto prefix = key_bits(nodes[group_begin].first) >> prefix_shift;
+
+      auto group_end = group_begin + 1u;
+      while (group_end < nodes.size() && key_bits(nodes[group_end].first) >> prefix_shift == prefix) ++group_end;
+
+      if (group_end - group_begin == 1u && nodes[group_begin].second.type() == ARTNodeType::Leaf) {
+        parents.emplace_back(nodes[group_begin]);
+      } else {
+        children.clear();
+        for (auto node_id = group_begin; node_id < group_end; ++node_id) {
+          const auto partial_key = static_cast<uint8_t>((key_bits(nodes[node_id].first) >> partial_key_shift) & 0xFF);
+          children.emplace_back(partial_key, nodes[node_id].second);
+        }
+        parents.emplace_back(nodes[group_begin].first, _nodes.add_node(children));
+      }
+
+      group_begin = group_end;
     }
+    nodes = std::move(parents);
   }
-  // finally create the appropriate ARTNode according to the size of the children
-  if (children.size() <= 4) {
-    return std::make_shared<ARTNode4>(children);
-  } else if (children.size() <= 16) {
-    return std::make_shared<ARTNode16>(children);
-  } else if (children.size() <= 48) {
-    return std::make_shared<ARTNode48>(children);
-  } else {
-    return std::make_shared<ARTNode256>(children);
-  }
+
+  DebugAssert(nodes.size() == 1u, "Tree must have exactly one root");
+  _nodes.shrink_to_fit();
+  return nodes.front().second;
 }
 
 std::vector<std::shared_ptr<const BaseColumn>> AdaptiveRadixTreeIndex::_get_index_columns() const {
   return {_index_column};
 }
 
-AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) : _parts(sizeof(value)) {
+size_t AdaptiveRadixTreeIndex::_memory_consumption() const {
+  return sizeof(*this) + container_memory_usage(_chunk_offsets) + _nodes.memory_consumption();
+}
+
+AdaptiveRadixTreeIndex::BinaryComparable::BinaryComparable(ValueID value) {
   for (size_t byte_id = 1; byte_id <= _parts.size(); ++byte_id) {
     // grab the 8 least significant bits and put them at the front of the vector
     _parts[_parts.size() - byte_id] = static_cast<uint8_t>(value & 0xFF);
@@ -1,17 +1,18 @@
 #pragma once
 
+#include <array>
 #include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "adaptive_radix_tree_nodes.hpp"
 #include "storage/index/base_index.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 class BaseColumn;
-class ARTNode;
 class BaseDictionaryColumn;
 
 /**
@@ -21,8 +22,12 @@ class BaseDictionaryColumn;
  * is compared.
  * In order to store the partial keys, it uses 4 different node-types, which can hold up to 4, 16, 48 and 256 partial
  * keys respectively.
- * Each node has an array which contains pointers to its children and (if needed) an index array in order to map
- * partial keys to positions in the array of the child-pointers
+ * Each node has an array which contains references to its children and (if needed) an index array in order to map
+ * partial keys to positions in the array of the child-references
+ *
+ * The nodes are stored in an ARTNodeArena and reference each other with 32-bit offsets instead of pointers (see
+ * adaptive_radix_tree_nodes.hpp). The tree is built bottom-up: The ChunkOffsets are sorted by their ValueIDs using a
+ * counting sort, each ValueID gets a leaf, and the leaves are then grouped level by level into inner nodes.
  *
  * The full specification of an ART can be found in the following paper: https://db.in.tum.de/~leis/papers/ART.pdf
  *
@@ -32,7 +37,11 @@ class BaseDictionaryColumn;
 class AdaptiveRadixTreeIndex : public BaseIndex {
   friend class AdaptiveRadixTreeIndexTest;
 
-  friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
+  friend class AdaptiveRadixTreeIndexTest_BuildTree_Test;
+
+  friend class AdaptiveRadixTreeIndexTest_LowerBoundPosition_Test;
+
+  friend class AdaptiveRadixTreeIndexTest_NodeTypes_Test;
 
   friend class AdaptiveRadixTreeIndexTest_BinaryComparableFromChunkOffset_Test;
 
@@ -62,7 +71,7 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
     uint8_t operator[](size_t position) const;
 
    private:
-    std::vector<uint8_t> _parts;
+    std::array<uint8_t, sizeof(ValueID)> _parts;
   };
 
  private:
@@ -74,16 +83,20 @@ class AdaptiveRadixTreeIndex : public BaseIndex {
 
   Iterator _cend() const final;
 
-  std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values);
+  // Returns the position of the first ChunkOffset in _chunk_offsets whose ValueID is not less than value_id
+  size_t _lower_bound_position(const ValueID value_id) const;
 
-  std::shared_ptr<ARTNode> _bulk_insert(const std::vector<std::pair<BinaryComparable, ChunkOffset>>& values,
-                                        size_t depth, Iterator& it);
+  // Builds the tree bottom-up from leaves sorted by their ValueIDs
+  ARTNodeReference _build_tree(std::vector<std::pair<ValueID, ARTNodeReference>> leaves);
 
   std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const;
 
+  size_t _memory_consumption() const;
+
   const std::shared_ptr<const BaseDictionaryColumn> _index_column;
   std::vector<ChunkOffset> _chunk_offsets;
-  std::shared_ptr<ARTNode> _root;
+  ARTNodeArena _nodes;
+  ARTNodeReference _root;
 };
 
 bool operator==(const AdaptiveRadixTreeIndex::BinaryComparable& left,
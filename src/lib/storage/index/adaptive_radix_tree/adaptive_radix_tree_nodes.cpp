@@ -1,13 +1,11 @@
 #include "adaptive_radix_tree_nodes.hpp"
 
 #include <algorithm>
-#include <iterator>
-#include <memory>
+#include <array>
 #include <utility>
 #include <vector>
 
-#include "adaptive_radix_tree_index.hpp"
-#include "storage/index/base_index.hpp"
+#include "storage/memory_usage.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -15,380 +13,190 @@ namespace opossum {
 
 static const uint8_t INVALID_INDEX = 255u;
 
-/**
- *
- * ARTNode4 has two arrays of length 4:
- *  - _partial_keys stores the contained partial_keys of its children
- *  - _children stores pointers to the children
- * _partial_key[i] is the partial_key for child _children[i]
- * default value of the _partial_keys array is 255u
- */
-
-ARTNode4::ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
-  std::sort(children.begin(), children.end(),
-            [](const std::pair<uint8_t, std::shared_ptr<ARTNode>>& left,
-               const std::pair<uint8_t, std::shared_ptr<ARTNode>>& right) { return left.first < right.first; });
-  _partial_keys.fill(INVALID_INDEX);
-  for (uint8_t i = 0u; i < children.size(); ++i) {
-    _partial_keys[i] = children[i].first;
-    _children[i] = children[i].second;
-  }
+ARTNodeReference::ARTNodeReference(const ARTNodeType type, const uint32_t index)
+    : _value((static_cast<uint32_t>(type) << INDEX_BITS) | index) {
+  DebugAssert(index <= MAX_INDEX, "Too many ART nodes");
 }
 
-/**
- *
- * searches the child that satisfies the query (lower_bound/ upper_bound + partial_key)
- * calls the appropriate function on the child
- * in case the partial_key is not contained in this node, the query has to be adapted
- *
- *                          04 | 06 | 07 | 08
- *                           |    |    |    |
- *                   |-------|    |    |    |---------|
- *                   |            |    |              |
- *        01| 02 |ff|ff  01|02|03|04  06|07|bb|ff    00|a2|b7|fe
- *         |  |    |      |  |  |  |   |  |  |        |  |  |  |
- *
- * case0:  partial_key (e.g. 06) matches a value in the node
- *           call the query-function on the child at the matching position
- * case1a: partial_key (e.g. 09) is larger than any value in the node which is full
- *           call this->end() which calls end() on the last child
- * case1b: partial_key (e.g. e0 in child at 07) is larger than any value in the node which is not full (last ff does
- *              not have a matching child, it simply is the default value)
- *          call this->end() which calls end() on the last child
- * case2:  partial_key (e.g. 05) is not contained, but smaller than a value in the node
- *           call begin() on the next larger child (e.g. 06)
- **/
-
-BaseIndex::Iterator ARTNode4::_delegate_to_child(
-    const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-    std::function<Iterator(size_t, const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)> function_to_delegate)
-    const {
-  auto partial_key = key[depth];
-  for (uint8_t partial_key_id = 0; partial_key_id < 4; ++partial_key_id) {
-    if (_partial_keys[partial_key_id] < partial_key) continue;  // key not found yet
-    if (_partial_keys[partial_key_id] == partial_key)
-      return function_to_delegate(partial_key_id, key, ++depth);  // case0
-    if (_children[partial_key_id] == nullptr) return end();       // no more keys available, case1b
-    return _children[partial_key_id]->begin();                    // case2
-  }
-  return end();  // case1a
-}
+ARTNodeType ARTNodeReference::type() const { return static_cast<ARTNodeType>(_value >> INDEX_BITS); }
 
-BaseIndex::Iterator ARTNode4::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth, [this](size_t i, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-    return _children[i]->lower_bound(key, depth);
-  });
-}
+uint32_t ARTNodeReference::index() const { return _value & MAX_INDEX; }
 
-BaseIndex::Iterator ARTNode4::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth, [this](size_t i, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-    return _children[i]->upper_bound(key, depth);
-  });
-}
+bool ARTNodeReference::is_valid() const { return _value != std::numeric_limits<uint32_t>::max(); }
 
-BaseIndex::Iterator ARTNode4::begin() const { return _children[0]->begin(); }
+bool ARTNodeReference::operator==(const ARTNodeReference& other) const { return _value == other._value; }
 
-BaseIndex::Iterator ARTNode4::end() const {
-  for (uint8_t i = 4; i > 0; --i) {
-    if (_children[i - 1] != nullptr) {
-      return _children[i - 1]->end();
-    }
-  }
-  Fail("Empty _children array in ARTNode4 should never happen");
-}
-
-/**
- *
- * ARTNode16 has two arrays of length 16, very similar to ARTNode4:
- *  - _partial_keys stores the contained partial_keys of its children
- *  - _children stores pointers to the children
- * _partial_key[i] is the partial_key for child _children[i]
- * default value of the _partial_keys array is 255u
- *
- */
+bool ARTNodeReference::operator!=(const ARTNodeReference& other) const { return _value != other._value; }
 
-ARTNode16::ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
-  std::sort(children.begin(), children.end(),
-            [](const std::pair<uint8_t, std::shared_ptr<ARTNode>>& left,
-               const std::pair<uint8_t, std::shared_ptr<ARTNode>>& right) { return left.first < right.first; });
-  _partial_keys.fill(INVALID_INDEX);
-  for (uint8_t i = 0u; i < children.size(); ++i) {
-    _partial_keys[i] = children[i].first;
-    _children[i] = children[i].second;
-  }
-}
-
-/**
- * searches the child that satisfies the query (lower_bound/ upper_bound + partial_key)
- * calls the appropriate function on the child
- * in case the partial_key is not contained in this node, the query has to be adapted
- *
- *                          04|..|06 |07|..|e2
- *                           |    |    |    |
- *                   |-------|    |    |    |---------|
- *                   |            |    |              |
- *        01| 02 |ff|ff  01|02|03|04  06|07|bb|ff    00|a2|b7|..|fa|ff|ff
- *                                                    |  |  | ||  |
- *
- * case0:  partial_key (e.g. 06) matches a value in the node
- *           call the query-function on the child at the matching position
- * case1a: partial_key (e.g. fa) is larger than any value in the node which is full
- *           call this->end() which calls end() on the last child
- * case1b: partial_key (e.g. fb in child at e2) is larger than any value in the node which is not full (ffs do
- *              not have matching children in this example, it simply is the default value)
- *          call this->end() which calls end() on the last child
- * case2:  partial_key (e.g. 05) is not contained, but smaller than a value in the node
- *           call begin() on the next larger child (e.g. 06)
- **/
-
-BaseIndex::Iterator ARTNode16::_delegate_to_child(
-    const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-    std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type,
-                           const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>
-        function) const {
-  auto partial_key = key[depth];
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), partial_key);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
-
-  if (*partial_key_iterator == partial_key) {
-    return function(partial_key_pos, key, ++depth);  // case0
-  }
-  if (partial_key_pos >= 16) {
-    return end();  // case 1a
-  }
-  if (_children[partial_key_pos] != nullptr) {
-    return _children[partial_key_pos]->begin();  // case2
-  }
-  return end();  // case1b
+template <typename Node>
+ARTNodeReference ARTNodeArena::_add(std::vector<Node>& nodes, const ARTNodeType type, const Node& node) {
+  Assert(nodes.size() <= ARTNodeReference::MAX_INDEX, "Too many ART nodes");
+  nodes.push_back(node);
+  return ARTNodeReference{type, static_cast<uint32_t>(nodes.size() - 1)};
 }
 
-BaseIndex::Iterator ARTNode16::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(
-      key, depth, [this](std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type partial_key_pos,
-                         AdaptiveRadixTreeIndex::BinaryComparable key,
-                         size_t depth) { return _children[partial_key_pos]->lower_bound(key, depth); });
+ARTNodeReference ARTNodeArena::add_leaf(const ValueID value_id, const uint32_t begin, const uint32_t end) {
+  return _add(_leaves, ARTNodeType::Leaf, ARTLeaf{value_id, begin, end});
 }
 
-BaseIndex::Iterator ARTNode16::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(
-      key, depth, [this](std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type partial_key_pos,
-                         AdaptiveRadixTreeIndex::BinaryComparable key,
-                         size_t depth) { return _children[partial_key_pos]->upper_bound(key, depth); });
-}
-
-BaseIndex::Iterator ARTNode16::begin() const { return _children[0]->begin(); }
+ARTNodeReference ARTNodeArena::add_node(const std::vector<std::pair<uint8_t, ARTNodeReference>>& children) {
+  DebugAssert(!children.empty() && children.size() <= 256u, "Invalid number of children");
+  DebugAssert(std::is_sorted(children.begin(), children.end(),
+                             [](const auto& left, const auto& right) { return left.first < right.first; }),
+              "Children have to be sorted by their partial keys");
 
-/**
- * _end searches the child with the largest partial key == the last child in the _children array.
- * As the _partial_keys array is filled with 255u per default, we expect the largest child at the index right in front
- * of the first entry with 255u. But 255u can also be a valid partial_key: In this case the _children array contains a
- * pointer at this index as a means to differentiate the two cases.
- */
+  const auto begin = this->begin(children.front().second);
+  const auto end = this->end(children.back().second);
 
-BaseIndex::Iterator ARTNode16::end() const {
-  auto partial_key_iterator = std::lower_bound(_partial_keys.begin(), _partial_keys.end(), INVALID_INDEX);
-  auto partial_key_pos = std::distance(_partial_keys.begin(), partial_key_iterator);
-  if (_children[partial_key_pos] == nullptr) {
-    // there does not exist a child with partial_key 255u, we take the partial_key in front of it
-    return _children[partial_key_pos - 1]->end();
-  } else {
-    // there exists a child with partial_key 255u
-    return _children[partial_key_pos]->end();
+  const auto add_sorted_node = [&](auto& nodes, const ARTNodeType type) {
+    auto node = typename std::decay_t<decltype(nodes)>::value_type{};
+    node.begin = begin;
+    node.end = end;
+    node.child_count = static_cast<uint8_t>(children.size());
+    node.partial_keys.fill(INVALID_INDEX);
+    for (auto child_id = size_t{0}; child_id < children.size(); ++child_id) {
+      node.partial_keys[child_id] = children[child_id].first;
+      node.children[child_id] = children[child_id].second;
+    }
+    return _add(nodes, type, node);
+  };
+
+  if (children.size() <= 4) return add_sorted_node(_nodes4, ARTNodeType::Node4);
+  if (children.size() <= 16) return add_sorted_node(_nodes16, ARTNodeType::Node16);
+
+  if (children.size() <= 48) {
+    auto node = ARTNode48{};
+    node.begin = begin;
+    node.end = end;
+    node.index_to_child.fill(INVALID_INDEX);
+    for (auto child_id = size_t{0}; child_id < children.size(); ++child_id) {
+      node.index_to_child[children[child_id].first] = static_cast<uint8_t>(child_id);
+      node.children[child_id] = children[child_id].second;
+    }
+    return _add(_nodes48, ARTNodeType::Node48, node);
   }
-}
 
-/**
- *
- * ARTNode48 has two arrays:
- *  - _index_to_child of length 256 that can be directly addressed
- *  - _children of length 48 stores pointers to the children
- * _index_to_child[partial_key] stores the index for the child in _children
- * default value of the _index_to_child array is 255u. This is safe as the maximum value set in _index_to_child will be
- * 47 as this is the maximum index for _children.
- */
-
-ARTNode48::ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
-  _index_to_child.fill(INVALID_INDEX);
-  for (uint8_t i = 0u; i < children.size(); ++i) {
-    _index_to_child[children[i].first] = i;
-    _children[i] = children[i].second;
+  auto node = ARTNode256{};
+  node.begin = begin;
+  node.end = end;
+  for (const auto& [partial_key, child] : children) {
+    node.children[partial_key] = child;
   }
+  return _add(_nodes256, ARTNodeType::Node256, node);
 }
 
 /**
- * searches the child that satisfies the query (lower_bound/ upper_bound + partial_key)
- * calls the appropriate function on the child
- * in case the partial_key is not contained in this node, the query has to be adapted
- *
- * _index_to_child:
- *      00|01|02|03|04|05|06|07|08|09|0a|...| fd |fe|ff|  index
- *      ff|ff|00|ff|ff|01|02|03|ff|04|ff|...|0x30|ff|ff|  value
- *
- * _children
- *      00|01|02|03|04|05|06|07|08|09|0a|...|0x30|
- *       |  |  |  |  |  |  |  |  |  |  | |||  |
- *
- *
- * case0:  partial_key (e.g. 05) matches a value in the node
- *           call the query-function on _children[_index_to_child[partial_key]
- * case1: partial_key (e.g. fe) is larger than any value in the node
- *           call this->end() which calls end() on the last child
- * case2:  partial_key (e.g. 04) is not contained, but smaller than a value in the node
- *           call begin() on the next larger child (e.g. 05)
- *
- * In order to find the next larger/ last child, we have to iterate through the _index_to_child array
- * This is expensive as the array is sparsely populated (at max 48 entries).
- * For the moment, all entries in _children are sorted, as we only bulk_insert records, so we could just iterate through
- * _children instead.
- * But this sorting is not necessarily the case when inserting is allowed (_index_to_child[new_partial_key] would get
- * the largest free index in _children).
- * For future safety, we decided against this more efficient implementation.
- *
- **/
-
-BaseIndex::Iterator ARTNode48::_delegate_to_child(
-    const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-    std::function<Iterator(uint8_t, const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)> function) const {
-  auto partial_key = key[depth];
-  if (_index_to_child[partial_key] != INVALID_INDEX) {
-    // case0
-    return function(partial_key, key, ++depth);
-  }
-  for (uint16_t i = partial_key + 1; i < 256u; ++i) {
-    if (_index_to_child[i] != INVALID_INDEX) {
-      // case2
-      return _children[_index_to_child[i]]->begin();
+ * The sorted partial keys of ARTNode4 and ARTNode16 are binary searched. ARTNode48 and ARTNode256 are directly
+ * addressed with the partial key. If there is no child for it, the next larger child is searched for by iterating
+ * through the arrays.
+ */
+std::pair<uint8_t, ARTNodeReference> ARTNodeArena::find_child(const ARTNodeReference node,
+                                                              const uint8_t partial_key) const {
+  const auto find_in_sorted_node = [&](const auto& sorted_node) -> std::pair<uint8_t, ARTNodeReference> {
+    const auto keys_end = sorted_node.partial_keys.begin() + sorted_node.child_count;
+    const auto it = std::lower_bound(sorted_node.partial_keys.begin(), keys_end, partial_key);
+    if (it == keys_end) return {};
+    return {*it, sorted_node.children[std::distance(sorted_node.partial_keys.begin(), it)]};
+  };
+
+  switch (node.type()) {
+    case ARTNodeType::Node4:
+      return find_in_sorted_node(node4(node));
+
+    case ARTNodeType::Node16:
+      return find_in_sorted_node(node16(node));
+
+    case ARTNodeType::Node48: {
+      const auto& node48 = this->node48(node);
+      for (auto key = uint16_t{partial_key}; key < 256u; ++key) {
+        if (node48.index_to_child[key] != INVALID_INDEX) {
+          return {static_cast<uint8_t>(key), node48.children[node48.index_to_child[key]]};
+        }
+      }
+      return {};
     }
-  }
-  // case1
-  return end();
-}
 
-BaseIndex::Iterator ARTNode48::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth,
-                            [this](uint8_t partial_key, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-                              return _children[_index_to_child[partial_key]]->lower_bound(key, depth);
-                            });
-}
-
-BaseIndex::Iterator ARTNode48::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth,
-                            [this](uint8_t partial_key, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-                              return _children[_index_to_child[partial_key]]->upper_bound(key, depth);
-                            });
-}
-
-BaseIndex::Iterator ARTNode48::begin() const {
-  for (uint8_t i = 0; i < _index_to_child.size(); ++i) {
-    if (_index_to_child[i] != INVALID_INDEX) {
-      return _children[_index_to_child[i]]->begin();
+    case ARTNodeType::Node256: {
+      const auto& node256 = this->node256(node);
+      for (auto key = uint16_t{partial_key}; key < 256u; ++key) {
+        if (node256.children[key].is_valid()) return {static_cast<uint8_t>(key), node256.children[key]};
+      }
+      return {};
     }
-  }
-  Fail("Empty _index_to_child array in ARTNode48 should never happen");
-}
 
-BaseIndex::Iterator ARTNode48::end() const {
-  for (uint8_t i = _index_to_child.size() - 1; i > 0; --i) {
-    if (_index_to_child[i] != INVALID_INDEX) {
-      return _children[_index_to_child[i]]->begin();
-    }
+    default:
+      Fail("Leaves do not have children");
   }
-  Fail("Empty _index_to_child array in ARTNode48 should never happen");
 }
 
-/**
- *
- * ARTNode256 has only one array: _children; which stores pointers to the children and can be directly addressed.
- *
- */
-
-ARTNode256::ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children) {
-  for (uint16_t i = 0; i < children.size(); ++i) {
-    _children[children[i].first] = children[i].second;
+uint32_t ARTNodeArena::begin(const ARTNodeReference node) const {
+  switch (node.type()) {
+    case ARTNodeType::Leaf:
+      return leaf(node).begin;
+    case ARTNodeType::Node4:
+      return node4(node).begin;
+    case ARTNodeType::Node16:
+      return node16(node).begin;
+    case ARTNodeType::Node48:
+      return node48(node).begin;
+    case ARTNodeType::Node256:
+      return node256(node).begin;
   }
+  Fail("Invalid ARTNodeType");
 }
 
-/**
- * searches the child that satisfies the query (lower_bound/ upper_bound + partial_key)
- * calls the appropriate function on the child
- * in case the partial_key is not contained in this node, the query has to be adapted
- *
- *
- * _children
- *      00|01|02|03|04|05|06|07|08|09|0a|...|fd|fe|ff|
- *       |  |  |  |        |     |     | |||  |
- *
- *
- * case0:  _children[partial_key] (e.g. 03) contains a pointer to a child
- *           call the query-function on _children[partial_key]
- * case1: _children[partial_key] (e.g. fe) does contain a nullptr and so does every position afterwards
- *           call this->end() which calls end() on the last child (fd)
- * case2:  _children[partial_key] (e.g. 04)  does contain a nullptr, but there are valid pointers to children afterwards
- *           call begin() on the next larger child (e.g. 06)
- *
- * In order to find the next larger/ last child, we have to iterate through the _children array
- * This is not as expensive as for ARTNode48 as the array has > 48 entries
- *
- **/
-
-BaseIndex::Iterator ARTNode256::_delegate_to_child(
-    const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-    std::function<Iterator(uint8_t, AdaptiveRadixTreeIndex::BinaryComparable, size_t)> function) const {
-  auto partial_key = key[depth];
-  if (_children[partial_key] != nullptr) {
-    // case0
-    return function(partial_key, key, ++depth);
+uint32_t ARTNodeArena::end(const ARTNodeReference node) const {
+  switch (node.type()) {
+    case ARTNodeType::Leaf:
+      return leaf(node).end;
+    case ARTNodeType::Node4:
+      return node4(node).end;
+    case ARTNodeType::Node16:
+      return node16(node).end;
+    case ARTNodeType::Node48:
+      return node48(node).end;
+    case ARTNodeType::Node256:
+      return node256(node).end;
   }
-  for (uint16_t i = partial_key + 1; i < 256u; ++i) {
-    if (_children[i] != nullptr) {
-      // case2
-      return _children[i]->begin();
-    }
-  }
-  // case1
-  return end();
+  Fail("Invalid ARTNodeType");
 }
 
-BaseIndex::Iterator ARTNode256::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth,
-                            [this](uint8_t partial_key, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-                              return _children[partial_key]->upper_bound(key, depth);
-                            });
+const ARTLeaf& ARTNodeArena::leaf(const ARTNodeReference node) const {
+  DebugAssert(node.type() == ARTNodeType::Leaf, "Node is not a Leaf");
+  return _leaves[node.index()];
 }
 
-BaseIndex::Iterator ARTNode256::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const {
-  return _delegate_to_child(key, depth,
-                            [this](uint8_t partial_key, AdaptiveRadixTreeIndex::BinaryComparable key, size_t depth) {
-                              return _children[partial_key]->lower_bound(key, depth);
-                            });
+const ARTNode4& ARTNodeArena::node4(const ARTNodeReference node) const {
+  DebugAssert(node.type() == ARTNodeType::Node4, "Node is not an ARTNode4");
+  return _nodes4[node.index()];
 }
 
-BaseIndex::Iterator ARTNode256::begin() const {
-  for (uint8_t i = 0u; i < _children.size(); ++i) {
-    if (_children[i] != nullptr) {
-      return _children[i]->begin();
-    }
-  }
-  Fail("Empty _children array in ARTNode256 should never happen");
+const ARTNode16& ARTNodeArena::node16(const ARTNodeReference node) const {
+  DebugAssert(node.type() == ARTNodeType::Node16, "Node is not an ARTNode16");
+  return _nodes16[node.index()];
 }
 
-BaseIndex::Iterator ARTNode256::end() const {
-  for (int16_t i = _children.size() - 1; i >= 0; --i) {
-    if (_children[i] != nullptr) {
-      return _children[i]->begin();
-    }
-  }
-  Fail("Empty _children array in ARTNode256 should never happen");
+const ARTNode48& ARTNodeArena::node48(const ARTNodeReference node) const {
+  DebugAssert(node.type() == ARTNodeType::Node48, "Node is not an ARTNode48");
+  return _nodes48[node.index()];
 }
 
-Leaf::Leaf(BaseIndex::Iterator& lower, BaseIndex::Iterator& upper) : _begin(lower), _end(upper) {}
-
-BaseIndex::Iterator Leaf::lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const { return _begin; }
-
-BaseIndex::Iterator Leaf::upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const { return _end; }
+const ARTNode256& ARTNodeArena::node256(const ARTNodeReference node) const {
+  DebugAssert(node.type() == ARTNodeType::Node256, "Node is not an ARTNode256");
+  return _nodes256[node.index()];
+}
 
-BaseIndex::Iterator Leaf::begin() const { return _begin; }
+void ARTNodeArena::shrink_to_fit() {
+  _leaves.shrink_to_fit();
+  _nodes4.shrink_to_fit();
+  _nodes16.shrink_to_fit();
+  _nodes48.shrink_to_fit();
+  _nodes256.shrink_to_fit();
+}
 
-BaseIndex::Iterator Leaf::end() const { return _end; }
+size_t ARTNodeArena::memory_consumption() const {
+  return container_memory_usage(_leaves) + container_memory_usage(_nodes4) + container_memory_usage(_nodes16) +
+         container_memory_usage(_nodes48) + container_memory_usage(_nodes256);
+}
 
 }  // namespace opossum
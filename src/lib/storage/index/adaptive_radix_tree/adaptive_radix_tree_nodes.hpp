@@ -1,199 +1,166 @@
 #pragma once
 
 #include <array>
-#include <functional>
-#include <iterator>
-#include <memory>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
-#include "adaptive_radix_tree_index.hpp"
-
 #include "types.hpp"
 
 namespace opossum {
 
-using Iterator = std::vector<ChunkOffset>::const_iterator;
-
 /**
- * This file declares the ARTNode-types needed for the Adaptive-Radix-Tree (ART)
+ * This file declares the node types needed for the Adaptive-Radix-Tree (ART) and the ARTNodeArena that stores them.
  * In order to store its partial keys, the ART uses 4 different node-types, which can hold up to 4, 16, 48 and 256
  * partial keys respectively.
- * Each node has an array which contains pointers to its children and (if needed) an index array in order to map
- * partial keys to positions in the array of the child-pointers
+ * Each node has an array which contains references to its children and (if needed) an index array in order to map
+ * partial keys to positions in the array of the child-references.
  *
+ * Nodes do not hold pointers. They are plain structs stored in one vector per node type and reference each other using
+ * 32-bit ARTNodeReferences, i.e., their type and their position in that vector. Thus, a tree consists of a handful of
+ * contiguous allocations instead of one allocation per node. The vectors use the default allocator, so the arena is
+ * neither memory-mapped nor persisted. Since it holds no pointers, it could be in the future.
+ *
+ * Each node stores the range [begin, end) of positions in the index's _chunk_offsets that belong to the keys in its
+ * subtree, so that begin() and end() of a subtree do not have to descend to its leaves.
  */
 
-class ARTNode : private Noncopyable {
- public:
-  ARTNode() = default;
-
-  virtual ~ARTNode() = default;
-
-  virtual Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const = 0;
-  virtual Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const = 0;
-  virtual Iterator begin() const = 0;
-  virtual Iterator end() const = 0;
-};
+enum class ARTNodeType : uint8_t { Leaf, Node4, Node16, Node48, Node256 };
 
 /**
- *
- * ARTNode4 has two arrays of length 4:
- *  - _partial_keys stores the contained partial_keys of its children
- *  - _children stores pointers to the children
- *
- * _partial_key[i] is the partial_key for child _children[i]
- *
- * The default value of the _partial_keys array is 255u
+ * References a node by its type (upper 3 bits) and its position in the arena of that type (lower 29 bits).
+ * The default-constructed reference does not reference any node.
  */
-class ARTNode4 final : public ARTNode {
-  friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
-
+class ARTNodeReference {
  public:
-  explicit ARTNode4(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  ARTNodeReference() = default;
+  ARTNodeReference(const ARTNodeType type, const uint32_t index);
+
+  ARTNodeType type() const;
+  uint32_t index() const;
+  bool is_valid() const;
 
-  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
-  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
-  Iterator begin() const override;
-  Iterator end() const override;
+  bool operator==(const ARTNodeReference& other) const;
+  bool operator!=(const ARTNodeReference& other) const;
+
+  static constexpr auto INDEX_BITS = uint32_t{29};
+  static constexpr auto MAX_INDEX = (uint32_t{1} << INDEX_BITS) - 1;
 
  private:
-  /**
-   * _delegate_to_child is used to avoid code duplication between lower_bound() and upper_bound as the access to the
-   * children
-   * is the same, only the method called on the matching child differs
-   */
-  Iterator _delegate_to_child(
-      const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-      std::function<Iterator(size_t, const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)> function) const;
-  std::array<uint8_t, 4> _partial_keys;
-  std::array<std::shared_ptr<ARTNode>, 4> _children;
+  uint32_t _value = std::numeric_limits<uint32_t>::max();
 };
 
 /**
+ * Leaves hold the ValueID they represent and the positions [begin, end) of its ChunkOffsets in _chunk_offsets.
+ * If all keys in a subtree are equal, the subtree is replaced by a leaf. Thus, leaves are not necessarily located at
+ * the maximum depth and the ValueID is needed to decide whether a searched key is smaller or greater than the leaf's.
  *
- * ARTNode16 has two arrays of length 16, very similar to ARTNode4:
- *  - _partial_keys stores the contained partial_keys of its children
- *  - _children stores pointers to the children
- *
- * _partial_key[i] is the partial_key for child _children[i]
- *
- * The default value of the _partial_keys array is 255u
+ * Consider the following example tree showing only its leaves:
  *
+ *           Leaf(0x00000000) Leaf(0x00000001) ... Leaf(0xa101fe07) Leaf(0xa101feaf) ... Leaf(0xfebb34f1)
+ *           begin |  | end   |---|  | end      begin | |             |       |           |          |
+ *                 |  |--------|| begin |--|      |--| |--------||           |      |----|          |
+ *                 |           ||          |      |             ||           |      |               |
+ * _chunk_offsets: |17|a2|a4|b4|fe|02|03|04|a1|a3|...|12|c1|f3|1a|4f|6d|...|92|9a|27|...|00|13|aa|ab|f1|
  */
-
-class ARTNode16 final : public ARTNode {
- public:
-  explicit ARTNode16(std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
-
-  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
-  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
-  Iterator begin() const override;
-  Iterator end() const override;
-
- private:
-  Iterator _delegate_to_child(
-      const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-      std::function<Iterator(std::iterator_traits<std::array<uint8_t, 16>::iterator>::difference_type,
-                             const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)>
-          function) const;
-  std::array<uint8_t, 16> _partial_keys;
-  std::array<std::shared_ptr<ARTNode>, 16> _children;
+struct ARTLeaf {
+  // Stored as its base type because the strong typedef is not trivially copyable
+  ValueID::base_type value_id;
+  uint32_t begin;
+  uint32_t end;
 };
 
 /**
+ * ARTNode4 and ARTNode16 have two arrays:
+ *  - partial_keys stores the sorted partial_keys of its children
+ *  - children stores references to the children
  *
- * ARTNode48 has two arrays:
- *  - _index_to_child of length 256 that can be directly addressed
- *  - _children of length 48 stores pointers to the children
- *
- * _index_to_child[partial_key] stores the index for the child in _children
- *
- * The default value of the _index_to_child array is 255u. This is safe as the maximum value set in _index_to_child
- * will
- * be
- * 47 as this is the maximum index for _children.
+ * partial_keys[i] is the partial_key for child children[i], only the first child_count entries are used.
  */
-class ARTNode48 final : public ARTNode {
- public:
-  explicit ARTNode48(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+template <size_t capacity>
+struct ARTSortedNode {
+  uint32_t begin;
+  uint32_t end;
+  uint8_t child_count;
+  std::array<uint8_t, capacity> partial_keys;
+  std::array<ARTNodeReference, capacity> children;
+};
 
-  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
-  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
-  Iterator begin() const override;
-  Iterator end() const override;
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
 
- private:
-  Iterator _delegate_to_child(
-      const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-      std::function<Iterator(uint8_t, const AdaptiveRadixTreeIndex::BinaryComparable&, size_t)> function) const;
+/**
+ * ARTNode48 has two arrays:
+ *  - index_to_child of length 256 that can be directly addressed
+ *  - children of length 48 stores references to the children
+ *
+ * index_to_child[partial_key] stores the index for the child in children. The default value of the index_to_child
+ * array is 255u. This is safe as the maximum value set in index_to_child will be 47 as this is the maximum index for
+ * children.
+ */
+struct ARTNode48 {
+  uint32_t begin;
+  uint32_t end;
+  std::array<uint8_t, 256> index_to_child;
+  std::array<ARTNodeReference, 48> children;
+};
 
-  std::array<uint8_t, 256> _index_to_child;
-  std::array<std::shared_ptr<ARTNode>, 48> _children;
+/**
+ * ARTNode256 has only one array: children; which stores references to the children and can be directly addressed.
+ */
+struct ARTNode256 {
+  uint32_t begin;
+  uint32_t end;
+  std::array<ARTNodeReference, 256> children;
 };
 
+static_assert(std::is_trivially_copyable_v<ARTNode4> && std::is_trivially_copyable_v<ARTNode16> &&
+                  std::is_trivially_copyable_v<ARTNode48> && std::is_trivially_copyable_v<ARTNode256> &&
+                  std::is_trivially_copyable_v<ARTLeaf>,
+              "ART nodes must not hold pointers or own memory");
+
 /**
- *
- * ARTNode256 has only one array: _children; which stores pointers to the children and can be directly addressed.
- *
+ * Stores all nodes of one ART. Nodes are only added, never removed.
  */
-class ARTNode256 final : public ARTNode {
+class ARTNodeArena {
  public:
-  explicit ARTNode256(const std::vector<std::pair<uint8_t, std::shared_ptr<ARTNode>>>& children);
+  ARTNodeReference add_leaf(const ValueID value_id, const uint32_t begin, const uint32_t end);
 
-  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
-  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth) const override;
-  Iterator begin() const override;
-  Iterator end() const override;
+  // Adds the smallest node type that can hold the children, which have to be sorted by their partial keys
+  ARTNodeReference add_node(const std::vector<std::pair<uint8_t, ARTNodeReference>>& children);
 
- private:
-  Iterator _delegate_to_child(
-      const AdaptiveRadixTreeIndex::BinaryComparable& key, size_t depth,
-      std::function<Iterator(uint8_t, AdaptiveRadixTreeIndex::BinaryComparable, size_t)> function) const;
+  /**
+   * Returns the child with the smallest partial key greater than or equal to partial_key, along with its partial key.
+   * If there is no such child, the returned reference is invalid.
+   */
+  std::pair<uint8_t, ARTNodeReference> find_child(const ARTNodeReference node, const uint8_t partial_key) const;
 
-  std::array<std::shared_ptr<ARTNode>, 256> _children;
-};
+  // Positions of the first and one past the last ChunkOffset of the node's subtree in _chunk_offsets
+  uint32_t begin(const ARTNodeReference node) const;
+  uint32_t end(const ARTNodeReference node) const;
 
-/**
- *
- * Leafs contain two std::vector<ChunkOffset>::const_iterator: _lower_bound and _upper_bound.
- *
- * Consider the following example tree showing only its leafs:
- *
- *           Leaf(0x00000000) Leaf(0x00000001) ... Leaf(0xa101fe07) Leaf(0xa101feaf) ... Leaf(0xfebb34f1)
- *         _lower_ |  | _upper_     |       | _upper_    | |             |       |           |          |
- *           bound |  | bound   |---|       | bound      | |         |---|       |           |          |
- *                 |  |--------|| _lower_   |--|      |--| |--------||           |      |----|          |
- *                 |           || bound        |      |             ||           |      |               |
- * _chunk_offsets: |17|a2|a4|b4|fe|02|03|04|a1|a3|...|12|c1|f3|1a|4f|6d|...|92|9a|27|...|00|13|aa|ab|f1|
- *
- *
- * _lower_bound points to the first ChunkOffset in _chunk_offsets that belongs to the value in the attribute vector
- * that
- * the leaf represents.
- *     eg: on ChunkOffset 17 the value is 0x00000000, on ChunkOffset f3 the value is 0xa101fe07
- *
- * _upper_bound points to the first ChunkOffset in _chunk_offsets that does not contain the value that the leaf
- * represents.
- *     eg: at ChunkOffset fe, the value is 0x00000001, not 0x00000000
- *     for the last leaf, _upper_bound = _chunk_offsets.end()
- *
- * lower_bound() nets the same as begin(), upper_bound the same as end()
- */
-class Leaf final : public ARTNode {
-  friend class AdaptiveRadixTreeIndexTest_BulkInsert_Test;
+  const ARTLeaf& leaf(const ARTNodeReference node) const;
+  const ARTNode4& node4(const ARTNodeReference node) const;
+  const ARTNode16& node16(const ARTNodeReference node) const;
+  const ARTNode48& node48(const ARTNodeReference node) const;
+  const ARTNode256& node256(const ARTNodeReference node) const;
 
- public:
-  explicit Leaf(Iterator& lower, Iterator& upper);
+  // Releases unused capacity once the tree is complete
+  void shrink_to_fit();
 
-  Iterator lower_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
-  Iterator upper_bound(const AdaptiveRadixTreeIndex::BinaryComparable&, size_t) const override;
-  Iterator begin() const override;
-  Iterator end() const override;
+  size_t memory_consumption() const;
 
- private:
-  Iterator _begin;
-  Iterator _end;
+ protected:
+  template <typename Node>
+  static ARTNodeReference _add(std::vector<Node>& nodes, const ARTNodeType type, const Node& node);
+
+  std::vector<ARTLeaf> _leaves;
+  std::vector<ARTNode4> _nodes4;
+  std::vector<ARTNode16> _nodes16;
+  std::vector<ARTNode48> _nodes48;
+  std::vector<ARTNode256> _nodes256;
 };
 
 }  // namespace opossum
@@ -38,4 +38,6 @@ BaseIndex::Iterator BaseIndex::cend() const { return _cend(); }
 
 ColumnIndexType BaseIndex::type() const { return _type; }
 
+size_t BaseIndex::memory_consumption() const { return _memory_consumption(); }
+
 }  // namespace opossum
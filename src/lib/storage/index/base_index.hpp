@@ -108,6 +108,13 @@ class BaseIndex : private Noncopyable {
 
   ColumnIndexType type() const;
 
+  /**
+   * Returns the number of bytes held by the index, including the index object itself but excluding the indexed
+   * columns.
+   * Calls _memory_consumption() of the most derived class.
+   */
+  size_t memory_consumption() const;
+
  protected:
   /**
    * Seperate the public interface of the index from the interface for programmers implementing own
@@ -118,6 +125,7 @@ class BaseIndex : private Noncopyable {
   virtual Iterator _cbegin() const = 0;
   virtual Iterator _cend() const = 0;
   virtual std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const = 0;
+  virtual size_t _memory_consumption() const = 0;
 
  private:
   const ColumnIndexType _type;
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "storage/base_dictionary_column.hpp"
+#include "storage/memory_usage.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
 #include "storage/vector_compression/base_vector_decompressor.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_utils.hpp"
@@ -174,4 +175,9 @@ std::vector<std::shared_ptr<const BaseColumn>> CompositeGroupKeyIndex::_get_inde
   return result;
 }
 
+size_t CompositeGroupKeyIndex::_memory_consumption() const {
+  return sizeof(*this) + _keys.allocated_bytes() + container_memory_usage(_indexed_columns) +
+         container_memory_usage(_key_offsets) + container_memory_usage(_position_list);
+}
+
 }  // namespace opossum
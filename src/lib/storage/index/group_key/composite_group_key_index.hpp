@@ -57,6 +57,8 @@ class CompositeGroupKeyIndex : public BaseIndex {
   Iterator _cend() const final;
   std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const final;
 
+  size_t _memory_consumption() const final;
+
   /**
    * Creates a VariableLengthKey using the values given as parameters.
    *
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "storage/base_dictionary_column.hpp"
+#include "storage/memory_usage.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 namespace opossum {
@@ -15,9 +16,9 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>
   DebugAssert((index_columns.size() == 1), "GroupKeyIndex only works with a single column.");
 
   // 1) Initialize the index structures
-  // 1a) Set the index_offset to size of the dictionary + 1 (plus one to mark the ending position)
-  //     and set all offsets to 0
-  _index_offsets = std::vector<size_t>(_index_column->unique_values_count() + 1u, 0u);
+  // 1a) Set the index_offset to size of the dictionary + 2 (plus one for the NULL value id, which is the largest one,
+  //     and plus one to mark the ending position) and set all offsets to 0
+  _index_offsets = std::vector<size_t>(_index_column->unique_values_count() + 2u, 0u);
   // 1b) Set the _index_postings to the size of the attribute vector
   _index_postings = std::vector<ChunkOffset>(_index_column->size());
 
@@ -89,4 +90,8 @@ GroupKeyIndex::Iterator GroupKeyIndex::_get_postings_iterator_at(ValueID value_i
 
 std::vector<std::shared_ptr<const BaseColumn>> GroupKeyIndex::_get_index_columns() const { return {_index_column}; }
 
+size_t GroupKeyIndex::_memory_consumption() const {
+  return sizeof(*this) + container_memory_usage(_index_offsets) + container_memory_usage(_index_postings);
+}
+
 }  // namespace opossum
@@ -71,6 +71,8 @@ class GroupKeyIndex : public BaseIndex {
 
   std::vector<std::shared_ptr<const BaseColumn>> _get_index_columns() const;
 
+  size_t _memory_consumption() const;
+
  private:
   const std::shared_ptr<const BaseDictionaryColumn> _index_column;
   std::vector<std::size_t> _index_offsets;   // maps value-ids to offsets in _index_postings
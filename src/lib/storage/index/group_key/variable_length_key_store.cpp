@@ -32,6 +32,8 @@ CompositeKeyLength VariableLengthKeyStore::key_size() const { return _bytes_per_
 
 ChunkOffset VariableLengthKeyStore::size() const { return static_cast<ChunkOffset>(_data.size() / _key_alignment); }
 
+size_t VariableLengthKeyStore::allocated_bytes() const { return _data.capacity() * sizeof(VariableLengthKeyWord); }
+
 VariableLengthKeyStore::iterator VariableLengthKeyStore::erase(iterator first, iterator last) {
   auto underlying_first = _data.begin();
   std::advance(underlying_first, std::distance(begin(), first) * _key_alignment);
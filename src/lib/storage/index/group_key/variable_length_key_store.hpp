@@ -75,6 +75,11 @@ class VariableLengthKeyStore {
    */
   ChunkOffset size() const;
 
+  /**
+   * Returns the number of bytes allocated for storing the keys, including unused capacity.
+   */
+  size_t allocated_bytes() const;
+
   /**
    * Resizes the container to the specified size. If size is smaller than size(), entries are deleted. If size is
    * larger,
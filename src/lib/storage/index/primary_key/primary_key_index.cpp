@@ -0,0 +1,162 @@
+#include "primary_key_index.hpp"
+
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/base_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/materialize.hpp"
+#include "storage/memory_usage.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+
+namespace opossum {
+
+BasePrimaryKeyIndex::BasePrimaryKeyIndex(const ColumnID column_id) : _column_id(column_id) {}
+
+ColumnID BasePrimaryKeyIndex::column_id() const { return _column_id; }
+
+template <typename T>
+void PrimaryKeyIndex<T>::insert(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                                const ChunkOffset end_offset) {
+  const auto insert_value = [&](const T& value, const ChunkOffset chunk_offset) {
+    auto& partition = _partition(value);
+    std::unique_lock<std::shared_mutex> lock(partition.mutex);
+    partition.entries.emplace(value, RowID{chunk_id, chunk_offset});
+  };
+
+  // Inserts into mutable chunks only touch a few rows, so we access the ValueColumn directly instead of
+  // materializing it.
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&column)) {
+    const auto& values = value_column->values();
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      if (value_column->is_nullable() && value_column->null_values()[chunk_offset]) continue;
+      insert_value(values[chunk_offset], chunk_offset);
+    }
+    return;
+  }
+
+  auto values_and_nulls = std::vector<std::pair<bool, T>>{};
+  values_and_nulls.reserve(column.size());
+  materialize_values_and_nulls(column, values_and_nulls);
+
+  for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+    const auto& [is_null, value] = values_and_nulls[chunk_offset];
+    if (is_null) continue;
+    insert_value(value, chunk_offset);
+  }
+}
+
+template <typename T>
+void PrimaryKeyIndex<T>::erase(const AllTypeVariant& key, const RowID& row_id) {
+  if (variant_is_null(key)) return;
+
+  const auto typed_key = type_cast<T>(key);
+  auto& partition = _partition(typed_key);
+  std::unique_lock<std::shared_mutex> lock(partition.mutex);
+
+  const auto range = partition.entries.equal_range(typed_key);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == row_id) {
+      partition.entries.erase(it);
+      return;
+    }
+  }
+}
+
+template <typename T>
+void PrimaryKeyIndex<T>::erase_chunk(const ChunkID chunk_id) {
+  for (auto& partition : _partitions) {
+    std::unique_lock<std::shared_mutex> lock(partition.mutex);
+    for (auto it = partition.entries.begin(); it != partition.entries.end();) {
+      it = it->second.chunk_id == chunk_id ? partition.entries.erase(it) : std::next(it);
+    }
+  }
+}
+
+template <typename T>
+size_t PrimaryKeyIndex<T>::prune(const Table& table, const CommitID oldest_snapshot_commit_id) {
+  auto pruned_count = size_t{0};
+
+  for (auto& partition : _partitions) {
+    std::unique_lock<std::shared_mutex> lock(partition.mutex);
+    for (auto it = partition.entries.begin(); it != partition.entries.end();) {
+      const auto& row_id = it->second;
+      const auto end_cid = table.get_chunk(row_id.chunk_id)->mvcc_columns()->end_cids[row_id.chunk_offset];
+
+      // A row is invisible to all snapshots that are not older than the commit ID of its deletion
+      if (end_cid <= oldest_snapshot_commit_id) {
+        it = partition.entries.erase(it);
+        ++pruned_count;
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  return pruned_count;
+}
+
+template <typename T>
+PosList PrimaryKeyIndex<T>::lookup(const AllTypeVariant& key) const {
+  if (variant_is_null(key)) return {};
+
+  const auto typed_key = type_cast<T>(key);
+  const auto& partition = _partition(typed_key);
+  std::shared_lock<std::shared_mutex> lock(partition.mutex);
+
+  const auto range = partition.entries.equal_range(typed_key);
+  auto row_ids = PosList{};
+  for (auto it = range.first; it != range.second; ++it) {
+    row_ids.emplace_back(it->second);
+  }
+  return row_ids;
+}
+
+template <typename T>
+size_t PrimaryKeyIndex<T>::size() const {
+  auto size = size_t{0};
+  for (const auto& partition : _partitions) {
+    std::shared_lock<std::shared_mutex> lock(partition.mutex);
+    size += partition.entries.size();
+  }
+  return size;
+}
+
+template <typename T>
+size_t PrimaryKeyIndex<T>::memory_consumption() const {
+  // Each entry of an unordered_multimap is a separately allocated node holding the value and a pointer to the next
+  // node. Additionally, the bucket array holds one pointer per bucket.
+  static constexpr auto node_size = sizeof(std::pair<const T, RowID>) + sizeof(void*);
+
+  auto bytes = sizeof(*this);
+  for (const auto& partition : _partitions) {
+    std::shared_lock<std::shared_mutex> lock(partition.mutex);
+    bytes += partition.entries.size() * node_size + partition.entries.bucket_count() * sizeof(void*);
+    if constexpr (std::is_same_v<T, std::string>) {
+      for (const auto& entry : partition.entries) {
+        bytes += dynamic_memory_usage(entry.first);
+      }
+    }
+  }
+  return bytes;
+}
+
+template <typename T>
+typename PrimaryKeyIndex<T>::Partition& PrimaryKeyIndex<T>::_partition(const T& key) {
+  return _partitions[std::hash<T>{}(key) % PARTITION_COUNT];
+}
+
+template <typename T>
+const typename PrimaryKeyIndex<T>::Partition& PrimaryKeyIndex<T>::_partition(const T& key) const {
+  return _partitions[std::hash<T>{}(key) % PARTITION_COUNT];
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(PrimaryKeyIndex);
+
+}  // namespace opossum
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <shared_mutex>  // NOLINT lint thinks this is a C header or something
+#include <unordered_map>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Table;
+
+/**
+ * Table-wide hash index that maps the values of a single column to the RowIDs of the rows holding them. Other than the
+ * chunk indices (see BaseIndex), it spans all chunks of a table, including the mutable ones, so that a point lookup by
+ * key does not need to probe every chunk.
+ *
+ * The index is created via Table::create_primary_key_index() and maintained by the Insert operator, which also
+ * removes the entries of rolled back rows. Since updates and deletes are MVCC-based, all versions of a row stay in the
+ * index: A deleted row might still be visible to transactions with an older snapshot. Thus, a lookup returns all
+ * candidate rows of a key and the visibility check is left to the Validate operator. Once no transaction can see a
+ * deleted row anymore, its entry can be removed via prune(), which the ChunkCompressionTask does. NULL values are
+ * not indexed.
+ *
+ * The entries are distributed over multiple partitions, each protected by its own mutex, so that concurrent Inserts
+ * and lookups rarely contend for the same lock.
+ */
+class BasePrimaryKeyIndex : private Noncopyable {
+ public:
+  explicit BasePrimaryKeyIndex(const ColumnID column_id);
+  virtual ~BasePrimaryKeyIndex() = default;
+
+  ColumnID column_id() const;
+
+  // Adds the rows [begin_offset, end_offset) of the indexed column of chunk chunk_id
+  virtual void insert(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset) = 0;
+
+  virtual void erase(const AllTypeVariant& key, const RowID& row_id) = 0;
+
+  // Removes all entries of chunk chunk_id, e.g., because its rows were reordered and have to be inserted again
+  virtual void erase_chunk(const ChunkID chunk_id) = 0;
+
+  /**
+   * Removes the entries of rows of table that were deleted by a transaction with a commit ID of at most
+   * oldest_snapshot_commit_id. The caller has to make sure that no transaction with an older snapshot is running.
+   * Returns the number of removed entries.
+   */
+  virtual size_t prune(const Table& table, const CommitID oldest_snapshot_commit_id) = 0;
+
+  // Returns the RowIDs of all rows holding key, in no particular order
+  virtual PosList lookup(const AllTypeVariant& key) const = 0;
+
+  virtual size_t size() const = 0;
+
+  virtual size_t memory_consumption() const = 0;
+
+ protected:
+  const ColumnID _column_id;
+};
+
+template <typename T>
+class PrimaryKeyIndex : public BasePrimaryKeyIndex {
+ public:
+  using BasePrimaryKeyIndex::BasePrimaryKeyIndex;
+
+  void insert(const BaseColumn& column, const ChunkID chunk_id, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset) final;
+
+  void erase(const AllTypeVariant& key, const RowID& row_id) final;
+
+  void erase_chunk(const ChunkID chunk_id) final;
+
+  size_t prune(const Table& table, const CommitID oldest_snapshot_commit_id) final;
+
+  PosList lookup(const AllTypeVariant& key) const final;
+
+  size_t size() const final;
+
+  size_t memory_consumption() const final;
+
+ protected:
+  static constexpr auto PARTITION_COUNT = size_t{16};
+
+  struct Partition {
+    mutable std::shared_mutex mutex;
+    std::unordered_multimap<T, RowID> entries;
+  };
+
+  Partition& _partition(const T& key);
+  const Partition& _partition(const T& key) const;
+
+  std::array<Partition, PARTITION_COUNT> _partitions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#include "memory_usage.hpp"
+
+namespace opossum {
+
+size_t MemoryUsage::total() const {
+  return data + dictionaries + attribute_vectors + null_values + pos_lists + mvcc + indices + statistics + metadata;
+}
+
+MemoryUsage& MemoryUsage::operator+=(const MemoryUsage& rhs) {
+  data += rhs.data;
+  dictionaries += rhs.dictionaries;
+  attribute_vectors += rhs.attribute_vectors;
+  null_values += rhs.null_values;
+  pos_lists += rhs.pos_lists;
+  mvcc += rhs.mvcc;
+  indices += rhs.indices;
+  statistics += rhs.statistics;
+  metadata += rhs.metadata;
+  return *this;
+}
+
+MemoryUsage operator+(MemoryUsage lhs, const MemoryUsage& rhs) {
+  lhs += rhs;
+  return lhs;
+}
+
+}  // namespace opossum
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Breakdown of the memory held by a column, chunk, or table.
+ *
+ * Other than estimate_memory_usage(), which only multiplies element counts with element sizes, this takes the
+ * reserved capacity of containers and the heap-allocated part of strings into account. Memory that is shared between
+ * multiple objects (e.g., a PosList referenced by all ReferenceColumns of a chunk) is counted once by the object
+ * aggregating the usage, e.g., the Chunk.
+ */
+struct MemoryUsage {
+  // Uncompressed values, e.g., of ValueColumns or the run values of RunLengthColumns
+  size_t data = 0;
+
+  // Dictionaries of DictionaryColumns
+  size_t dictionaries = 0;
+
+  // Compressed vectors, e.g., attribute vectors of DictionaryColumns or offsets of FrameOfReferenceColumns
+  size_t attribute_vectors = 0;
+
+  size_t null_values = 0;
+
+  // Position lists of ReferenceColumns
+  size_t pos_lists = 0;
+
+  size_t mvcc = 0;
+
+  size_t indices = 0;
+
+  size_t statistics = 0;
+
+  // The column, chunk, and table objects themselves as well as other management structures
+  size_t metadata = 0;
+
+  size_t total() const;
+
+  MemoryUsage& operator+=(const MemoryUsage& rhs);
+};
+
+MemoryUsage operator+(MemoryUsage lhs, const MemoryUsage& rhs);
+
+/**
+ * Returns the number of bytes a value allocates outside of its own sizeof(), i.e., the heap buffer of a string that
+ * is too long for the small string optimization.
+ */
+template <typename T>
+size_t dynamic_memory_usage(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto begin = reinterpret_cast<const char*>(&value);
+    const auto is_small_string = value.data() >= begin && value.data() < begin + sizeof(std::string);
+    return is_small_string ? 0u : value.capacity() + 1u;
+  } else {  // NOLINT
+    return 0u;
+  }
+}
+
+/**
+ * Returns the number of bytes allocated by a container for its elements, including unused capacity and memory
+ * allocated by the elements themselves. Works for std::vector, pmr_vector, and pmr_concurrent_vector.
+ */
+template <typename Container>
+size_t container_memory_usage(const Container& container) {
+  using ValueType = typename Container::value_type;
+
+  auto bytes = container.capacity() * sizeof(ValueType);
+  if constexpr (!std::is_trivially_destructible_v<ValueType>) {
+    for (const auto& value : container) {
+      bytes += dynamic_memory_usage(value);
+    }
+  }
+  return bytes;
+}
+
+// std::vector<bool> stores one bit per element
+template <typename Allocator>
+size_t container_memory_usage(const std::vector<bool, Allocator>& container) {
+  static const auto bits_per_byte = size_t{8};
+  return (container.capacity() + bits_per_byte - 1) / bits_per_byte;
+}
+
+}  // namespace opossum
@@ -53,4 +53,11 @@ size_t ReferenceColumn::estimate_memory_usage() const {
   return sizeof(*this) + _pos_list->size() * sizeof(decltype(_pos_list)::element_type::value_type);
 }
 
+MemoryUsage ReferenceColumn::memory_usage() const {
+  auto usage = MemoryUsage{};
+  usage.pos_lists = container_memory_usage(*_pos_list);
+  usage.metadata = sizeof(*this);
+  return usage;
+}
+
 }  // namespace opossum
@@ -73,6 +73,8 @@ class ReferenceColumn : public BaseColumn {
 
   size_t estimate_memory_usage() const override;
 
+  MemoryUsage memory_usage() const override;
+
  protected:
   // After an operator finishes, its shared_ptr reference to the table gets deleted. Thus, the ReferenceColumns need
   // their own shared_ptrs
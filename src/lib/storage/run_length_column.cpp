@@ -74,6 +74,15 @@ size_t RunLengthColumn<T>::estimate_memory_usage() const {
          _end_positions->size() * sizeof(typename decltype(_end_positions)::element_type::value_type);
 }
 
+template <typename T>
+MemoryUsage RunLengthColumn<T>::memory_usage() const {
+  auto usage = MemoryUsage{};
+  usage.data = container_memory_usage(*_values) + container_memory_usage(*_end_positions);
+  usage.null_values = container_memory_usage(*_null_values);
+  usage.metadata = sizeof(*this);
+  return usage;
+}
+
 template <typename T>
 EncodingType RunLengthColumn<T>::encoding_type() const {
   return EncodingType::RunLength;
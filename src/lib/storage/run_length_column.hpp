@@ -49,6 +49,8 @@ class RunLengthColumn : public BaseEncodedColumn {
 
   size_t estimate_memory_usage() const final;
 
+  MemoryUsage memory_usage() const final;
+
   /**@}*/
 
   /**
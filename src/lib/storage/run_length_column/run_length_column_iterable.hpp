@@ -23,6 +23,23 @@ class RunLengthColumnIterable : public PointAccessibleColumnIterable<RunLengthCo
     functor(begin, end);
   }
 
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset,
+                          const Functor& functor) const {
+    // The run that contains begin_chunk_offset is the first one that ends at or after it
+    const auto end_position_it =
+        std::lower_bound(_column.end_positions()->cbegin(), _column.end_positions()->cend(), begin_chunk_offset);
+    const auto run_index = std::distance(_column.end_positions()->cbegin(), end_position_it);
+
+    auto begin = Iterator{_column.values()->cbegin() + run_index, _column.null_values()->cbegin() + run_index,
+                          end_position_it, begin_chunk_offset};
+    // Iterators are compared by their position only
+    auto end = Iterator{_column.values()->cend(), _column.null_values()->cend(), _column.end_positions()->cend(),
+                        end_chunk_offset};
+
+    functor(begin, end);
+  }
+
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
     auto begin = PointAccessIterator{*_column.values(), *_column.null_values(), *_column.end_positions(),
@@ -10,6 +10,7 @@
 #include "operators/table_wrapper.hpp"
 #include "optimizer/table_statistics.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/table.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -57,6 +58,16 @@ std::vector<std::string> StorageManager::table_names() const {
   return table_names;
 }
 
+std::map<std::string, MemoryUsage> StorageManager::memory_usage() const {
+  std::map<std::string, MemoryUsage> memory_usage;
+
+  for (const auto& table_item : _tables) {
+    memory_usage.emplace(table_item.first, table_item.second->memory_usage());
+  }
+
+  return memory_usage;
+}
+
 void StorageManager::add_view(const std::string& name, std::shared_ptr<const AbstractLQPNode> view) {
   Assert(_tables.find(name) == _tables.end(),
          "Cannot add view " + name + " - a table with the same name already exists");
@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 
+#include "memory_usage.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -34,6 +35,9 @@ class StorageManager : private Noncopyable {
   // returns a list of all table names
   std::vector<std::string> table_names() const;
 
+  // returns the memory held by each table, see Table::memory_usage()
+  std::map<std::string, MemoryUsage> memory_usage() const;
+
   // adds a view to the storage manager
   void add_view(const std::string& name, std::shared_ptr<const AbstractLQPNode> view);
 
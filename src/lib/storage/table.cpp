@@ -8,11 +8,30 @@
 #include <utility>
 #include <vector>
 
+#include "base_encoded_column.hpp"
+#include "index/primary_key/primary_key_index.hpp"
+#include "optimizer/table_statistics.hpp"
 #include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/mapped_file_memory_resource.hpp"
 #include "value_column.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Bytes reserved in the file of an evicted chunk per column, in addition to its data, e.g., for alignment
+constexpr auto EVICTED_COLUMN_RESERVE = size_t{4096};
+
+// Ties the lifetime of the file of an evicted chunk to the columns that use it, which might outlive the chunk
+struct MappedColumn {
+  std::shared_ptr<MappedFileMemoryResource> memory_resource;
+  std::shared_ptr<BaseColumn> column;
+};
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<Table> Table::create_dummy_table(const TableColumnDefinitions& column_definitions) {
@@ -25,7 +44,9 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _max_chunk_size(max_chunk_size),
-      _append_mutex(std::make_unique<std::mutex>()) {
+      _eviction_mutex(std::make_unique<std::mutex>()),
+      _append_mutex(std::make_unique<std::mutex>()),
+      _index_mutex(std::make_unique<std::mutex>()) {
   Assert(max_chunk_size > 0, "Table must have a chunk size greater than 0.");
 }
 
@@ -86,11 +107,11 @@ ColumnID Table::column_id_by_name(const std::string& column_name) const {
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
-  if (_chunks.empty() || _chunks.back()->size() >= _max_chunk_size) {
+  if (chunk_count() == 0 || get_chunk(ChunkID{chunk_count() - 1})->size() >= _max_chunk_size) {
     append_mutable_chunk();
   }
 
-  _chunks.back()->append(values);
+  get_chunk(ChunkID{chunk_count() - 1})->append(values);
 }
 
 void Table::append_mutable_chunk() {
@@ -106,38 +127,42 @@ void Table::append_mutable_chunk() {
 
 uint64_t Table::row_count() const {
   uint64_t ret = 0;
-  for (const auto& chunk : _chunks) {
-    ret += chunk->size();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    ret += chunk_size(chunk_id);
   }
   return ret;
 }
 
+size_t Table::chunk_size(ChunkID chunk_id) const { return get_chunk(chunk_id)->size(); }
+
 bool Table::empty() const { return row_count() == 0u; }
 
-ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunks.size()); }
+ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunk_count.load()); }
 
-const std::vector<std::shared_ptr<Chunk>>& Table::chunks() const { return _chunks; }
+std::vector<std::shared_ptr<Chunk>> Table::chunks() const {
+  auto chunks = std::vector<std::shared_ptr<Chunk>>(chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunks.size(); ++chunk_id) {
+    chunks[chunk_id] = std::atomic_load(&_chunks[chunk_id]);
+  }
+  return chunks;
+}
 
 uint32_t Table::max_chunk_size() const { return _max_chunk_size; }
 
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
-ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
-}
+ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) { return ProxyChunk(get_chunk(chunk_id)); }
 
 const ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) const {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  return ProxyChunk(std::const_pointer_cast<Chunk>(get_chunk(chunk_id)));
 }
 
 void Table::append_chunk(const ChunkColumns& columns, const std::optional<PolymorphicAllocator<Chunk>>& alloc,
@@ -165,17 +190,119 @@ void Table::append_chunk(const ChunkColumns& columns, const std::optional<Polymo
     mvcc_columns = std::make_shared<MvccColumns>(chunk_size);
   }
 
-  _chunks.emplace_back(std::make_shared<Chunk>(columns, mvcc_columns, alloc, access_counter));
+  _chunks.push_back(std::make_shared<Chunk>(columns, mvcc_columns, alloc, access_counter));
+  ++_chunk_count;
+}
+
+void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
+  DebugAssert(chunk->column_count() == column_count(), "Chunk does not match the column count of the table");
+  DebugAssert(chunk->size() <= _max_chunk_size, "Chunk exceeds the maximum chunk size");
+  DebugAssert(chunk->has_mvcc_columns() == (_use_mvcc == UseMvcc::Yes), "Chunk does not match the MVCC of the table");
+
+  _chunks.push_back(chunk);
+  ++_chunk_count;
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
+std::vector<IndexInfo> Table::get_indexes() const {
+  std::lock_guard<std::mutex> lock(*_index_mutex);
+  return _indexes;
+}
+
+void Table::register_index(const IndexInfo& index_info) {
+  std::lock_guard<std::mutex> lock(*_index_mutex);
+  DebugAssert(std::none_of(_indexes.cbegin(), _indexes.cend(),
+                           [&](const auto& other) {
+                             return other.type == index_info.type && other.column_ids == index_info.column_ids;
+                           }),
+              "Index is already registered");
+  _indexes.emplace_back(index_info);
+}
+
+void Table::create_missing_indexes(const ChunkID chunk_id) {
+  const auto chunk = get_chunk(chunk_id);
+
+  // Holding the lock prevents two threads from creating the same index for the chunk
+  std::lock_guard<std::mutex> lock(*_index_mutex);
+  for (const auto& index_info : _indexes) {
+    if (!chunk->columns_are_indexable(index_info.column_ids)) continue;
+    if (chunk->get_index(index_info.type, index_info.column_ids)) continue;
+    chunk->create_index(index_info.type, index_info.column_ids);
+  }
+}
+
+void Table::create_primary_key_index(const ColumnID column_id) {
+  Assert(_type == TableType::Data, "Primary key indices can only be created on data tables");
+  Assert(column_id < column_count(), "ColumnID " + std::to_string(column_id) + " out of range");
+  Assert(!_primary_key_index, "Table already has a primary key index");
+
+  auto index = make_shared_by_data_type<BasePrimaryKeyIndex, PrimaryKeyIndex>(column_data_type(column_id), column_id);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto chunk = get_chunk(chunk_id);
+    index->insert(*chunk->get_column(column_id), chunk_id, ChunkOffset{0}, static_cast<ChunkOffset>(chunk->size()));
+  }
+
+  std::atomic_store(&_primary_key_index, index);
+}
+
+std::shared_ptr<BasePrimaryKeyIndex> Table::primary_key_index() const { return std::atomic_load(&_primary_key_index); }
+
+void Table::evict_chunk(const ChunkID chunk_id, const std::string& path) {
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  Assert(_type == TableType::Data, "Only chunks of data tables can be evicted");
+
+  std::lock_guard<std::mutex> lock(*_eviction_mutex);
+  if (_evicted_chunk_ids.count(chunk_id)) return;
+
+  const auto chunk = get_chunk(chunk_id);
+  for (const auto& column : chunk->columns()) {
+    Assert(std::dynamic_pointer_cast<const BaseEncodedColumn>(column), "Only chunks of encoded columns can be evicted");
+  }
+
+  const auto usage = chunk->memory_usage();
+  const auto capacity = usage.data + usage.dictionaries + usage.attribute_vectors + usage.null_values +
+                        chunk->column_count() * EVICTED_COLUMN_RESERVE;
+  const auto memory_resource = std::make_shared<MappedFileMemoryResource>(path, capacity);
+  const auto allocator = PolymorphicAllocator<size_t>{memory_resource.get()};
+
+  auto columns = ChunkColumns{};
+  for (const auto& column : chunk->columns()) {
+    const auto mapped_column = std::make_shared<MappedColumn>(
+        MappedColumn{memory_resource, column->copy_using_allocator(allocator)});
+    columns.emplace_back(mapped_column, mapped_column->column.get());
+  }
+  memory_resource->release_to_file();
+
+  auto evicted_chunk =
+      std::make_shared<Chunk>(columns, chunk->_mvcc_columns, std::nullopt, chunk->access_counter());
+  evicted_chunk->set_statistics(chunk->statistics());
+  evicted_chunk->set_ordered_by(chunk->ordered_by());
+
+  for (const auto& index_info : get_indexes()) {
+    if (!evicted_chunk->columns_are_indexable(index_info.column_ids)) continue;
+    evicted_chunk->create_index(index_info.type, index_info.column_ids);
+  }
+
+  std::atomic_store(&_chunks[chunk_id], evicted_chunk);
+  _evicted_chunk_ids.emplace(chunk_id);
+}
+
+bool Table::chunk_is_evicted(const ChunkID chunk_id) const {
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  std::lock_guard<std::mutex> lock(*_eviction_mutex);
+  return _evicted_chunk_ids.count(chunk_id) > 0;
+}
+
+std::shared_ptr<ChunkStatistics> Table::chunk_statistics(const ChunkID chunk_id) const {
+  return get_chunk(chunk_id)->statistics();
+}
 
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
-  for (const auto& chunk : _chunks) {
+  for (const auto& chunk : chunks()) {
     bytes += chunk->estimate_memory_usage();
   }
 
@@ -189,4 +316,37 @@ size_t Table::estimate_memory_usage() const {
   return bytes;
 }
 
+MemoryUsage Table::memory_usage() const {
+  auto usage = MemoryUsage{};
+  usage.metadata = sizeof(*this) + _chunks.capacity() * sizeof(std::shared_ptr<Chunk>) +
+                   container_memory_usage(_indexes);
+
+  for (const auto& column_definition : _column_definitions) {
+    usage.metadata += sizeof(column_definition) + dynamic_memory_usage(column_definition.name);
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    auto chunk_usage = get_chunk(chunk_id)->memory_usage();
+
+    // The column data of evicted chunks is backed by files, the OS page cache decides whether it is held in memory
+    if (chunk_is_evicted(chunk_id)) {
+      chunk_usage.data = 0u;
+      chunk_usage.dictionaries = 0u;
+      chunk_usage.attribute_vectors = 0u;
+      chunk_usage.null_values = 0u;
+    }
+
+    usage += chunk_usage;
+  }
+
+  // The column statistics held by the TableStatistics only consist of a few scalar values and are not accounted for
+  if (_table_statistics) usage.statistics += sizeof(TableStatistics);
+
+  if (const auto primary_key_index = std::atomic_load(&_primary_key_index)) {
+    usage.indices += primary_key_index->memory_consumption();
+  }
+
+  return usage;
+}
+
 }  // namespace opossum
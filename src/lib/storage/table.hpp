@@ -1,11 +1,16 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <tbb/concurrent_vector.h>
+
 #include "base_column.hpp"
 #include "chunk.hpp"
 #include "proxy_chunk.hpp"
@@ -18,6 +23,7 @@
 
 namespace opossum {
 
+class BasePrimaryKeyIndex;
 class TableStatistics;
 
 /**
@@ -29,6 +35,7 @@ class Table : private Noncopyable {
 
   explicit Table(const TableColumnDefinitions& column_definitions, const TableType type,
                  const uint32_t max_chunk_size = Chunk::MAX_SIZE, const UseMvcc use_mvcc = UseMvcc::No);
+
   /**
    * @defgroup Getter and convenience functions for the column definitions
    * @{
@@ -64,6 +71,9 @@ class Table : private Noncopyable {
   // Use approx_valid_row_count() for an approximate count of valid rows instead.
   uint64_t row_count() const;
 
+  // Returns the number of rows of a chunk
+  size_t chunk_size(ChunkID chunk_id) const;
+
   /**
    * @return row_count() == 0
    */
@@ -76,8 +86,8 @@ class Table : private Noncopyable {
   // returns the number of chunks (cannot exceed ChunkID (uint32_t))
   ChunkID chunk_count() const;
 
-  // Returns all Chunks
-  const std::vector<std::shared_ptr<Chunk>>& chunks() const;
+  // Returns a snapshot of all Chunks
+  std::vector<std::shared_ptr<Chunk>> chunks() const;
 
   // returns the chunk with the given id
   std::shared_ptr<Chunk> get_chunk(ChunkID chunk_id);
@@ -86,6 +96,9 @@ class Table : private Noncopyable {
   const ProxyChunk get_chunk_with_access_counting(ChunkID chunk_id) const;
 
   /**
+   * Chunks can be read while other chunks are appended. Appending is not thread-safe, concurrent appends have to be
+   * synchronized using acquire_append_mutex().
+   *
    * Creates a new Chunk and appends it to this table.
    * Makes sure the @param columns match with the TableType (only ReferenceColumns or only data containing columns)
    * En/Disables MVCC for the Chunk depending on whether MVCC is enabled for the table (has_mvcc())
@@ -97,6 +110,35 @@ class Table : private Noncopyable {
   // Create and append a Chunk consisting of ValueColumns.
   void append_mutable_chunk();
 
+  // Appends an existing Chunk, e.g., one that was loaded from a Checkpoint. It needs MVCC columns if has_mvcc().
+  void append_chunk(const std::shared_ptr<Chunk>& chunk);
+
+  /** @} */
+
+  /**
+   * @defgroup Tiered storage
+   *
+   * Chunks whose columns are all encoded (and thus immutable) can be evicted from DRAM to a memory-mapped file (see
+   * MappedFileMemoryResource). The columns are copied into the file and the chunk is replaced by one that uses the
+   * copies. Their pages are written back and dropped from the process, from then on the OS page cache decides which
+   * of them stay in memory. Accessing an evicted chunk transparently faults its pages in again, there is no explicit
+   * reload. Operators that still hold the replaced Chunk keep using it, its memory is released once the last
+   * reference is gone. The file is removed once the last of its columns is gone.
+   *
+   * MVCC columns, statistics, the access counter, and the sort order of an evicted chunk stay in memory and are shared
+   * with the replacing chunk. Indices are recreated from get_indexes(), i.e., indices that were created on the chunk
+   * directly instead of via create_index() are lost. The values of strings that are too long for the small string
+   * optimization stay on the heap.
+   * @{
+   */
+
+  // Moves the columns of the chunk to a file at path. Does nothing if the chunk is already evicted.
+  void evict_chunk(const ChunkID chunk_id, const std::string& path);
+
+  bool chunk_is_evicted(const ChunkID chunk_id) const;
+
+  std::shared_ptr<ChunkStatistics> chunk_statistics(const ChunkID chunk_id) const;
+
   /** @} */
 
   /**
@@ -119,7 +161,8 @@ class Table : private Noncopyable {
     Assert(column_id < column_count(), "column_id invalid");
 
     size_t row_counter = 0u;
-    for (auto& chunk : _chunks) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+      const auto chunk = get_chunk(chunk_id);
       size_t current_size = chunk->size();
       row_counter += current_size;
       if (row_counter > row_number) {
@@ -144,26 +187,60 @@ class Table : private Noncopyable {
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
     ColumnIndexType index_type = get_index_type_of<Index>();
 
-    for (auto& chunk : _chunks) {
-      chunk->create_index<Index>(column_ids);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+      get_chunk(chunk_id)->create_index<Index>(column_ids);
     }
     IndexInfo i = {column_ids, name, index_type};
+    std::lock_guard<std::mutex> lock(*_index_mutex);
     _indexes.emplace_back(i);
   }
 
+  /**
+   * Adds an index to get_indexes() whose chunk indices have already been created, e.g., by the IndexCreationTask.
+   * Indices in get_indexes() are created for chunks that are evicted and, via create_missing_indexes(), for chunks that
+   * are encoded later on.
+   */
+  void register_index(const IndexInfo& index_info);
+
+  // Creates the indices of get_indexes() that the chunk does not have yet and whose columns are dictionary-encoded
+  void create_missing_indexes(const ChunkID chunk_id);
+
+  /**
+   * Creates a table-wide hash index on column_id that covers all chunks, including the mutable ones, and is kept up
+   * to date by the Insert operator. See BasePrimaryKeyIndex for details. Must not be called while rows are inserted.
+   */
+  void create_primary_key_index(const ColumnID column_id);
+
+  // Returns nullptr if the table has no primary key index
+  std::shared_ptr<BasePrimaryKeyIndex> primary_key_index() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Columns)
    */
   size_t estimate_memory_usage() const;
 
+  /**
+   * Returns the memory held by this Table, broken down by component and summed up over all Chunks
+   */
+  MemoryUsage memory_usage() const;
+
  protected:
   const TableColumnDefinitions _column_definitions;
   const TableType _type;
   const UseMvcc _use_mvcc;
   const uint32_t _max_chunk_size;
-  std::vector<std::shared_ptr<Chunk>> _chunks;
+
+  // Appending does not move existing chunks. Entries are accessed atomically, as evict_chunk() replaces them. Only the
+  // first _chunk_count entries are completely appended.
+  tbb::concurrent_vector<std::shared_ptr<Chunk>> _chunks;
+  std::atomic<ChunkID::base_type> _chunk_count{0};
+  std::set<ChunkID> _evicted_chunk_ids;
+  std::unique_ptr<std::mutex> _eviction_mutex;
+
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  std::unique_ptr<std::mutex> _index_mutex;
+  std::shared_ptr<BasePrimaryKeyIndex> _primary_key_index;
 };
 }  // namespace opossum
@@ -151,6 +151,15 @@ size_t ValueColumn<T>::estimate_memory_usage() const {
   return sizeof(*this) + _values.size() * sizeof(T) + (_null_values ? _null_values->size() * sizeof(bool) : 0u);
 }
 
+template <typename T>
+MemoryUsage ValueColumn<T>::memory_usage() const {
+  auto usage = MemoryUsage{};
+  usage.data = container_memory_usage(_values);
+  usage.null_values = _null_values ? container_memory_usage(*_null_values) : 0u;
+  usage.metadata = sizeof(*this);
+  return usage;
+}
+
 EXPLICITLY_INSTANTIATE_DATA_TYPES(ValueColumn);
 
 }  // namespace opossum
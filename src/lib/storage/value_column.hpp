@@ -62,6 +62,8 @@ class ValueColumn : public BaseValueColumn {
 
   size_t estimate_memory_usage() const override;
 
+  MemoryUsage memory_usage() const override;
+
  protected:
   pmr_concurrent_vector<T> _values;
 
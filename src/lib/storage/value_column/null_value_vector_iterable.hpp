@@ -23,6 +23,14 @@ class NullValueVectorIterable : public PointAccessibleColumnIterable<NullValueVe
     functor(begin, end);
   }
 
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset,
+                          const Functor& functor) const {
+    auto begin = Iterator{_null_values.cbegin(), _null_values.cbegin() + begin_chunk_offset};
+    auto end = Iterator{_null_values.cbegin(), _null_values.cbegin() + end_chunk_offset};
+    functor(begin, end);
+  }
+
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
     auto begin = PointAccessIterator{_null_values, mapped_chunk_offsets.cbegin()};
@@ -27,6 +27,24 @@ class ValueColumnIterable : public PointAccessibleColumnIterable<ValueColumnIter
     functor(begin, end);
   }
 
+  template <typename Functor>
+  void _on_with_iterators(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset,
+                          const Functor& functor) const {
+    const auto values_begin = _column.values().cbegin();
+
+    if (_column.is_nullable()) {
+      const auto null_values_begin = _column.null_values().cbegin();
+      auto begin = Iterator{values_begin, values_begin + begin_chunk_offset, null_values_begin + begin_chunk_offset};
+      auto end = Iterator{values_begin, values_begin + end_chunk_offset, null_values_begin + end_chunk_offset};
+      functor(begin, end);
+      return;
+    }
+
+    auto begin = NonNullIterator{values_begin, values_begin + begin_chunk_offset};
+    auto end = NonNullIterator{values_begin, values_begin + end_chunk_offset};
+    functor(begin, end);
+  }
+
   template <typename Functor>
   void _on_with_iterators(const ChunkOffsetsList& mapped_chunk_offsets, const Functor& functor) const {
     if (_column.is_nullable()) {
@@ -1,29 +1,43 @@
 #include "chunk_compression_task.hpp"
 
+#include <algorithm>
+#include <memory>
+#include <numeric>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "concurrency/transaction_manager.hpp"
+#include "logging/redo_log.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_column.hpp"
 
+#include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id)
-    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                           const std::optional<ColumnID>& sort_column_id)
+    : ChunkCompressionTask{table_name, std::vector<ChunkID>{chunk_id}, sort_column_id} {}
 
-ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
-    : _table_name{table_name}, _chunk_ids{chunk_ids} {}
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const std::optional<ColumnID>& sort_column_id)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _sort_column_id{sort_column_id} {}
 
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
 
   Assert(table != nullptr, "Table does not exist.");
 
+  // Records of the redo log identify rows by their RowIDs, which sorting would silently change
+  Assert(!_sort_column_id || !RedoLog::get().is_open(), "Chunks cannot be sorted while the redo log is open.");
+
   for (auto chunk_id : _chunk_ids) {
     Assert(chunk_id < table->chunk_count(), "Chunk with given ID does not exist.");
 
@@ -32,7 +46,28 @@ void ChunkCompressionTask::_on_execute() {
     DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
+    if (_sort_column_id) {
+      Assert(*_sort_column_id < table->column_count(), "Sort column does not exist.");
+      sort_chunk(chunk, *_sort_column_id, table->column_data_types());
+
+      // The rows of the chunk have moved, so their entries in the primary key index are replaced
+      if (const auto primary_key_index = table->primary_key_index()) {
+        primary_key_index->erase_chunk(chunk_id);
+        primary_key_index->insert(*chunk->get_column(primary_key_index->column_id()), chunk_id, ChunkOffset{0},
+                                  static_cast<ChunkOffset>(chunk->size()));
+      }
+    }
+
     ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+
+    // Indices of the table can be created now that the chunk is immutable
+    table->create_missing_indexes(chunk_id);
+  }
+
+  // Deletes and Updates leave the entries of the old rows in the primary key index. Completed chunks are compressed
+  // regularly as rows are inserted, so this is where the entries that no transaction can see anymore are removed.
+  if (const auto primary_key_index = table->primary_key_index()) {
+    primary_key_index->prune(*table, TransactionManager::get().oldest_active_snapshot_commit_id());
   }
 }
 
@@ -48,4 +83,78 @@ bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<Chunk>& chun
   return true;
 }
 
+void ChunkCompressionTask::sort_chunk(const std::shared_ptr<Chunk>& chunk, const ColumnID sort_column_id,
+                                      const std::vector<DataType>& data_types) {
+  Assert(chunk->is_mutable(), "Only uncompressed chunks can be sorted.");
+
+  const auto chunk_size = chunk->size();
+
+  // Determine the order of the rows. NULLs come first, rows with equal values keep their relative order.
+  auto permutation = std::vector<ChunkOffset>(chunk_size);
+  std::iota(permutation.begin(), permutation.end(), ChunkOffset{0});
+
+  resolve_data_type(data_types[sort_column_id], [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto& column = static_cast<const ValueColumn<ColumnDataType>&>(*chunk->get_column(sort_column_id));
+    const auto& values = column.values();
+
+    std::stable_sort(permutation.begin(), permutation.end(), [&](const ChunkOffset left, const ChunkOffset right) {
+      if (column.is_nullable()) {
+        const auto left_is_null = column.null_values()[left];
+        const auto right_is_null = column.null_values()[right];
+        if (left_is_null || right_is_null) return left_is_null && !right_is_null;
+      }
+      return values[left] < values[right];
+    });
+  });
+
+  // Apply the permutation to all columns
+  for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+    resolve_data_type(data_types[column_id], [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      const auto& column = static_cast<const ValueColumn<ColumnDataType>&>(*chunk->get_column(column_id));
+      const auto& values = column.values();
+
+      auto sorted_values = pmr_concurrent_vector<ColumnDataType>(chunk_size);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        sorted_values[chunk_offset] = values[permutation[chunk_offset]];
+      }
+
+      auto sorted_column = std::shared_ptr<ValueColumn<ColumnDataType>>{};
+      if (column.is_nullable()) {
+        const auto& null_values = column.null_values();
+        auto sorted_null_values = pmr_concurrent_vector<bool>(chunk_size);
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          sorted_null_values[chunk_offset] = null_values[permutation[chunk_offset]];
+        }
+        sorted_column =
+            std::make_shared<ValueColumn<ColumnDataType>>(std::move(sorted_values), std::move(sorted_null_values));
+      } else {
+        sorted_column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(sorted_values));
+      }
+
+      chunk->replace_column(column_id, sorted_column);
+    });
+  }
+
+  // The MVCC information has to move with the rows
+  if (chunk->has_mvcc_columns()) {
+    auto mvcc_columns = chunk->mvcc_columns();
+
+    const auto tids = std::vector<TransactionID>(mvcc_columns->tids.begin(), mvcc_columns->tids.end());
+    const auto begin_cids = std::vector<CommitID>(mvcc_columns->begin_cids.begin(), mvcc_columns->begin_cids.end());
+    const auto end_cids = std::vector<CommitID>(mvcc_columns->end_cids.begin(), mvcc_columns->end_cids.end());
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_columns->tids[chunk_offset] = tids[permutation[chunk_offset]];
+      mvcc_columns->begin_cids[chunk_offset] = begin_cids[permutation[chunk_offset]];
+      mvcc_columns->end_cids[chunk_offset] = end_cids[permutation[chunk_offset]];
+    }
+  }
+
+  chunk->set_ordered_by(std::make_pair(sort_column_id, OrderByMode::Ascending));
+}
+
 }  // namespace opossum
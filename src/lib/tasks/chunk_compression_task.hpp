@@ -1,8 +1,11 @@
 #pragma once
 
+#include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
+#include "all_type_variant.hpp"
 #include "scheduler/abstract_task.hpp"
 
 namespace opossum {
@@ -33,11 +36,22 @@ class Chunk;
  *
  * Note: Reference columns are not invalidated by this task because the order in which
  *       records are stored does not change.
+ *
+ * Afterwards, the entries of deleted rows that no transaction can see anymore are pruned from the table's primary key
+ * index (see BasePrimaryKeyIndex::prune()).
+ *
+ * Optionally, the rows of the chunk can be sorted by a column (NULLs first) before it is compressed. The chunk is then
+ * marked as sorted (see Chunk::ordered_by()), which allows operators to, e.g., binary search instead of scanning it.
+ * Because re-sorting changes the position of the records, it must only be used when no other operators and
+ * transactions are accessing the chunk (e.g., directly after the table was loaded). For the same reason, chunks cannot
+ * be sorted while the RedoLog is open. Sort them before the log is opened and take a checkpoint afterwards.
  */
 class ChunkCompressionTask : public AbstractTask {
  public:
-  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
-  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id,
+                                const std::optional<ColumnID>& sort_column_id = std::nullopt);
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                const std::optional<ColumnID>& sort_column_id = std::nullopt);
 
  protected:
   void _on_execute() override;
@@ -50,8 +64,15 @@ class ChunkCompressionTask : public AbstractTask {
    */
   bool chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size);
 
+  /**
+   * @brief Stably sorts all columns (and the MVCC columns) of an uncompressed chunk by the given column
+   */
+  static void sort_chunk(const std::shared_ptr<Chunk>& chunk, const ColumnID sort_column_id,
+                         const std::vector<DataType>& data_types);
+
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const std::optional<ColumnID> _sort_column_id;
 };
 }  // namespace opossum
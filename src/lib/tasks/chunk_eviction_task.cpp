@@ -0,0 +1,43 @@
+#include "chunk_eviction_task.hpp"
+
+#include <memory>
+#include <string>
+
+#include "storage/base_encoded_column.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkEvictionTask::ChunkEvictionTask(const std::string& table_name, const std::string& directory,
+                                     const size_t lookback, const uint64_t max_access_time)
+    : _table_name{table_name}, _directory{directory}, _lookback{lookback}, _max_access_time{max_access_time} {}
+
+void ChunkEvictionTask::_on_execute() {
+  auto table = StorageManager::get().get_table(_table_name);
+
+  Assert(table != nullptr, "Table does not exist.");
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (table->chunk_is_evicted(chunk_id) || !chunk_is_cold(*table->get_chunk(chunk_id), _lookback, _max_access_time)) {
+      continue;
+    }
+
+    const auto path = _directory + "/" + _table_name + "_" + std::to_string(chunk_id) + ".chunk";
+    table->evict_chunk(chunk_id, path);
+  }
+}
+
+bool ChunkEvictionTask::chunk_is_cold(const Chunk& chunk, const size_t lookback, const uint64_t max_access_time) {
+  if (!chunk.has_access_counter()) return false;
+
+  for (const auto& column : chunk.columns()) {
+    if (!std::dynamic_pointer_cast<const BaseEncodedColumn>(column)) return false;
+  }
+
+  return chunk.access_counter()->history_sample(lookback) <= max_access_time;
+}
+
+}  // namespace opossum
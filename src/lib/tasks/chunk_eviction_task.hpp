@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "scheduler/abstract_task.hpp"
+
+namespace opossum {
+
+class Chunk;
+
+/**
+ * @brief Evicts cold chunks of a table to memory-mapped files (see Table::evict_chunk())
+ *
+ * A chunk is considered cold if the access time recorded by its ChunkAccessCounter during the last lookback history
+ * samples (see ChunkMetricsCollectionTask) does not exceed max_access_time. Only chunks with an access counter whose
+ * columns are all encoded are evicted. The files are placed in directory and named after the table and chunk id.
+ */
+class ChunkEvictionTask : public AbstractTask {
+ public:
+  explicit ChunkEvictionTask(const std::string& table_name, const std::string& directory, const size_t lookback,
+                             const uint64_t max_access_time = 0u);
+
+  static bool chunk_is_cold(const Chunk& chunk, const size_t lookback, const uint64_t max_access_time);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::string _table_name;
+  const std::string _directory;
+  const size_t _lookback;
+  const uint64_t _max_access_time;
+};
+}  // namespace opossum
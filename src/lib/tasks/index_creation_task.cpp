@@ -0,0 +1,52 @@
+#include "index_creation_task.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "scheduler/parallel_for.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/index_info.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+IndexCreationTask::IndexCreationTask(const std::string& table_name, const std::vector<ColumnID>& column_ids,
+                                     const ColumnIndexType index_type, const std::string& index_name)
+    : _table_name{table_name}, _column_ids{column_ids}, _index_type{index_type}, _index_name{index_name} {}
+
+void IndexCreationTask::_on_execute() {
+  const auto table = StorageManager::get().get_table(_table_name);
+
+  Assert(!_column_ids.empty(), "An index needs at least one column");
+  for (const auto column_id : _column_ids) {
+    Assert(column_id < table->column_count(), "ColumnID " + std::to_string(column_id) + " out of range");
+  }
+  Assert(_index_type != ColumnIndexType::Invalid, "Invalid index type");
+
+  const auto chunk_count = table->chunk_count();
+
+  auto chunks = std::vector<std::shared_ptr<Chunk>>{};
+  chunks.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk->columns_are_indexable(_column_ids) || chunk->get_index(_index_type, _column_ids)) continue;
+
+    chunks.emplace_back(chunk);
+  }
+
+  parallel_for(size_t{0}, chunks.size(),
+               [&](const size_t chunk_index) { chunks[chunk_index]->create_index(_index_type, _column_ids); });
+
+  table->register_index(IndexInfo{_column_ids, _index_name, _index_type});
+
+  // Chunks that were appended or encoded in the meantime did not know about the index yet
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->create_missing_indexes(chunk_id);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "storage/index/column_index_type.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Creates an index on all chunks of a table
+ *
+ * The chunk indices are built in parallel using parallel_for() (or sequentially, if no scheduler is set). Once all of
+ * them are done, the index is registered in Table::get_indexes(), so that the optimizer only sees it when all chunks
+ * can use it.
+ *
+ * Indices can only be built on dictionary-encoded columns. Chunks that are still mutable are skipped, their indices
+ * are created by ChunkCompressionTask and ChunkEncoder once they are encoded. Chunks that were encoded while the task
+ * was running are indexed after the index has been registered.
+ */
+class IndexCreationTask : public AbstractTask {
+ public:
+  IndexCreationTask(const std::string& table_name, const std::vector<ColumnID>& column_ids,
+                    const ColumnIndexType index_type, const std::string& index_name = "");
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::string _table_name;
+  const std::vector<ColumnID> _column_ids;
+  const ColumnIndexType _index_type;
+  const std::string _index_name;
+};
+
+}  // namespace opossum
@@ -2,6 +2,13 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "scheduler/cancellation_token.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 
 namespace opossum {
@@ -10,11 +17,14 @@ void CreatePipelineTask::_on_execute() {
   auto result = std::make_unique<CreatePipelineResult>();
 
   try {
-    result->sql_pipeline = std::make_shared<SQLPipeline>(SQLPipelineBuilder{_sql}.create_pipeline());
+    result->sql_pipeline = std::make_shared<SQLPipeline>(
+        SQLPipelineBuilder{_sql}.with_statement_timeout(_statement_timeout).create_pipeline());
   } catch (const std::exception& exception) {
-    // Try LOAD file_name table_name
+    // Try LOAD file_name table_name and SET statement_timeout = milliseconds
     if (_allow_load_table && _is_load_table()) {
       result->load_table = std::make_pair(_file_name, _table_name);
+    } else if (_allow_load_table && _is_set_statement_timeout()) {
+      result->statement_timeout = _new_statement_timeout;
     } else {
       // Setting the exception this way ensures that the details are preserved in the futures
       // Important: std::current_exception apparently does not work
@@ -46,4 +56,28 @@ bool CreatePipelineTask::_is_load_table() {
   return true;
 }
 
+bool CreatePipelineTask::_is_set_statement_timeout() {
+  std::vector<std::string> words;
+  boost::split(words, _sql, boost::is_any_of(" ="), boost::token_compress_on);
+
+  // We expect SET statement_timeout = milliseconds or SET statement_timeout TO milliseconds
+  if (words.size() == 4 && boost::iequals(words[2], "TO")) words.erase(words.begin() + 2);
+  if (words.size() != 3) return false;
+  if (!boost::iequals(words[0], "SET") || !boost::iequals(words[1], "statement_timeout")) return false;
+
+  // Remove the \0-byte and the semicolon at the end
+  auto& value = words[2];
+  while (!value.empty() && (value.back() == '\0' || value.back() == ';')) value.pop_back();
+
+  // This is called while handling the parse error, so invalid values must not throw
+  auto milliseconds = int64_t{0};
+  const auto value_end = value.data() + value.size();
+  const auto result = std::from_chars(value.data(), value_end, milliseconds);
+  if (result.ec != std::errc{} || result.ptr != value_end) return false;
+  if (milliseconds < 0 || milliseconds > CancellationToken::MAX_TIMEOUT.count()) return false;
+
+  _new_statement_timeout = std::chrono::milliseconds{milliseconds};
+  return true;
+}
+
 }  // namespace opossum
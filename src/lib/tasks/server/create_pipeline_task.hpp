@@ -2,6 +2,8 @@
 
 #include <boost/thread/future.hpp>
 
+#include <chrono>
+
 #include "abstract_server_task.hpp"
 
 namespace opossum {
@@ -11,6 +13,7 @@ class SQLPipeline;
 struct CreatePipelineResult {
   std::shared_ptr<SQLPipeline> sql_pipeline;
   std::optional<std::pair<std::string, std::string>> load_table;
+  std::optional<std::chrono::milliseconds> statement_timeout;
 };
 
 // This task is used to parse an SQL string from a client and wrap it in an SQLPipeline. It is a separate task and not
@@ -18,8 +21,9 @@ struct CreatePipelineResult {
 // load on the main server thread to a miminum.
 class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipelineResult>> {
  public:
-  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false)
-      : _sql(sql), _allow_load_table(allow_load_table) {}
+  explicit CreatePipelineTask(std::string sql, bool allow_load_table = false,
+                              std::chrono::milliseconds statement_timeout = std::chrono::milliseconds{0})
+      : _sql(sql), _allow_load_table(allow_load_table), _statement_timeout(statement_timeout) {}
 
  protected:
   void _on_execute() override;
@@ -29,11 +33,17 @@ class CreatePipelineTask : public AbstractServerTask<std::unique_ptr<CreatePipel
   // interpret it as a LOAD <file-name> <table-name> command. If this doesn't work, we pass on the parse error.
   bool _is_load_table();
 
+  // Similarly, the statement timeout of the session is set with SET statement_timeout = <milliseconds>, which the SQL
+  // parser does not support. Only allowed where LOAD is, i.e., in simple queries.
+  bool _is_set_statement_timeout();
+
   const std::string _sql;
   const bool _allow_load_table;
+  const std::chrono::milliseconds _statement_timeout;
 
   std::string _file_name;
   std::string _table_name;
+  std::chrono::milliseconds _new_statement_timeout{0};
 };
 
 }  // namespace opossum
@@ -1,8 +1,12 @@
 #include "execute_server_prepared_statement_task.hpp"
 
+#include <algorithm>
+#include <memory>
+
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
-#include "scheduler/current_scheduler.hpp"
+#include "scheduler/admission_control.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "sql/sql_query_plan.hpp"
 
 namespace opossum {
@@ -10,7 +14,21 @@ namespace opossum {
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
     const auto tasks = _prepared_plan->create_tasks();
-    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+    const auto cancellation_token = std::make_shared<CancellationToken>();
+    for (const auto& task : tasks) {
+      task->set_cancellation_token(cancellation_token);
+    }
+    if (_statement_timeout.count() > 0) cancellation_token->cancel_after(_statement_timeout);
+
+    AdmissionControl::get().schedule_and_wait_for_query(tasks);
+
+    // If some operators did not execute (completely) because the query was cancelled, the result must not be used.
+    // The session aborts its transaction when it receives the exception.
+    const auto was_cancelled =
+        std::any_of(tasks.cbegin(), tasks.cend(), [](const auto& task) { return task->was_cancelled(); });
+    if (was_cancelled) cancellation_token->check();
+
     auto result_table = tasks.back()->get_operator()->get_output();
     _promise.set_value(std::move(result_table));
   } catch (const std::exception&) {
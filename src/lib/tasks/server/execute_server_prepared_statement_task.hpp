@@ -1,5 +1,7 @@
 #pragma once
 
+#include <chrono>
+
 #include "abstract_server_task.hpp"
 
 namespace opossum {
@@ -8,16 +10,20 @@ class SQLQueryPlan;
 class TransactionContext;
 class Table;
 
-// This task takes a query plan of a prepared statement and executes it.
+// This task takes a query plan of a prepared statement and executes it. Just like statements executed by an
+// SQLPipelineStatement, it is cancelled once statement_timeout has passed (0 disables the timeout).
 class ExecuteServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<const Table>> {
  public:
-  explicit ExecuteServerPreparedStatementTask(std::shared_ptr<SQLQueryPlan> prepared_plan)
-      : _prepared_plan(std::move(prepared_plan)) {}
+  explicit ExecuteServerPreparedStatementTask(
+      std::shared_ptr<SQLQueryPlan> prepared_plan,
+      std::chrono::milliseconds statement_timeout = std::chrono::milliseconds{0})
+      : _prepared_plan(std::move(prepared_plan)), _statement_timeout(statement_timeout) {}
 
  protected:
   void _on_execute() override;
 
   std::shared_ptr<SQLQueryPlan> _prepared_plan;
+  const std::chrono::milliseconds _statement_timeout;
 };
 
 }  // namespace opossum
@@ -25,7 +25,7 @@
  *   ChunkID x{3}; or
  *   auto x = ChunkID{3};
  *
- * WorkerID, TaskID, CommitID, and TransactionID are used in std::atomics and
+ * WorkerID, TaskID, SessionID, CommitID, and TransactionID are used in std::atomics and
  * therefore need to be trivially copyable. That's currently not possible with
  * the strong typedef (as far as I know).
  *
@@ -122,6 +122,7 @@ struct RowID {
 
 using WorkerID = uint32_t;
 using TaskID = uint32_t;
+using SessionID = uint32_t;
 
 // When changing these to 64-bit types, reading and writing to them might not be atomic anymore.
 // Among others, the validate operator might break when another operator is simultaneously writing begin or end CIDs.
@@ -139,6 +140,7 @@ constexpr NodeID INVALID_NODE_ID{std::numeric_limits<NodeID::base_type>::max()};
 constexpr TaskID INVALID_TASK_ID{std::numeric_limits<TaskID>::max()};
 constexpr CpuID INVALID_CPU_ID{std::numeric_limits<CpuID::base_type>::max()};
 constexpr WorkerID INVALID_WORKER_ID{std::numeric_limits<WorkerID>::max()};
+constexpr SessionID INVALID_SESSION_ID{std::numeric_limits<SessionID>::max()};
 constexpr ColumnID INVALID_COLUMN_ID{std::numeric_limits<ColumnID::base_type>::max()};
 
 constexpr NodeID CURRENT_NODE_ID{std::numeric_limits<NodeID::base_type>::max() - 1};
@@ -151,11 +153,11 @@ constexpr ValueID NULL_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
 constexpr ValueID INVALID_VALUE_ID{std::numeric_limits<ValueID::base_type>::max()};
 
-// The Scheduler currently supports just these 2 priorities, subject to change.
+// The Scheduler currently supports just these 3 priorities, subject to change.
 enum class SchedulePriority {
   Unstealable = 2,  // Schedule task at the end of the queue with disabled workstealing
-  Normal = 1,       // Schedule task at the end of the queue
-  High = 0          // Schedule task at the beginning of the queue
+  Normal = 1,       // Schedule task at the end of the queue of its session, sessions are served round-robin
+  High = 0          // Schedule task in the queue that is served first, even if scheduled from a Worker
 };
 
 // Part of AllParameterVariant to reference parameters that will be replaced later.
@@ -256,6 +258,8 @@ enum class DescriptionMode { SingleLine, MultiLine };
 
 enum class UseMvcc : bool { Yes = true, No = false };
 
+enum class UsePipelining : bool { Yes = true, No = false };
+
 class Noncopyable {
  protected:
   Noncopyable() = default;
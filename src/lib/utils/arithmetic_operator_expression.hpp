@@ -12,4 +12,13 @@ namespace opossum {
 template <typename T>
 std::function<T(const T&, const T&)> function_for_arithmetic_expression(ExpressionType type);
 
+/**
+ * Calls functor with the function object (e.g., std::plus<T>) for the arithmetic operator of the given ExpressionType.
+ * In contrast to the std::function returned by function_for_arithmetic_expression(), the function object can be
+ * inlined, which allows the compiler to vectorize loops that apply the operator to entire columns. Integer divisors
+ * are not checked for 0, the caller has to do that.
+ */
+template <typename T, typename Functor>
+void resolve_arithmetic_operator(ExpressionType type, const Functor& functor);
+
 }  // namespace opossum
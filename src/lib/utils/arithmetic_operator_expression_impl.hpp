@@ -1,6 +1,11 @@
 #pragma once
 
-#include <types.hpp>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "types.hpp"
 
 namespace opossum {
 
@@ -75,4 +80,44 @@ inline std::function<int(const int&, const int&)> function_for_arithmetic_expres
   return _get_base_operator_function<int>(type);
 }
 
+template <typename T, typename Functor>
+void _resolve_base_arithmetic_operator(ExpressionType type, const Functor& functor) {
+  switch (type) {
+    case ExpressionType::Addition:
+      functor(std::plus<T>());
+      break;
+    case ExpressionType::Subtraction:
+      functor(std::minus<T>());
+      break;
+    case ExpressionType::Multiplication:
+      functor(std::multiplies<T>());
+      break;
+    case ExpressionType::Division:
+      functor(std::divides<T>());
+      break;
+
+    default:
+      Fail("Unknown arithmetic operator");
+  }
+}
+
+template <typename T, typename Functor>
+void resolve_arithmetic_operator(ExpressionType type, const Functor& functor) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    Assert(type == ExpressionType::Addition, "Arithmetic operator except for addition not defined for std::string");
+    functor(std::plus<T>());
+  } else if constexpr (std::is_integral_v<T>) {  // NOLINT
+    // Divisors are not checked for 0, so that loops applying the operator stay free of branches. Callers have to
+    // check them beforehand (see Projection).
+    if (type == ExpressionType::Modulo) {
+      functor(std::modulus<T>());
+    } else {
+      _resolve_base_arithmetic_operator<T>(type, functor);
+    }
+  } else {  // NOLINT
+    // Modulo on floating-point types isn't defined.
+    _resolve_base_arithmetic_operator<T>(type, functor);
+  }
+}
+
 }  // namespace opossum
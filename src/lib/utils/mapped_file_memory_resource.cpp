@@ -0,0 +1,82 @@
+#include "mapped_file_memory_resource.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <boost/container/pmr/global_resource.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MappedFileMemoryResource::MappedFileMemoryResource(const std::string& path, const size_t capacity)
+    : _path(path), _capacity(std::max(capacity, size_t{1})), _mapping(nullptr) {
+  const auto file_descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  Assert(file_descriptor != -1, "Cannot create " + path + ": " + std::strerror(errno));
+
+  // The file is sparse, only the pages that are written occupy disk space
+  const auto truncated = ::ftruncate(file_descriptor, static_cast<off_t>(_capacity)) == 0;
+  auto* const mapping =
+      truncated ? ::mmap(nullptr, _capacity, PROT_READ | PROT_WRITE, MAP_SHARED, file_descriptor, 0) : MAP_FAILED;
+  const auto error = errno;
+  ::close(file_descriptor);
+
+  if (mapping == MAP_FAILED) {
+    std::remove(path.c_str());
+    Fail("Cannot map " + path + ": " + std::strerror(error));
+  }
+
+  _mapping = static_cast<char*>(mapping);
+}
+
+MappedFileMemoryResource::~MappedFileMemoryResource() {
+  ::munmap(_mapping, _capacity);
+  std::remove(_path.c_str());
+}
+
+void MappedFileMemoryResource::release_to_file() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_offset == 0) return;
+
+  // Clean pages can be dropped by the OS without writing them first
+  Assert(::msync(_mapping, _offset, MS_SYNC) == 0, "Cannot write " + _path + ": " + std::strerror(errno));
+  ::madvise(_mapping, _capacity, MADV_DONTNEED);
+}
+
+const std::string& MappedFileMemoryResource::path() const { return _path; }
+
+size_t MappedFileMemoryResource::mapped_bytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _offset;
+}
+
+void* MappedFileMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const auto begin = (_offset + alignment - 1) / alignment * alignment;
+    if (begin + bytes <= _capacity) {
+      _offset = begin + bytes;
+      return _mapping + begin;
+    }
+  }
+
+  return boost::container::pmr::get_default_resource()->allocate(bytes, alignment);
+}
+
+void MappedFileMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+  const auto* const address = static_cast<const char*>(pointer);
+  if (address >= _mapping && address < _mapping + _capacity) return;
+
+  boost::container::pmr::get_default_resource()->deallocate(pointer, bytes, alignment);
+}
+
+bool MappedFileMemoryResource::do_is_equal(const memory_resource& other) const noexcept { return this == &other; }
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <mutex>
+#include <string>
+
+namespace opossum {
+
+/**
+ * Memory resource that places allocations in a file that is memory-mapped with MAP_SHARED. Data allocated from it is
+ * backed by the file instead of by anonymous memory, so once it has been written back (see release_to_file()), the OS
+ * page cache decides whether it stays in DRAM, and the kernel reads it back from the file on access.
+ *
+ * Allocations are placed one after another and never reused, deallocating is a no-op. Allocations that do not fit
+ * into the capacity fall back to the default resource. The file is removed when the resource is destroyed.
+ */
+class MappedFileMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  // Creates the file at path (overwriting it if it exists) with capacity bytes and maps it into memory
+  MappedFileMemoryResource(const std::string& path, const size_t capacity);
+
+  ~MappedFileMemoryResource() override;
+
+  MappedFileMemoryResource(const MappedFileMemoryResource&) = delete;
+  MappedFileMemoryResource& operator=(const MappedFileMemoryResource&) = delete;
+
+  /**
+   * Writes the allocated data to the file and releases the mapped pages from the process. The data stays valid and
+   * accessible, pages are faulted in again from the page cache or the file.
+   */
+  void release_to_file();
+
+  const std::string& path() const;
+
+  // Number of bytes allocated within the mapped file
+  size_t mapped_bytes() const;
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+  bool do_is_equal(const memory_resource& other) const noexcept override;
+
+ private:
+  const std::string _path;
+  const size_t _capacity;
+  char* _mapping;
+
+  mutable std::mutex _mutex;
+  size_t _offset{0};
+};
+
+}  // namespace opossum
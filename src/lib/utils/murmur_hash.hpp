@@ -15,7 +15,8 @@ typename std::enable_if<std::is_arithmetic<T>::value, unsigned int>::type murmur
 
 // murmur hash for std::string
 template <typename T>
-typename std::enable_if<std::is_same<T, std::string>::value, unsigned int>::type murmur2(T key, unsigned int seed) {
+typename std::enable_if<std::is_same<T, std::string>::value, unsigned int>::type murmur2(const T& key,
+                                                                                         unsigned int seed) {
   return murmur_hash2(key.c_str(), key.size(), seed);
 }
 
@@ -7,8 +7,11 @@
 
 #include "concurrency/transaction_manager.hpp"
 #include "gtest/gtest.h"
+#include "logging/redo_log.hpp"
 #include "operators/abstract_operator.hpp"
+#include "scheduler/admission_control.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/scheduler_tracer.hpp"
 #include "storage/column_encoding_utils.hpp"
 #include "storage/dictionary_column.hpp"
 #include "storage/numa_placement_manager.hpp"
@@ -72,6 +75,9 @@ class BaseTestWithParam : public std::conditional<std::is_same<ParamType, void>:
 
     StorageManager::reset();
     TransactionManager::reset();
+    AdmissionControl::reset();
+    SchedulerTracer::reset();
+    RedoLog::reset();
   }
 };
 
@@ -106,4 +106,22 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, TracksOldestActiveSnapshot) {
+  auto old_context = manager().new_transaction_context();
+  const auto old_snapshot_commit_id = old_context->snapshot_commit_id();
+
+  manager().new_transaction_context()->commit();
+  auto new_context = manager().new_transaction_context();
+  EXPECT_EQ(new_context->snapshot_commit_id(), old_snapshot_commit_id + 1);
+
+  EXPECT_EQ(manager().oldest_active_snapshot_commit_id(), old_snapshot_commit_id);
+  old_context.reset();
+  EXPECT_EQ(manager().oldest_active_snapshot_commit_id(), old_snapshot_commit_id + 1);
+
+  // Without running transactions, only future ones have to be considered
+  new_context.reset();
+  manager().new_transaction_context()->commit();
+  EXPECT_EQ(manager().oldest_active_snapshot_commit_id(), manager().last_commit_id());
+}
+
 }  // namespace opossum
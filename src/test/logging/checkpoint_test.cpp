@@ -0,0 +1,317 @@
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace filesystem = std::filesystem;
+#else
+#include <experimental/filesystem>
+namespace filesystem = std::experimental::filesystem;
+#endif
+
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logging/checkpoint.hpp"
+#include "logging/redo_log.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+
+namespace opossum {
+
+// Exposes the steps of create() and recover(), so that a chunk can be written as of an earlier commit ID
+class CheckpointSteps : public Checkpoint {
+ public:
+  using Checkpoint::_read_chunk;
+  using Checkpoint::_replay;
+  using Checkpoint::_write_chunk;
+};
+
+class CheckpointTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    filesystem::create_directory(_directory);
+
+    _table_a = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table_a);
+  }
+
+  void TearDown() override {
+    RedoLog::get().close();
+    filesystem::remove_all(_directory);
+  }
+
+  // Executes an Insert of a single row into table_a, without committing
+  std::shared_ptr<TransactionContext> _insert(const int32_t a, const float b) {
+    auto values = std::make_shared<Table>(_table_a->column_definitions(), TableType::Data);
+    values->append({a, b});
+    auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    auto context = TransactionManager::get().new_transaction_context();
+    auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return context;
+  }
+
+  // Executes a Delete of the rows of table_a with the given value in column a, without committing
+  std::shared_ptr<TransactionContext> _delete(const int32_t a) {
+    auto context = TransactionManager::get().new_transaction_context();
+
+    auto get_table = std::make_shared<GetTable>("table_a");
+    get_table->execute();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    auto table_scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::Equals, a);
+    table_scan->execute();
+
+    auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+    delete_op->set_transaction_context(context);
+    delete_op->execute();
+    return context;
+  }
+
+  std::shared_ptr<const Table> _visible_rows(const std::string& table_name) {
+    auto get_table = std::make_shared<GetTable>(table_name);
+    get_table->execute();
+    // Operators only keep a weak pointer to their context
+    const auto context = TransactionManager::get().new_transaction_context();
+    auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<Table> _expected_table(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto table = std::make_shared<Table>(_table_a->column_definitions(), TableType::Data);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  // Simulates a restart
+  void _reset() {
+    StorageManager::reset();
+    TransactionManager::reset();
+  }
+
+  std::shared_ptr<Table> _table_a;
+  const std::string _directory = test_data_path + "checkpoint_test";
+  const std::string _log_file_name = _directory + "/redo.log";
+};
+
+TEST_F(CheckpointTest, RestoresTablesWithEncodingsAndIndexes) {
+  ChunkEncoder::encode_chunks(_table_a, {ChunkID{0}}, EncodingType::Dictionary);
+  _table_a->create_index<GroupKeyIndex>({ColumnID{0}}, "index_a");
+
+  auto table_b = load_table("src/test/tables/int_float.tbl", 2);
+  ChunkEncoder::encode_chunks(table_b, {ChunkID{0}}, EncodingType::RunLength);
+  StorageManager::get().add_table("table_b", table_b);
+
+  const auto commit_id = Checkpoint::create(_directory);
+  EXPECT_EQ(commit_id, TransactionManager::get().last_commit_id());
+
+  _reset();
+  EXPECT_EQ(Checkpoint::recover(_directory, std::nullopt), commit_id);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), commit_id);
+
+  const auto recovered_table_a = StorageManager::get().get_table("table_a");
+  const auto recovered_table_b = StorageManager::get().get_table("table_b");
+  EXPECT_TABLE_EQ_ORDERED(recovered_table_a, _table_a);
+  EXPECT_TABLE_EQ_ORDERED(recovered_table_b, table_b);
+  EXPECT_TABLE_EQ_ORDERED(_visible_rows("table_a"), _table_a);
+
+  ASSERT_EQ(recovered_table_a->chunk_count(), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionaryColumn<int32_t>>(
+      recovered_table_a->get_chunk(ChunkID{0})->get_column(ColumnID{0})));
+  EXPECT_TRUE(recovered_table_a->get_chunk(ChunkID{0})->statistics());
+  EXPECT_TRUE(recovered_table_a->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RunLengthColumn<float>>(
+      recovered_table_b->get_chunk(ChunkID{0})->get_column(ColumnID{1})));
+
+  ASSERT_EQ(recovered_table_a->get_indexes().size(), 1u);
+  EXPECT_EQ(recovered_table_a->get_indexes()[0].name, "index_a");
+  EXPECT_TRUE(recovered_table_a->get_chunk(ChunkID{0})->get_index(ColumnIndexType::GroupKey,
+                                                                  std::vector<ColumnID>{ColumnID{0}}));
+}
+
+TEST_F(CheckpointTest, UncommittedChangesAreNotPartOfCheckpoint) {
+  _insert(42, 4.5f)->commit();
+  const auto uncommitted_insert = _insert(43, 5.5f);
+  const auto uncommitted_delete = _delete(123);
+
+  Checkpoint::create(_directory);
+  uncommitted_insert->commit();
+  uncommitted_delete->commit();
+
+  _reset();
+  Checkpoint::recover(_directory, std::nullopt);
+
+  // The row of the uncommitted Insert keeps its RowID, but is invisible
+  EXPECT_EQ(StorageManager::get().get_table("table_a")->row_count(), 5u);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows("table_a"),
+                            _expected_table({{12345, 458.7f}, {123, 456.7f}, {1234, 457.7f}, {42, 4.5f}}));
+}
+
+TEST_F(CheckpointTest, ReplaysRedoLog) {
+  RedoLog::get().open(_log_file_name);
+
+  _insert(42, 4.5f)->commit();
+  const auto uncommitted_insert = _insert(43, 5.5f);
+  const auto rolled_back_insert = _insert(44, 6.5f);
+
+  Checkpoint::create(_directory);
+
+  // 45 is appended to a new chunk and committed before 43, whose row was reserved before the checkpoint
+  _insert(45, 7.5f)->commit();
+  uncommitted_insert->commit();
+  rolled_back_insert->rollback();
+  _delete(123)->commit();
+
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+  RedoLog::get().close();
+
+  _reset();
+  EXPECT_EQ(Checkpoint::recover(_directory, _log_file_name), last_commit_id);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id);
+
+  EXPECT_TABLE_EQ_UNORDERED(
+      _visible_rows("table_a"),
+      _expected_table({{12345, 458.7f}, {1234, 457.7f}, {42, 4.5f}, {43, 5.5f}, {45, 7.5f}}));
+
+  // Transactions continue after the recovered ones
+  _insert(46, 8.5f)->commit();
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id + 1);
+  EXPECT_EQ(_visible_rows("table_a")->row_count(), 6u);
+}
+
+TEST_F(CheckpointTest, ReplaysInsertsIntoChunksEncodedAfterCheckpoint) {
+  RedoLog::get().open(_log_file_name);
+
+  // 42 completes the second chunk, which is encoded before the checkpoint writes it, but after its commit ID and the
+  // chunk's size were taken
+  const auto commit_id = TransactionManager::get().last_commit_id();
+  const auto row_count = static_cast<ChunkOffset>(_table_a->chunk_size(ChunkID{1}));
+  _insert(42, 4.5f)->commit();
+  ChunkEncoder::encode_chunks(_table_a, {ChunkID{1}},
+                              {{ChunkID{1}, {EncodingType::Dictionary, EncodingType::RunLength}}});
+  RedoLog::get().close();
+  ASSERT_EQ(row_count, 1u);
+
+  const auto file_name = _directory + "/chunk.bin";
+  CheckpointSteps::_write_chunk(_table_a, *_table_a->get_chunk(ChunkID{1}), row_count, commit_id, file_name);
+
+  auto table = std::make_shared<Table>(_table_a->column_definitions(), TableType::Data, 2u);
+  table->append_chunk(_table_a->get_chunk(ChunkID{0}));
+  table->append_chunk(CheckpointSteps::_read_chunk(*table, {}, file_name));
+
+  _reset();
+  StorageManager::get().add_table("table_a", table);
+  EXPECT_EQ(_visible_rows("table_a")->row_count(), 3u);
+  const auto last_commit_id =
+      CheckpointSteps::_replay(RedoLog::read_entries(_log_file_name), commit_id, {{"table_a", table}});
+  TransactionManager::get().set_last_commit_id(last_commit_id);
+
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionaryColumn<int32_t>>(
+      table->get_chunk(ChunkID{1})->get_column(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RunLengthColumn<float>>(
+      table->get_chunk(ChunkID{1})->get_column(ColumnID{1})));
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows("table_a"),
+                            _expected_table({{12345, 458.7f}, {123, 456.7f}, {1234, 457.7f}, {42, 4.5f}}));
+}
+
+TEST_F(CheckpointTest, DoesNotCopyValuesOfUncommittedRows) {
+  // The Insert might still write the values of the row it reserved
+  const auto uncommitted_insert = _insert(42, 4.5f);
+
+  const auto file_name = _directory + "/chunk.bin";
+  CheckpointSteps::_write_chunk(_table_a, *_table_a->get_chunk(ChunkID{1}), 2u,
+                                TransactionManager::get().last_commit_id(), file_name);
+  const auto chunk = CheckpointSteps::_read_chunk(*_table_a, {}, file_name);
+
+  ASSERT_EQ(chunk->size(), 2u);
+  EXPECT_EQ((*chunk->get_column(ColumnID{0}))[0], AllTypeVariant{1234});
+  EXPECT_EQ((*chunk->get_column(ColumnID{0}))[1], AllTypeVariant{0});
+  EXPECT_EQ(chunk->mvcc_columns()->end_cids[1], CommitID{0});
+
+  uncommitted_insert->rollback();
+}
+
+TEST_F(CheckpointTest, ReadsRedoLogFromCheckpoint) {
+  RedoLog::get().open(_log_file_name);
+  _insert(42, 4.5f)->commit();
+  Checkpoint::create(_directory);
+  _insert(43, 5.5f)->commit();
+  RedoLog::get().close();
+
+  // The entry that is part of the checkpoint is not read anymore, even if it is corrupt
+  {
+    std::fstream file(_log_file_name, std::ios::binary | std::ios::in | std::ios::out);
+    const auto garbage = std::string(8, '\xFF');
+    file.write(garbage.data(), static_cast<std::streamsize>(garbage.size()));
+  }
+  EXPECT_EQ(RedoLog::read_entries(_log_file_name).size(), 0u);
+
+  _reset();
+  Checkpoint::recover(_directory, _log_file_name);
+
+  EXPECT_TABLE_EQ_UNORDERED(
+      _visible_rows("table_a"),
+      _expected_table({{12345, 458.7f}, {123, 456.7f}, {1234, 457.7f}, {42, 4.5f}, {43, 5.5f}}));
+}
+
+TEST_F(CheckpointTest, RecoversSortedChunks) {
+  // Chunks are sorted before the log is opened, the checkpoint stores them in their sorted order
+  std::make_shared<ChunkCompressionTask>("table_a", ChunkID{0}, ColumnID{0})->execute();
+  Checkpoint::create(_directory);
+  RedoLog::get().open(_log_file_name);
+
+  // Afterwards, sorting would move the rows that the records of the log refer to
+  EXPECT_THROW(std::make_shared<ChunkCompressionTask>("table_a", ChunkID{0}, ColumnID{0})->execute(), std::logic_error);
+
+  _delete(12345)->commit();
+  RedoLog::get().close();
+
+  _reset();
+  Checkpoint::recover(_directory, _log_file_name);
+
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows("table_a"), _expected_table({{123, 456.7f}, {1234, 457.7f}}));
+}
+
+TEST_F(CheckpointTest, ReplacesPreviousCheckpoint) {
+  Checkpoint::create(_directory);
+  EXPECT_TRUE(filesystem::exists(_directory + "/0_0.bin"));
+
+  _insert(42, 4.5f)->commit();
+  Checkpoint::create(_directory);
+  EXPECT_FALSE(filesystem::exists(_directory + "/0_0.bin"));
+  EXPECT_FALSE(filesystem::exists(_directory + "/0_0_0.bin"));
+
+  _reset();
+  EXPECT_FALSE(Checkpoint::exists(test_data_path));
+  EXPECT_TRUE(Checkpoint::exists(_directory));
+  Checkpoint::recover(_directory, std::nullopt);
+
+  EXPECT_EQ(_visible_rows("table_a")->row_count(), 4u);
+}
+
+}  // namespace opossum
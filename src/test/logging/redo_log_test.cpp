@@ -0,0 +1,171 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "logging/redo_log.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class RedoLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    StorageManager::get().add_table("table_a", _table);
+  }
+
+  void TearDown() override {
+    RedoLog::get().close();
+    std::remove(_log_file_name.c_str());
+  }
+
+  // Executes an Insert of a single row, without committing
+  std::shared_ptr<TransactionContext> _insert(const int32_t a, const float b) {
+    auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    values->append({a, b});
+    auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    auto context = TransactionManager::get().new_transaction_context();
+    auto insert = std::make_shared<Insert>("table_a", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return context;
+  }
+
+  std::shared_ptr<Table> _table;
+  const std::string _log_file_name = test_data_path + "redo_log_test.log";
+};
+
+TEST_F(RedoLogTest, LogsCommittedInsertsAndDeletes) {
+  RedoLog::get().open(_log_file_name);
+
+  const auto insert_context = _insert(42, 4.5f);
+  insert_context->commit();
+
+  auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::Equals, 123);
+  table_scan->execute();
+
+  const auto delete_context = TransactionManager::get().new_transaction_context();
+  auto delete_op = std::make_shared<Delete>("table_a", table_scan);
+  delete_op->set_transaction_context(delete_context);
+  delete_op->execute();
+  delete_context->commit();
+
+  RedoLog::get().close();
+
+  const auto entries = RedoLog::read_entries(_log_file_name);
+  ASSERT_EQ(entries.size(), 2u);
+
+  EXPECT_EQ(entries[0].commit_id, insert_context->commit_id());
+  ASSERT_EQ(entries[0].records.size(), 1u);
+  const auto& insert_record = entries[0].records[0];
+  EXPECT_EQ(insert_record.type, RedoLogRecordType::Insert);
+  EXPECT_EQ(insert_record.table_name, "table_a");
+  EXPECT_EQ(insert_record.row_ids, (std::vector<RowID>{RowID{ChunkID{1}, 1u}}));
+  EXPECT_EQ(insert_record.rows, (std::vector<std::vector<AllTypeVariant>>{{42, 4.5f}}));
+
+  EXPECT_EQ(entries[1].commit_id, delete_context->commit_id());
+  ASSERT_EQ(entries[1].records.size(), 1u);
+  const auto& delete_record = entries[1].records[0];
+  EXPECT_EQ(delete_record.type, RedoLogRecordType::Delete);
+  EXPECT_EQ(delete_record.table_name, "table_a");
+  EXPECT_EQ(delete_record.row_ids, (std::vector<RowID>{RowID{ChunkID{0}, 1u}}));
+  EXPECT_TRUE(delete_record.rows.empty());
+}
+
+TEST_F(RedoLogTest, DoesNotLogRolledBackOrReadOnlyTransactions) {
+  RedoLog::get().open(_log_file_name);
+
+  _insert(42, 4.5f)->rollback();
+  TransactionManager::get().new_transaction_context()->commit();
+
+  RedoLog::get().close();
+
+  EXPECT_TRUE(RedoLog::read_entries(_log_file_name).empty());
+}
+
+TEST_F(RedoLogTest, GroupCommit) {
+  // The delay is long enough for all transactions to be committed before the batch is written
+  RedoLog::get().open(_log_file_name, std::chrono::seconds{60});
+
+  const auto last_commit_id = TransactionManager::get().last_commit_id();
+
+  constexpr auto transaction_count = 10u;
+  auto committed_count = 0u;
+  for (auto transaction_idx = 0u; transaction_idx < transaction_count; ++transaction_idx) {
+    _insert(static_cast<int32_t>(transaction_idx), 1.0f)->commit_async([&](TransactionID) { ++committed_count; });
+  }
+
+  // Transactions become visible only once they are durable
+  EXPECT_EQ(committed_count, 0u);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id);
+
+  RedoLog::get().flush();
+
+  EXPECT_EQ(committed_count, transaction_count);
+  EXPECT_EQ(TransactionManager::get().last_commit_id(), last_commit_id + transaction_count);
+  EXPECT_EQ(RedoLog::get().flush_count(), 1u);
+
+  RedoLog::get().close();
+  EXPECT_EQ(RedoLog::read_entries(_log_file_name).size(), transaction_count);
+}
+
+TEST_F(RedoLogTest, IgnoresIncompleteEntry) {
+  RedoLog::get().open(_log_file_name);
+  _insert(1, 1.0f)->commit();
+  _insert(2, 2.0f)->commit();
+  RedoLog::get().close();
+
+  // Cut off the end of the last entry, as if the process crashed while writing it
+  auto content = std::string{};
+  {
+    std::ifstream file(_log_file_name, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream file(_log_file_name, std::ios::binary | std::ios::trunc);
+    file.write(content.data(), static_cast<std::streamsize>(content.size() - 3));
+  }
+
+  const auto entries = RedoLog::read_entries(_log_file_name);
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_EQ(entries[0].records[0].rows[0][0], AllTypeVariant{1});
+}
+
+TEST_F(RedoLogTest, ReadsEntriesFromOffset) {
+  RedoLog::get().open(_log_file_name);
+  _insert(1, 1.0f)->commit();
+  const auto offset = RedoLog::get().end_offset();
+  RedoLog::get().close();
+  EXPECT_EQ(RedoLog::get().end_offset(), 0u);
+
+  // Entries are appended when the log is opened again
+  RedoLog::get().open(_log_file_name);
+  EXPECT_EQ(RedoLog::get().end_offset(), offset);
+  _insert(2, 2.0f)->commit();
+  RedoLog::get().close();
+
+  EXPECT_EQ(RedoLog::read_entries(_log_file_name).size(), 2u);
+  const auto entries = RedoLog::read_entries(_log_file_name, offset);
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_EQ(entries[0].records[0].rows[0][0], AllTypeVariant{2});
+}
+
+}  // namespace opossum
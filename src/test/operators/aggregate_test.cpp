@@ -18,6 +18,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -551,4 +552,48 @@ TEST_F(OperatorsAggregateTest, EmptyInputTable) {
   EXPECT_EQ(aggregate->get_output()->column_count(), 2u);
 }
 
+TEST_F(OperatorsAggregateTest, DictionaryEncodedGroupByColumnsStayEncoded) {
+  auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper_1_1_dict, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Max}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(),
+                            load_table("src/test/tables/aggregateoperator/groupby_int_1gb_1agg/max.tbl", 1));
+
+  const auto chunk = aggregate->get_output()->get_chunk(ChunkID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<const DictionaryColumn<int>>(chunk->get_column(ColumnID{0})), nullptr);
+  EXPECT_NE(std::dynamic_pointer_cast<const ValueColumn<int>>(chunk->get_column(ColumnID{1})), nullptr);
+
+  // Unencoded group-by columns are not encoded
+  aggregate = std::make_shared<Aggregate>(_table_wrapper_1_1,
+                                          std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Max}},
+                                          std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+  const auto unencoded_column = aggregate->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  EXPECT_NE(std::dynamic_pointer_cast<const ValueColumn<int>>(unencoded_column), nullptr);
+}
+
+TEST_F(OperatorsAggregateTest, DictionaryEncodedGroupByColumnSharesInputDictionary) {
+  auto table = load_table("src/test/tables/aggregateoperator/groupby_string_1gb_1agg/input.tbl", 10);
+  ChunkEncoder::encode_all_chunks(table);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto aggregate = std::make_shared<Aggregate>(
+      table_wrapper, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(),
+                            load_table("src/test/tables/aggregateoperator/groupby_string_1gb_1agg/count.tbl", 1));
+
+  const auto input_column = std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(
+      table->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  const auto output_column = std::dynamic_pointer_cast<const DictionaryColumn<std::string>>(
+      aggregate->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  ASSERT_NE(output_column, nullptr);
+  EXPECT_EQ(output_column->dictionary(), input_column->dictionary());
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include <map>
 #include <memory>
 #include <numeric>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -159,6 +160,116 @@ TYPED_TEST(OperatorsIndexScanTest, SingleColumnScanValueLessThanMinDictionaryVal
   }
 }
 
+TYPED_TEST(OperatorsIndexScanTest, OrderedOutputMergesChunks) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int);
+  column_definitions.emplace_back("b", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 4);
+  for (const auto value : {7, 3, 9, 1, 8, 2, 6, 4, 5, 3, 0, 10}) table->append({value, 100 + value});
+  ChunkEncoder::encode_all_chunks(table);
+  for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->template create_index<TypeParam>(this->_column_ids);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto right_values = std::vector<AllTypeVariant>{AllTypeVariant{2}};
+
+  auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                          PredicateCondition::GreaterThan, right_values);
+  scan->set_ordered_output();
+  scan->execute();
+
+  const auto expected = std::vector<int>{3, 3, 4, 5, 6, 7, 8, 9, 10};
+  const auto output = scan->get_output();
+  ASSERT_EQ(output->chunk_count(), 1u);
+  ASSERT_EQ(output->row_count(), expected.size());
+  for (auto row = size_t{0}; row < expected.size(); ++row) {
+    EXPECT_EQ(output->template get_value<int>(ColumnID{0u}, row), expected[row]);
+    EXPECT_EQ(output->template get_value<int>(ColumnID{1u}, row), 100 + expected[row]);
+  }
+
+  const auto& ordered_by = output->get_chunk(ChunkID{0u})->ordered_by();
+  ASSERT_TRUE(ordered_by);
+  EXPECT_EQ(ordered_by->first, ColumnID{0u});
+
+  auto limited_scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                                  PredicateCondition::GreaterThan, right_values);
+  limited_scan->set_ordered_output(3u);
+  limited_scan->execute();
+
+  const auto limited_output = limited_scan->get_output();
+  ASSERT_EQ(limited_output->row_count(), 3u);
+  EXPECT_EQ(limited_output->template get_value<int>(ColumnID{0u}, 0u), 3);
+  EXPECT_EQ(limited_output->template get_value<int>(ColumnID{0u}, 1u), 3);
+  EXPECT_EQ(limited_output->template get_value<int>(ColumnID{0u}, 2u), 4);
+}
+
+TYPED_TEST(OperatorsIndexScanTest, PrefixLikeScan) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 4);
+  for (const auto value : {"abc", "Abd", "b", "ab", "aBz", "a", "ABC", "xab", "ac"}) table->append({value});
+  ChunkEncoder::encode_all_chunks(table);
+  for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->template create_index<TypeParam>(this->_column_ids);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // LIKE is case insensitive
+  auto scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids, PredicateCondition::Like,
+                                          std::vector<AllTypeVariant>{"aB%"});
+  scan->execute();
+  this->ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{0u}, {"abc", "Abd", "ab", "aBz", "ABC"});
+
+  auto ordered_scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                                  PredicateCondition::Like, std::vector<AllTypeVariant>{"ab%"});
+  ordered_scan->set_ordered_output();
+  ordered_scan->execute();
+
+  const auto expected = std::vector<std::string>{"ABC", "Abd", "aBz", "ab", "abc"};
+  const auto output = ordered_scan->get_output();
+  ASSERT_EQ(output->row_count(), expected.size());
+  for (auto row = size_t{0}; row < expected.size(); ++row) {
+    EXPECT_EQ(output->template get_value<std::string>(ColumnID{0u}, row), expected[row]);
+  }
+
+  // Only prefix patterns can be answered using the index
+  auto infix_scan = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                                PredicateCondition::Like, std::vector<AllTypeVariant>{"%ab%"});
+  EXPECT_THROW(infix_scan->execute(), std::logic_error);
+}
+
+TYPED_TEST(OperatorsIndexScanTest, PrefixLikeScanSkipsNulls) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String, true);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, 4);
+  for (const auto& value : std::vector<AllTypeVariant>{"abc", NULL_VALUE, "b", NULL_VALUE, "ab", "xy", NULL_VALUE}) {
+    table->append({value});
+  }
+  ChunkEncoder::encode_all_chunks(table);
+  for (auto chunk_id = ChunkID{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->template create_index<TypeParam>(this->_column_ids);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // Neither the empty prefix nor a prefix of the largest values has an upper bound in the index
+  auto scan_all = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                              PredicateCondition::Like, std::vector<AllTypeVariant>{"%"});
+  scan_all->execute();
+  this->ASSERT_COLUMN_EQ(scan_all->get_output(), ColumnID{0u}, {"abc", "b", "ab", "xy"});
+
+  auto scan_largest = std::make_shared<IndexScan>(table_wrapper, this->_index_type, this->_column_ids,
+                                                  PredicateCondition::Like, std::vector<AllTypeVariant>{"x%"});
+  scan_largest->execute();
+  this->ASSERT_COLUMN_EQ(scan_largest->get_output(), ColumnID{0u}, {"xy"});
+}
+
 TYPED_TEST(OperatorsIndexScanTest, OperatorName) {
   const auto right_values = std::vector<AllTypeVariant>(this->_column_ids.size(), AllTypeVariant{0});
 
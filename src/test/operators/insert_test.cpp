@@ -13,6 +13,7 @@
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "optimizer/chunk_statistics/chunk_statistics.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -104,6 +105,46 @@ TEST_F(OperatorsInsertTest, MultipleChunks) {
   EXPECT_EQ(t->row_count(), 13u);
 }
 
+TEST_F(OperatorsInsertTest, MaintainsChunkStatistics) {
+  auto t_name = "test1";
+  auto t_name2 = "test2";
+
+  // 3 Rows, chunk_size = 4, loaded without statistics
+  auto t = load_table("src/test/tables/int.tbl", 4u);
+  StorageManager::get().add_table(t_name, t);
+
+  // 10 Rows between 1 and 234
+  auto t2 = load_table("src/test/tables/10_ints.tbl", Chunk::MAX_SIZE);
+  StorageManager::get().add_table(t_name2, t2);
+
+  auto gt2 = std::make_shared<GetTable>(t_name2);
+  gt2->execute();
+
+  auto ins = std::make_shared<Insert>(t_name, gt2);
+  auto context = TransactionManager::get().new_transaction_context();
+  ins->set_transaction_context(context);
+  ins->execute();
+  context->commit();
+
+  ASSERT_EQ(t->chunk_count(), 4u);
+
+  // Statistics of the first chunk would not cover the rows that were there before
+  EXPECT_EQ(t->get_chunk(ChunkID{0})->statistics(), nullptr);
+
+  // The other chunks are covered by the value range of all inserted rows
+  for (auto chunk_id = ChunkID{1}; chunk_id < t->chunk_count(); ++chunk_id) {
+    const auto statistics = t->get_chunk(chunk_id)->statistics();
+    ASSERT_NE(statistics, nullptr);
+    EXPECT_TRUE(statistics->can_prune(ColumnID{0}, 235, PredicateCondition::Equals));
+    EXPECT_TRUE(statistics->can_prune(ColumnID{0}, 1, PredicateCondition::LessThan));
+    EXPECT_FALSE(statistics->can_prune(ColumnID{0}, 24, PredicateCondition::Equals));
+  }
+
+  // Encoding rebuilds the statistics from the chunk's actual values
+  ChunkEncoder::encode_chunks(t, {ChunkID{3}});
+  EXPECT_TRUE(t->get_chunk(ChunkID{3})->statistics()->can_prune(ColumnID{0}, 24, PredicateCondition::Equals));
+}
+
 TEST_F(OperatorsInsertTest, CompressedChunks) {
   auto t_name = "test1";
   auto t_name2 = "test2";
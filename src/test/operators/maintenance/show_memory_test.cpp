@@ -0,0 +1,73 @@
+#include <memory>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/maintenance/show_memory.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class ShowMemoryTest : public BaseTest {};
+
+TEST_F(ShowMemoryTest, OperatorName) {
+  auto sm = std::make_shared<ShowMemory>();
+
+  EXPECT_EQ(sm->name(), "ShowMemory");
+}
+
+TEST_F(ShowMemoryTest, CanBeRecreated) {
+  auto sm = std::make_shared<ShowMemory>();
+
+  auto recreated = sm->recreate({});
+  ASSERT_NE(nullptr, std::dynamic_pointer_cast<ShowMemory>(recreated));
+  ASSERT_NE(sm, recreated) << "Recreate returned the same object";
+}
+
+TEST_F(ShowMemoryTest, CanShowMemory) {
+  auto& storage_manager = StorageManager::get();
+
+  const auto table_a = load_table("src/test/tables/int_float.tbl", 2);
+  const auto table_b = load_table("src/test/tables/int_string2.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table_b);
+  storage_manager.add_table("table_a", table_a);
+  storage_manager.add_table("table_b", table_b);
+
+  auto sm = std::make_shared<ShowMemory>();
+  sm->execute();
+
+  auto out = sm->get_output();
+  EXPECT_EQ(out->row_count(), 2u) << "ShowMemory returned wrong number of tables";
+  EXPECT_EQ(out->column_count(), 13u) << "ShowMemory returned wrong number of columns";
+  EXPECT_EQ(out->column_name(ColumnID{0}), "table_name");
+  EXPECT_EQ(out->column_name(ColumnID{12}), "total");
+
+  EXPECT_EQ(out->get_value<std::string>(ColumnID{0}, 0u), "table_a");
+  EXPECT_EQ(out->get_value<int64_t>(ColumnID{1}, 0u), static_cast<int64_t>(table_a->row_count()));
+  EXPECT_EQ(out->get_value<int64_t>(ColumnID{2}, 0u), static_cast<int64_t>(table_a->chunk_count()));
+  EXPECT_GT(out->get_value<int64_t>(ColumnID{3}, 0u), 0);
+  EXPECT_EQ(out->get_value<int64_t>(ColumnID{4}, 0u), 0);
+  EXPECT_EQ(out->get_value<int64_t>(ColumnID{12}, 0u), static_cast<int64_t>(table_a->memory_usage().total()));
+
+  // table_b is dictionary-encoded and does not store uncompressed values
+  EXPECT_EQ(out->get_value<std::string>(ColumnID{0}, 1u), "table_b");
+  EXPECT_EQ(out->get_value<int64_t>(ColumnID{3}, 1u), 0);
+  EXPECT_GT(out->get_value<int64_t>(ColumnID{4}, 1u), 0);
+  EXPECT_GT(out->get_value<int64_t>(ColumnID{5}, 1u), 0);
+  EXPECT_EQ(out->get_value<int64_t>(ColumnID{12}, 1u), static_cast<int64_t>(table_b->memory_usage().total()));
+}
+
+TEST_F(ShowMemoryTest, NoTables) {
+  auto sm = std::make_shared<ShowMemory>();
+  sm->execute();
+
+  auto out = sm->get_output();
+  EXPECT_EQ(out->row_count(), 0u) << "ShowMemory returned wrong number of tables";
+  EXPECT_EQ(out->column_count(), 13u) << "ShowMemory returned wrong number of columns";
+}
+
+}  // namespace opossum
@@ -0,0 +1,106 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/operator_pipeline.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_int_int.tbl", 1));
+    _table_wrapper->execute();
+  }
+
+  // TableScan -> Projection -> TableScan on the output of source
+  std::vector<std::shared_ptr<AbstractOperator>> _create_chain(const std::shared_ptr<AbstractOperator>& source) {
+    const auto scan_a = std::make_shared<TableScan>(source, ColumnID{0}, PredicateCondition::GreaterThanEquals, 10);
+
+    const auto expressions = Projection::ColumnExpressions{
+        PQPExpression::create_column(ColumnID{0}),
+        PQPExpression::create_binary_operator(ExpressionType::Addition, PQPExpression::create_column(ColumnID{1}),
+                                              PQPExpression::create_column(ColumnID{2}), {"sum"})};
+    const auto projection = std::make_shared<Projection>(scan_a, expressions);
+
+    const auto scan_b = std::make_shared<TableScan>(projection, ColumnID{1}, PredicateCondition::LessThan, 21);
+
+    return {scan_a, projection, scan_b};
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorPipelineTest, ProducesResultOfMaterializedExecution) {
+  const auto materialized_operators = _create_chain(_table_wrapper);
+  for (const auto& op : materialized_operators) {
+    op->execute();
+  }
+
+  const auto pipelined_operators = _create_chain(_table_wrapper);
+  OperatorPipeline{pipelined_operators}.execute();
+
+  EXPECT_TABLE_EQ_ORDERED(pipelined_operators.back()->get_output(), materialized_operators.back()->get_output());
+}
+
+TEST_F(OperatorPipelineTest, OnlyLastOperatorHasOutput) {
+  const auto operators = _create_chain(_table_wrapper);
+  OperatorPipeline{operators}.execute();
+
+  EXPECT_EQ(operators[0]->get_output(), nullptr);
+  EXPECT_EQ(operators[1]->get_output(), nullptr);
+  ASSERT_NE(operators[2]->get_output(), nullptr);
+  EXPECT_EQ(operators[2]->get_output()->row_count(), 1u);
+}
+
+TEST_F(OperatorPipelineTest, EmptySource) {
+  const auto empty_table =
+      std::make_shared<Table>(_table_wrapper->get_output()->column_definitions(), TableType::Data, 1);
+  const auto empty_wrapper = std::make_shared<TableWrapper>(empty_table);
+  empty_wrapper->execute();
+
+  const auto operators = _create_chain(empty_wrapper);
+  OperatorPipeline{operators}.execute();
+
+  const auto output = operators.back()->get_output();
+  ASSERT_NE(output, nullptr);
+  EXPECT_EQ(output->row_count(), 0u);
+  EXPECT_EQ(output->column_count(), 2u);
+}
+
+TEST_F(OperatorPipelineTest, ValidateInPipeline) {
+  auto table = load_table("src/test/tables/validate_input.tbl", 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    auto mvcc_columns = table->get_chunk(chunk_id)->mvcc_columns();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < table->get_chunk(chunk_id)->size(); ++chunk_offset) {
+      mvcc_columns->begin_cids[chunk_offset] = 0u;
+      mvcc_columns->end_cids[chunk_offset] = MvccColumns::MAX_COMMIT_ID;
+    }
+  }
+  table->get_chunk(ChunkID{1})->mvcc_columns()->end_cids[0] = 2u;
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto context = std::make_shared<TransactionContext>(1u, 3u);
+  const auto validate = std::make_shared<Validate>(table_wrapper);
+  validate->set_transaction_context(context);
+  const auto scan = std::make_shared<TableScan>(validate, ColumnID{0}, PredicateCondition::GreaterThan, 0);
+  scan->set_transaction_context(context);
+
+  OperatorPipeline{{validate, scan}}.execute();
+
+  EXPECT_TABLE_EQ_ORDERED(scan->get_output(), load_table("src/test/tables/validate_output_validated.tbl", 2));
+}
+
+}  // namespace opossum
@@ -0,0 +1,142 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/primary_key_lookup.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsPrimaryKeyLookupTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The first chunk is encoded, the second one is mutable
+    _table = load_table("src/test/tables/int_float.tbl", 2);
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}});
+    _table->create_primary_key_index(ColumnID{0});
+    StorageManager::get().add_table("table", _table);
+
+    _get_table = std::make_shared<GetTable>("table");
+    _get_table->execute();
+  }
+
+  std::shared_ptr<const Table> lookup_validated(const AllTypeVariant& value) {
+    auto lookup = std::make_shared<PrimaryKeyLookup>(_get_table, ColumnID{0}, value);
+    lookup->execute();
+
+    // Operators only hold a weak pointer to their transaction context
+    _context = TransactionManager::get().new_transaction_context();
+    auto validate = std::make_shared<Validate>(lookup);
+    validate->set_transaction_context(_context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  std::shared_ptr<TableWrapper> rows(const int32_t a, const float b) {
+    auto table = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+    table->append({a, b});
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<GetTable> _get_table;
+  std::shared_ptr<TransactionContext> _context;
+};
+
+TEST_F(OperatorsPrimaryKeyLookupTest, Lookup) {
+  auto expected_result = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  expected_result->append({123, 456.7f});
+
+  auto lookup = std::make_shared<PrimaryKeyLookup>(_get_table, ColumnID{0}, 123);
+  lookup->execute();
+  EXPECT_TABLE_EQ_UNORDERED(lookup->get_output(), expected_result);
+
+  // Rows of the mutable chunk are indexed as well
+  auto lookup_mutable = std::make_shared<PrimaryKeyLookup>(_get_table, ColumnID{0}, 1234);
+  lookup_mutable->execute();
+  EXPECT_EQ(lookup_mutable->get_output()->row_count(), 1u);
+
+  auto lookup_missing = std::make_shared<PrimaryKeyLookup>(_get_table, ColumnID{0}, 42);
+  lookup_missing->execute();
+  EXPECT_EQ(lookup_missing->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, FailsWithoutIndex) {
+  auto lookup = std::make_shared<PrimaryKeyLookup>(_get_table, ColumnID{1}, 456.7f);
+  EXPECT_THROW(lookup->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, FindsInsertedRows) {
+  auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table", rows(99, 1.5f));
+  insert->set_transaction_context(context);
+  insert->execute();
+
+  // Not committed yet
+  EXPECT_EQ(lookup_validated(99)->row_count(), 0u);
+
+  context->commit();
+
+  auto expected_result = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  expected_result->append({99, 1.5f});
+  EXPECT_TABLE_EQ_UNORDERED(lookup_validated(99), expected_result);
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, RolledBackInsertsAreRemoved) {
+  auto context = TransactionManager::get().new_transaction_context();
+  auto insert = std::make_shared<Insert>("table", rows(99, 1.5f));
+  insert->set_transaction_context(context);
+  insert->execute();
+  EXPECT_EQ(_table->primary_key_index()->size(), 4u);
+
+  context->rollback();
+
+  EXPECT_EQ(_table->primary_key_index()->size(), 3u);
+  EXPECT_TRUE(_table->primary_key_index()->lookup(99).empty());
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, UpdatedRowsAreValidated) {
+  auto context = TransactionManager::get().new_transaction_context();
+
+  auto lookup = std::make_shared<PrimaryKeyLookup>(_get_table, ColumnID{0}, 12345);
+  lookup->set_transaction_context(context);
+  lookup->execute();
+
+  auto update = std::make_shared<Update>("table", lookup, rows(12345, 1.5f));
+  update->set_transaction_context(context);
+  update->execute();
+  ASSERT_FALSE(update->execute_failed());
+
+  context->commit();
+
+  // The index still holds the old version of the row, which is filtered by the Validate operator
+  EXPECT_EQ(_table->primary_key_index()->lookup(12345).size(), 2u);
+
+  auto expected_result = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  expected_result->append({12345, 1.5f});
+  EXPECT_TABLE_EQ_UNORDERED(lookup_validated(12345), expected_result);
+}
+
+TEST_F(OperatorsPrimaryKeyLookupTest, Description) {
+  auto unexecuted_lookup = std::make_shared<PrimaryKeyLookup>(std::make_shared<GetTable>("table"), ColumnID{0}, 123);
+  EXPECT_EQ(unexecuted_lookup->description(DescriptionMode::SingleLine), "PrimaryKeyLookup (Col #0 = 123)");
+
+  auto lookup = std::make_shared<PrimaryKeyLookup>(_get_table, ColumnID{0}, 123);
+  EXPECT_EQ(lookup->description(DescriptionMode::SingleLine), "PrimaryKeyLookup (a = 123)");
+}
+
+}  // namespace opossum
@@ -10,6 +10,7 @@
 #include "operators/pqp_expression.hpp"
 #include "operators/print.hpp"
 #include "operators/projection.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -363,4 +364,98 @@ TEST_F(OperatorsProjectionTest, ExecuteSubqueryFail) {
   EXPECT_ANY_THROW(projection->execute());
 }
 
+TEST_F(OperatorsProjectionTest, DivisionByNullIsNull) {
+  auto projection = std::make_shared<Projection>(_table_wrapper_int_null, _div_a_b_expr);
+  projection->execute();
+
+  const auto output = projection->get_output();
+  ASSERT_EQ(output->chunk_count(), 2u);
+  const auto first_column = output->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  const auto second_column = output->get_chunk(ChunkID{1})->get_column(ColumnID{0});
+  EXPECT_EQ((*first_column)[0], AllTypeVariant{0});
+  EXPECT_TRUE(variant_is_null((*first_column)[1]));
+  EXPECT_TRUE(variant_is_null((*second_column)[0]));
+  EXPECT_TRUE(variant_is_null((*second_column)[1]));
+}
+
+TEST_F(OperatorsProjectionTest, NullDividedByZeroIsNull) {
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::Int, true}}, TableType::Data);
+  table->append({NULL_VALUE, 0});
+  table->append({5, NULL_VALUE});
+  table->append({6, 3});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto projection = std::make_shared<Projection>(table_wrapper, _div_a_b_expr);
+  projection->execute();
+
+  const auto column = projection->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  EXPECT_TRUE(variant_is_null((*column)[0]));
+  EXPECT_TRUE(variant_is_null((*column)[1]));
+  EXPECT_EQ((*column)[2], AllTypeVariant{2});
+
+  // A non-NULL row with a divisor of 0 still fails
+  table->append({7, 0});
+  auto failing_projection = std::make_shared<Projection>(table_wrapper, _div_a_b_expr);
+  EXPECT_THROW(failing_projection->execute(), std::runtime_error);
+}
+
+TEST_F(OperatorsProjectionTest, SharesColumnsWithInput) {
+  const auto a_and_sum_a_b_expr = Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{0}),
+                                                                _sum_a_b_expr[0]};
+
+  // Projections of existing columns only share all columns with the input
+  auto projection = std::make_shared<Projection>(_table_wrapper_int_dict, _b_a_expr);
+  projection->execute();
+  const auto input_chunk = _table_wrapper_int_dict->get_output()->get_chunk(ChunkID{0});
+  auto output_chunk = projection->get_output()->get_chunk(ChunkID{0});
+  EXPECT_EQ(output_chunk->get_column(ColumnID{0}), input_chunk->get_column(ColumnID{1}));
+  EXPECT_EQ(output_chunk->get_column(ColumnID{1}), input_chunk->get_column(ColumnID{0}));
+
+  // Encoded columns are shared even if other columns are computed
+  projection = std::make_shared<Projection>(_table_wrapper_int_dict, a_and_sum_a_b_expr);
+  projection->execute();
+  output_chunk = projection->get_output()->get_chunk(ChunkID{0});
+  EXPECT_EQ(output_chunk->get_column(ColumnID{0}), input_chunk->get_column(ColumnID{0}));
+
+  // ValueColumns are only shared if no rows can be appended to them anymore
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_int_int.tbl", 3));
+  table_wrapper->execute();
+  projection = std::make_shared<Projection>(table_wrapper, a_and_sum_a_b_expr);
+  projection->execute();
+  const auto input_table = table_wrapper->get_output();
+  const auto output_table = projection->get_output();
+  auto expected_result = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"sum", DataType::Int}},
+                                                  TableType::Data);
+  expected_result->append({9, 19});
+  expected_result->append({10, 20});
+  expected_result->append({11, 21});
+  expected_result->append({9, 19});
+  EXPECT_TABLE_EQ_ORDERED(output_table, expected_result);
+  EXPECT_EQ(output_table->get_chunk(ChunkID{0})->get_column(ColumnID{0}),
+            input_table->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+  EXPECT_NE(output_table->get_chunk(ChunkID{1})->get_column(ColumnID{0}),
+            input_table->get_chunk(ChunkID{1})->get_column(ColumnID{0}));
+}
+
+TEST_F(OperatorsProjectionTest, ForwardsSortOrder) {
+  auto sort = std::make_shared<Sort>(_table_wrapper_int, ColumnID{0}, OrderByMode::Descending, 2u);
+  sort->execute();
+
+  auto projection = std::make_shared<Projection>(sort, _b_a_expr);
+  projection->execute();
+
+  const auto expected_ordered_by = std::make_optional(std::make_pair(ColumnID{1}, OrderByMode::Descending));
+  const auto output = projection->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id)->ordered_by(), expected_ordered_by);
+  }
+
+  // Computed columns are not sorted
+  projection = std::make_shared<Projection>(sort, _sum_a_b_expr);
+  projection->execute();
+  EXPECT_FALSE(projection->get_output()->get_chunk(ChunkID{0})->ordered_by());
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include <iostream>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -11,6 +12,7 @@
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -214,4 +216,54 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneDictColumn) {
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, OutputChunksAreMarkedAsSorted) {
+  auto sort = std::make_shared<Sort>(_table_wrapper_null_dict, ColumnID{1}, OrderByMode::DescendingNullsLast, 2u);
+  sort->execute();
+
+  const auto expected_ordered_by = std::make_optional(std::make_pair(ColumnID{1}, OrderByMode::DescendingNullsLast));
+  const auto output = sort->get_output();
+  ASSERT_GT(output->chunk_count(), 1u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id)->ordered_by(), expected_ordered_by);
+  }
+}
+
+TEST_P(OperatorsSortTest, DictionaryEncodedInputStaysEncoded) {
+  // Sort a dictionary-encoded table directly and through ReferenceColumns. As the rows of each output chunk stem from
+  // different input chunks, the output dictionaries are merged from the input dictionaries.
+  auto table = load_table("src/test/tables/int_float_with_null.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, {EncodingType::Dictionary});
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The scan removes the row with a NULL in column b
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, PredicateCondition::GreaterThan, 0.0f);
+  scan->execute();
+
+  const auto expected_result = load_table("src/test/tables/int_float_null_sorted_asc_nulls_last.tbl", 2);
+  auto expected_scan_result = std::make_shared<Table>(expected_result->column_definitions(), TableType::Data);
+  expected_scan_result->append({1234, 457.7f});
+  expected_scan_result->append({12345, 458.7f});
+  expected_scan_result->append({NULL_VALUE, 456.7f});
+
+  const auto inputs_and_expected_results =
+      std::vector<std::pair<std::shared_ptr<const AbstractOperator>, std::shared_ptr<const Table>>>{
+          {table_wrapper, expected_result}, {scan, expected_scan_result}};
+
+  for (const auto& [input, expected] : inputs_and_expected_results) {
+    for (const auto output_chunk_size : {size_t{2}, size_t{Chunk::MAX_SIZE}}) {
+      auto sort = std::make_shared<Sort>(input, ColumnID{0}, OrderByMode::AscendingNullsLast, output_chunk_size);
+      sort->execute();
+
+      const auto output = sort->get_output();
+      EXPECT_TABLE_EQ_ORDERED(output, expected);
+      for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+        const auto chunk = output->get_chunk(chunk_id);
+        EXPECT_NE(std::dynamic_pointer_cast<const DictionaryColumn<int>>(chunk->get_column(ColumnID{0})), nullptr);
+        EXPECT_NE(std::dynamic_pointer_cast<const DictionaryColumn<float>>(chunk->get_column(ColumnID{1})), nullptr);
+      }
+    }
+  }
+}
+
 }  // namespace opossum
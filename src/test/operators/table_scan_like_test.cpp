@@ -1,9 +1,12 @@
+#include <algorithm>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -11,6 +14,9 @@
 #include "operators/abstract_read_only_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_scan/like_matcher.hpp"
+#include "operators/table_scan/like_table_scan_impl.hpp"
+#include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -125,6 +131,73 @@ TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingOnReferencedDictColumn) {
   scan2->execute();
   EXPECT_TABLE_EQ_UNORDERED(scan2->get_output(), expected_result);
 }
+TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingCaseInsensitivityOnDictColumn) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_starting.tbl", 1);
+  auto scan = std::make_shared<TableScan>(_gt_string_dict, ColumnID{1}, PredicateCondition::Like, "dAmpF%%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+
+TEST_F(OperatorsTableScanLikeTest, ScanLikeStartingOnDictColumnWithCaseVariants) {
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::String);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto value : {"abc", "Abd", "b", "ab", "aBz", "a", "ABC", "xab", "ac"}) table->append({value});
+  ChunkEncoder::encode_all_chunks(table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto sorted_values = [](const std::shared_ptr<const Table>& output) {
+    auto values = std::vector<std::string>{};
+    for (auto row = size_t{0}; row < output->row_count(); ++row) {
+      values.emplace_back(output->get_value<std::string>(ColumnID{0}, row));
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+  };
+
+  // The dictionary is sorted case-sensitively, so the matches are spread over multiple ranges of value IDs
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::Like, "ab%");
+  scan->execute();
+  EXPECT_EQ(sorted_values(scan->get_output()), std::vector<std::string>({"ABC", "Abd", "aBz", "ab", "abc"}));
+
+  auto not_like_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::NotLike, "ab%");
+  not_like_scan->execute();
+  EXPECT_EQ(sorted_values(not_like_scan->get_output()), std::vector<std::string>({"a", "ac", "b", "xab"}));
+}
+
+TEST_F(OperatorsTableScanLikeTest, ExtractPrefix) {
+  EXPECT_EQ(LikeTableScanImpl::extract_prefix("abc%"), "abc");
+  EXPECT_EQ(LikeTableScanImpl::extract_prefix("abc%%"), "abc");
+  EXPECT_EQ(LikeTableScanImpl::extract_prefix("%"), "");
+  EXPECT_EQ(LikeTableScanImpl::extract_prefix("abc"), std::nullopt);
+  EXPECT_EQ(LikeTableScanImpl::extract_prefix("%abc"), std::nullopt);
+  EXPECT_EQ(LikeTableScanImpl::extract_prefix("a_c%"), std::nullopt);
+  EXPECT_EQ(LikeTableScanImpl::extract_prefix("ab%c%"), std::nullopt);
+}
+
+TEST_F(OperatorsTableScanLikeTest, LikeMatcher) {
+  EXPECT_TRUE(LikeMatcher{"abc"}.matches("aBc"));
+  EXPECT_FALSE(LikeMatcher{"abc"}.matches("abcd"));
+  EXPECT_TRUE(LikeMatcher{"%"}.matches(""));
+  EXPECT_TRUE(LikeMatcher{"a%"}.matches("a"));
+  EXPECT_FALSE(LikeMatcher{"a%a"}.matches("a"));
+  EXPECT_TRUE(LikeMatcher{"a%a"}.matches("aa"));
+  EXPECT_TRUE(LikeMatcher{"_b_"}.matches("abc"));
+  EXPECT_FALSE(LikeMatcher{"_b_"}.matches("ab"));
+  EXPECT_TRUE(LikeMatcher{"%b_d%"}.matches("abcbxd"));
+  EXPECT_TRUE(LikeMatcher{"%1.5%"}.matches("costs 1.5 euros"));
+  EXPECT_FALSE(LikeMatcher{"%1.5%"}.matches("costs 115 euros"));
+
+  // Long values are searched 16 characters at a time
+  const auto value = std::string(100, 'x') + "special requests" + std::string(100, 'y');
+  EXPECT_TRUE(LikeMatcher{"%special%requests%"}.matches(value));
+  EXPECT_TRUE(LikeMatcher{"%SPECIAL_requests%"}.matches(value));
+  EXPECT_FALSE(LikeMatcher{"%requests%special%"}.matches(value));
+  EXPECT_FALSE(LikeMatcher{"%special%requests"}.matches(value));
+}
+
 // PredicateCondition::Like - Ending
 TEST_F(OperatorsTableScanLikeTest, ScanLikeEnding) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_ending.tbl", 1);
@@ -215,6 +288,18 @@ TEST_F(OperatorsTableScanLikeTest, ScanLikeNotFoundOnReferencedDictColumn) {
   EXPECT_EQ(scan2->get_output()->row_count(), 0u);
 }
 // PredicateCondition::NotLike
+TEST_F(OperatorsTableScanLikeTest, ScanNotLikeStarting) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_not_starting.tbl", 1);
+  auto scan = std::make_shared<TableScan>(_gt_string, ColumnID{1}, PredicateCondition::NotLike, "dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
+TEST_F(OperatorsTableScanLikeTest, ScanNotLikeStartingOnDict) {
+  std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_like_not_starting.tbl", 1);
+  auto scan = std::make_shared<TableScan>(_gt_string_dict, ColumnID{1}, PredicateCondition::NotLike, "dampf%");
+  scan->execute();
+  EXPECT_TABLE_EQ_UNORDERED(scan->get_output(), expected_result);
+}
 TEST_F(OperatorsTableScanLikeTest, ScanNotLikeEmptyString) {
   // wildcard has to be placed at front and/or back of search string
   auto scan = std::make_shared<TableScan>(_gt_string, ColumnID{1}, PredicateCondition::NotLike, "%");
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -11,12 +12,18 @@
 #include "gtest/gtest.h"
 
 #include "operators/abstract_read_only_operator.hpp"
+#include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/table.hpp"
+#include "type_cast.hpp"
+#include "type_comparison.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -622,4 +629,150 @@ TEST_P(OperatorsTableScanTest, ScanWithExcludedFirstChunk) {
   ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
 }
 
+TEST_P(OperatorsTableScanTest, ScanOnSortedChunks) {
+  // Column a contains duplicates and NULLs, column b identifies the row
+  const auto values = std::vector<std::optional<int32_t>>{3, std::nullopt, 1, 3, 2, std::nullopt, 5, 3, 4};
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto row = size_t{0}; row < values.size(); ++row) {
+    table->append({values[row] ? AllTypeVariant{*values[row]} : NULL_VALUE, static_cast<int32_t>(row)});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto predicate_conditions = std::vector<PredicateCondition>(
+      {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+       PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals});
+  const auto order_by_modes = std::vector<OrderByMode>({OrderByMode::Ascending, OrderByMode::Descending,
+                                                        OrderByMode::AscendingNullsLast,
+                                                        OrderByMode::DescendingNullsLast});
+
+  for (const auto encode : {false, true}) {
+    for (const auto order_by_mode : order_by_modes) {
+      auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, order_by_mode, 4u);
+      sort->execute();
+
+      // Encoding keeps the sort order of the chunks
+      auto sorted_table = std::const_pointer_cast<Table>(sort->get_output());
+      if (encode) ChunkEncoder::encode_all_chunks(sorted_table, {_encoding_type});
+      ASSERT_TRUE(sorted_table->get_chunk(ChunkID{0})->ordered_by());
+
+      auto sorted_table_wrapper = std::make_shared<TableWrapper>(sorted_table);
+      sorted_table_wrapper->execute();
+
+      for (const auto predicate_condition : predicate_conditions) {
+        for (const auto search_value : {0, 1, 3, 4, 6}) {
+          auto expected = std::vector<AllTypeVariant>{};
+          for (auto row = size_t{0}; row < values.size(); ++row) {
+            if (!values[row]) continue;
+            with_comparator(predicate_condition, [&](auto comparator) {
+              if (comparator(*values[row], search_value)) expected.emplace_back(static_cast<int32_t>(row));
+            });
+          }
+
+          auto scan = std::make_shared<TableScan>(sorted_table_wrapper, ColumnID{0}, predicate_condition, search_value);
+          scan->execute();
+          ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, expected);
+
+          // The scan output is still sorted
+          const auto expected_ordered_by = std::make_optional(std::make_pair(ColumnID{0}, order_by_mode));
+          for (auto chunk_id = ChunkID{0}; chunk_id < scan->get_output()->chunk_count(); ++chunk_id) {
+            EXPECT_EQ(scan->get_output()->get_chunk(chunk_id)->ordered_by(), expected_ordered_by);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_P(OperatorsTableScanTest, ScanSkipsChunksUsingStatistics) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, {_encoding_type});
+  table->evict_chunk(ChunkID{1}, test_data_path + "table_scan_evicted_chunk.chunk");
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // Chunk 1 only contains 1234, so the scan does not need to access its mapped columns
+  auto scan_greater = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 2000);
+  scan_greater->execute();
+  ASSERT_COLUMN_EQ(scan_greater->get_output(), ColumnID{0}, std::vector<AllTypeVariant>{12345});
+
+  // Evicted chunks are scanned transparently
+  auto scan_equals = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::Equals, 1234);
+  scan_equals->execute();
+  ASSERT_COLUMN_EQ(scan_equals->get_output(), ColumnID{0}, std::vector<AllTypeVariant>{1234});
+  EXPECT_TRUE(table->chunk_is_evicted(ChunkID{1}));
+}
+
+TEST_P(OperatorsTableScanTest, ScanSplitsLargeChunksIntoMorsels) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  // A single chunk that is large enough to be split, column b identifies the row
+  const auto row_count = 100'000;
+  const auto value_of_row = [](const int32_t row) -> std::optional<int32_t> {
+    if (row % 7 == 0) return std::nullopt;
+    return row % 5;
+  };
+
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, true);
+  column_definitions.emplace_back("b", DataType::Int);
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (auto row = 0; row < row_count; ++row) {
+    const auto value = value_of_row(row);
+    table->append({value ? AllTypeVariant{*value} : NULL_VALUE, row});
+  }
+  ChunkEncoder::encode_all_chunks(table, {_encoding_type});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(table_wrapper, ColumnID{0}, OrderByMode::Ascending);
+  sort->execute();
+  ASSERT_TRUE(sort->get_output()->get_chunk(ChunkID{0})->ordered_by());
+
+  // Returns the sorted values of column b of the scan output
+  const auto scan_rows = [](const std::shared_ptr<const AbstractOperator>& input, const PredicateCondition condition,
+                            const AllTypeVariant& value) {
+    auto scan = std::make_shared<TableScan>(input, ColumnID{0}, condition, value);
+    scan->execute();
+
+    auto rows = std::vector<int32_t>{};
+    const auto output = scan->get_output();
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto column = output->get_chunk(chunk_id)->get_column(ColumnID{1});
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < column->size(); ++chunk_offset) {
+        rows.emplace_back(type_cast<int32_t>((*column)[chunk_offset]));
+      }
+    }
+    std::sort(rows.begin(), rows.end());
+    return rows;
+  };
+
+  const auto expected_rows = [&](const std::function<bool(const std::optional<int32_t>&)>& predicate) {
+    auto rows = std::vector<int32_t>{};
+    for (auto row = 0; row < row_count; ++row) {
+      if (predicate(value_of_row(row))) rows.emplace_back(row);
+    }
+    return rows;
+  };
+
+  const auto equals_three = expected_rows([](const auto& value) { return value && *value == 3; });
+  const auto less_than_two = expected_rows([](const auto& value) { return value && *value < 2; });
+  const auto is_null = expected_rows([](const auto& value) { return !value; });
+
+  for (const auto& input : std::vector<std::shared_ptr<const AbstractOperator>>{table_wrapper, sort}) {
+    EXPECT_EQ(scan_rows(input, PredicateCondition::Equals, 3), equals_three);
+    EXPECT_EQ(scan_rows(input, PredicateCondition::LessThan, 2), less_than_two);
+    EXPECT_EQ(scan_rows(input, PredicateCondition::IsNull, NULL_VALUE), is_null);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
 }  // namespace opossum
@@ -1,3 +1,4 @@
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -8,6 +9,7 @@
 
 #include "utils/assert.hpp"
 
+#include "optimizer/chunk_statistics/bloom_filter.hpp"
 #include "optimizer/chunk_statistics/min_max_filter.hpp"
 #include "optimizer/chunk_statistics/range_filter.hpp"
 #include "types.hpp"
@@ -56,4 +58,43 @@ TEST_F(PruningFiltersTest, RangeFilterFloatTest) {
   EXPECT_EQ(true, filter->can_prune({-5.f}, PredicateCondition::LessThan));
 }
 
+TEST_F(PruningFiltersTest, BloomFilterTest) {
+  auto filter = BloomFilter<int>::build_filter(_values);
+
+  for (const auto value : _values) {
+    EXPECT_EQ(false, filter->can_prune({value}, PredicateCondition::Equals));
+  }
+  EXPECT_EQ(false, filter->can_prune({42}, PredicateCondition::LessThan));
+  EXPECT_EQ(false, filter->can_prune({-5}, PredicateCondition::GreaterThan));
+}
+
+TEST_F(PruningFiltersTest, BloomFilterFloatTest) {
+  // -0.0 and 0.0 compare equal, so a filter containing one of them must not prune the other
+  auto filter = BloomFilter<double>::build_filter(pmr_vector<double>{-0.0, 1.5});
+  EXPECT_EQ(false, filter->can_prune({0.0}, PredicateCondition::Equals));
+  EXPECT_EQ(false, filter->can_prune({-0.0}, PredicateCondition::Equals));
+
+  auto nan_filter = BloomFilter<float>::build_filter(pmr_vector<float>{std::numeric_limits<float>::quiet_NaN()});
+  EXPECT_EQ(false, nan_filter->can_prune({-std::numeric_limits<float>::quiet_NaN()}, PredicateCondition::Equals));
+}
+
+TEST_F(PruningFiltersTest, BloomFilterFalsePositiveRateTest) {
+  pmr_vector<std::string> values;
+  for (auto value_id = 0; value_id < 1'000; ++value_id) {
+    values.emplace_back("key_" + std::to_string(value_id * 2));
+  }
+  auto filter = BloomFilter<std::string>::build_filter(values, 0.01);
+
+  for (const auto& value : values) {
+    EXPECT_EQ(false, filter->can_prune({value}, PredicateCondition::Equals));
+  }
+
+  // Values in between the contained ones cannot be pruned by min/max filters, but most of them by the bloom filter
+  auto pruned_count = 0;
+  for (auto value_id = 0; value_id < 1'000; ++value_id) {
+    pruned_count += filter->can_prune({"key_" + std::to_string(value_id * 2 + 1)}, PredicateCondition::Equals);
+  }
+  EXPECT_GE(pruned_count, 950);
+}
+
 }  // namespace opossum
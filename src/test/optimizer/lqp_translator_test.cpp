@@ -27,6 +27,7 @@
 #include "operators/maintenance/show_columns.hpp"
 #include "operators/maintenance/show_tables.hpp"
 #include "operators/pqp_expression.hpp"
+#include "operators/primary_key_lookup.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
@@ -197,6 +198,46 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(table_scan_op2->right_parameter(), AllParameterVariant(42));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodePrimaryKeyLookup) {
+  const auto stored_table_node = StoredTableNode::make("table_int_float_chunked");
+
+  const auto table = StorageManager::get().get_table("table_int_float_chunked");
+  table->create_primary_key_index(ColumnID{0});
+
+  auto predicate_node =
+      PredicateNode::make(LQPColumnReference(stored_table_node, ColumnID{0}), PredicateCondition::Equals, 123);
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->set_scan_type(ScanType::IndexScan);
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  // The primary key index covers all chunks, so no TableScan is needed
+  const auto lookup_op = std::dynamic_pointer_cast<PrimaryKeyLookup>(op);
+  ASSERT_TRUE(lookup_op);
+  EXPECT_EQ(lookup_op->column_id(), ColumnID{0});
+  EXPECT_EQ(lookup_op->value(), AllTypeVariant{123});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(lookup_op->input_left()));
+}
+
+TEST_F(LQPTranslatorTest, PredicateNodePrimaryKeyLookupRequiresValueOfColumnType) {
+  const auto stored_table_node = StoredTableNode::make("table_int_float_chunked");
+
+  const auto table = StorageManager::get().get_table("table_int_float_chunked");
+  table->create_primary_key_index(ColumnID{0});
+  table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+
+  // The index would cast 123.5 to 123
+  auto predicate_node =
+      PredicateNode::make(LQPColumnReference(stored_table_node, ColumnID{0}), PredicateCondition::Equals, 123.5f);
+  predicate_node->set_left_input(stored_table_node);
+  predicate_node->set_scan_type(ScanType::IndexScan);
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  const auto union_op = std::dynamic_pointer_cast<UnionPositions>(op);
+  ASSERT_TRUE(union_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const IndexScan>(union_op->input_left()));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const TableScan>(union_op->input_right()));
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   if (!IS_DEBUG) return;
   /**
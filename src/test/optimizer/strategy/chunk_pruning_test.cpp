@@ -82,6 +82,23 @@ TEST_F(ChunkPruningTest, NoStatisticsAvailable) {
   EXPECT_EQ(excluded, expected);
 }
 
+TEST_F(ChunkPruningTest, MutableChunksAreNotPruned) {
+  // Mutable chunks can have statistics, but rows that match the predicate might still be inserted into them
+  const auto statistics = StorageManager::get().get_table("compressed")->get_chunk(ChunkID{1})->statistics();
+  StorageManager::get().get_table("uncompressed")->get_chunk(ChunkID{0})->set_statistics(statistics);
+
+  auto stored_table_node = std::make_shared<StoredTableNode>("uncompressed");
+
+  auto predicate_node = std::make_shared<PredicateNode>(LQPColumnReference(stored_table_node, ColumnID{0}),
+                                                        PredicateCondition::GreaterThan, 200);
+  predicate_node->set_left_input(stored_table_node);
+
+  auto pruned = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(pruned, predicate_node);
+  EXPECT_TRUE(stored_table_node->excluded_chunk_ids().empty());
+}
+
 TEST_F(ChunkPruningTest, TwoOperatorPruningTest) {
   auto stored_table_node = std::make_shared<StoredTableNode>("compressed");
 
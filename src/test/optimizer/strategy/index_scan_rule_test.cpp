@@ -10,6 +10,7 @@
 #include "abstract_expression.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/column_statistics.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "optimizer/strategy/strategy_base_test.hpp"
@@ -211,4 +212,164 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type(), ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, IndexScanWithChunkIndex) {
+  auto stored_table_node = StoredTableNode::make("a");
+
+  // The index is not registered in the table, only the chunk has it
+  auto table = StorageManager::get().get_table("a");
+  table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{2}});
+
+  auto statistics_mock = std::make_shared<TableStatisticsMock>(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{2}}, PredicateCondition::GreaterThan, 10);
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(_rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type(), ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoIndexScanForLike) {
+  auto stored_table_node = StoredTableNode::make("a");
+
+  auto table = StorageManager::get().get_table("a");
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto statistics_mock = std::make_shared<TableStatisticsMock>(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{2}}, PredicateCondition::Like, "1%");
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(_rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type(), ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, IndexScanForPrefixLikeOnStringColumn) {
+  const auto table = load_table("src/test/tables/int_string_like.tbl", Chunk::MAX_SIZE);
+  ChunkEncoder::encode_all_chunks(table);
+  table->create_index<GroupKeyIndex>({ColumnID{1}});
+  table->set_table_statistics(std::make_shared<TableStatisticsMock>(1'000'000));
+  StorageManager::get().add_table("b", table);
+
+  auto stored_table_node = StoredTableNode::make("b");
+
+  auto predicate_node_0 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{1}}, PredicateCondition::Like, "Dampf%");
+  predicate_node_0->set_left_input(stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type(), ScanType::IndexScan);
+
+  // Other patterns cannot be answered using the index
+  auto predicate_node_1 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{1}}, PredicateCondition::Like, "%schaft");
+  predicate_node_1->set_left_input(stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type(), ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, IndexScanIsMovedToStoredTableNode) {
+  auto stored_table_node = StoredTableNode::make("a");
+
+  auto table = StorageManager::get().get_table("a");
+  table->create_index<GroupKeyIndex>({ColumnID{2}});
+
+  auto statistics_mock = std::make_shared<TableStatisticsMock>(1'000'000);
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{0}}, PredicateCondition::LessThan, 15);
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto validate_node = ValidateNode::make();
+  validate_node->set_left_input(predicate_node_0);
+
+  auto predicate_node_1 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{2}}, PredicateCondition::GreaterThan, 10);
+  predicate_node_1->set_left_input(validate_node);
+
+  auto result = StrategyBaseTest::apply_rule(_rule, predicate_node_1);
+
+  EXPECT_EQ(result, validate_node);
+  EXPECT_EQ(validate_node->left_input(), predicate_node_0);
+  EXPECT_EQ(predicate_node_0->left_input(), predicate_node_1);
+  EXPECT_EQ(predicate_node_1->left_input(), stored_table_node);
+  EXPECT_EQ(predicate_node_0->scan_type(), ScanType::TableScan);
+  EXPECT_EQ(predicate_node_1->scan_type(), ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, PrimaryKeyLookupRegardlessOfStatistics) {
+  auto stored_table_node = StoredTableNode::make("a");
+
+  auto table = StorageManager::get().get_table("a");
+  table->create_primary_key_index(ColumnID{1});
+
+  // According to the mocked statistics, the table is too small for an IndexScan on a chunk index
+  auto statistics_mock = std::make_shared<TableStatisticsMock>();
+  table->set_table_statistics(statistics_mock);
+
+  auto predicate_node_0 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{1}}, PredicateCondition::Equals, 10);
+  predicate_node_0->set_left_input(stored_table_node);
+
+  auto reordered = StrategyBaseTest::apply_rule(_rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type(), ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoPrimaryKeyLookupIfNotApplicable) {
+  auto stored_table_node = StoredTableNode::make("a");
+
+  auto table = StorageManager::get().get_table("a");
+  table->create_primary_key_index(ColumnID{1});
+
+  auto statistics_mock = std::make_shared<TableStatisticsMock>();
+  table->set_table_statistics(statistics_mock);
+
+  // Other column
+  auto predicate_node_0 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{0}}, PredicateCondition::Equals, 10);
+  predicate_node_0->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node_0);
+  EXPECT_EQ(predicate_node_0->scan_type(), ScanType::TableScan);
+
+  // Other predicate condition
+  auto predicate_node_1 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{1}}, PredicateCondition::LessThan, 10);
+  predicate_node_1->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node_1);
+  EXPECT_EQ(predicate_node_1->scan_type(), ScanType::TableScan);
+
+  // Value of another data type
+  auto predicate_node_2 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{1}}, PredicateCondition::Equals, 10.5);
+  predicate_node_2->set_left_input(stored_table_node);
+  StrategyBaseTest::apply_rule(_rule, predicate_node_2);
+  EXPECT_EQ(predicate_node_2->scan_type(), ScanType::TableScan);
+}
+
+TEST_F(IndexScanRuleTest, PrimaryKeyLookupIsMovedBelowValidate) {
+  auto stored_table_node = StoredTableNode::make("a");
+
+  auto table = StorageManager::get().get_table("a");
+  table->create_primary_key_index(ColumnID{1});
+
+  auto validate_node = ValidateNode::make();
+  validate_node->set_left_input(stored_table_node);
+
+  auto predicate_node_0 =
+      PredicateNode::make(LQPColumnReference{stored_table_node, ColumnID{1}}, PredicateCondition::Equals, 10);
+  predicate_node_0->set_left_input(validate_node);
+
+  auto result = StrategyBaseTest::apply_rule(_rule, predicate_node_0);
+
+  EXPECT_EQ(result, validate_node);
+  EXPECT_EQ(validate_node->left_input(), predicate_node_0);
+  EXPECT_EQ(predicate_node_0->left_input(), stored_table_node);
+  EXPECT_EQ(predicate_node_0->scan_type(), ScanType::IndexScan);
+}
+
 }  // namespace opossum
@@ -0,0 +1,139 @@
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "operators/get_table.hpp"
+#include "operators/primary_key_lookup.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "scheduler/admission_control.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class AdmissionControlTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("src/test/tables/int_float.tbl", 2));
+    StorageManager::get().add_table("table_b", load_table("src/test/tables/int_float2.tbl", 2));
+  }
+
+  std::vector<std::shared_ptr<OperatorTask>> _create_query(const std::string& table_name) {
+    auto get_table = std::make_shared<GetTable>(table_name);
+    auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+    return OperatorTask::make_tasks_from_operator(table_scan);
+  }
+};
+
+TEST_F(AdmissionControlTest, ClassifiesQueriesByEstimatedRowCount) {
+  auto& admission_control = AdmissionControl::get();
+  const auto is_heavy_query = [&](const std::string& table_name) {
+    return admission_control.is_heavy_query(
+        OperatorTask::make_tasks_from_operator(std::make_shared<GetTable>(table_name)));
+  };
+
+  // Without predicates, all rows are processed. table_a has 3 rows, table_b 4.
+  admission_control.set_heavy_query_row_count(4);
+  EXPECT_FALSE(is_heavy_query("table_a"));
+  EXPECT_TRUE(is_heavy_query("table_b"));
+
+  admission_control.set_heavy_query_row_count(3);
+  EXPECT_TRUE(is_heavy_query("table_a"));
+}
+
+TEST_F(AdmissionControlTest, PointQueryOnLargeTableIsShort) {
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 100);
+  for (auto value = 0; value < 1'000; ++value) {
+    table->append({value});
+  }
+  StorageManager::get().add_table("table_c", table);
+
+  auto& admission_control = AdmissionControl::get();
+  admission_control.set_heavy_query_row_count(100);
+
+  const auto get_table = std::make_shared<GetTable>("table_c");
+  EXPECT_TRUE(admission_control.is_heavy_query(OperatorTask::make_tasks_from_operator(get_table)));
+
+  // A single one of the 1,000 distinct values is estimated to match
+  const auto table_scan = std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::Equals, 42);
+  EXPECT_FALSE(admission_control.is_heavy_query(OperatorTask::make_tasks_from_operator(table_scan)));
+
+  // Operators above the predicate process the matching rows only
+  const auto sort = std::make_shared<Sort>(table_scan, ColumnID{0});
+  EXPECT_FALSE(admission_control.is_heavy_query(OperatorTask::make_tasks_from_operator(sort)));
+
+  const auto primary_key_lookup = std::make_shared<PrimaryKeyLookup>(get_table, ColumnID{0}, 42);
+  EXPECT_FALSE(admission_control.is_heavy_query(OperatorTask::make_tasks_from_operator(primary_key_lookup)));
+
+  const auto range_scan =
+      std::make_shared<TableScan>(get_table, ColumnID{0}, PredicateCondition::GreaterThanEquals, 100);
+  EXPECT_TRUE(admission_control.is_heavy_query(OperatorTask::make_tasks_from_operator(range_scan)));
+}
+
+TEST_F(AdmissionControlTest, ExecutesShortAndHeavyQueries) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  // table_a has 3 rows, table_b 4, of which the predicate is estimated to match less than all
+  auto& admission_control = AdmissionControl::get();
+  admission_control.set_heavy_query_row_count(3);
+
+  const auto short_query = _create_query("table_a");
+  admission_control.schedule_and_wait_for_query(short_query);
+  EXPECT_TABLE_EQ_UNORDERED(short_query.back()->get_operator()->get_output(),
+                            load_table("src/test/tables/int_float_filtered2.tbl", 1));
+
+  const auto heavy_query = _create_query("table_b");
+  admission_control.schedule_and_wait_for_query(heavy_query);
+  EXPECT_EQ(heavy_query.back()->get_operator()->get_output()->row_count(), 2u);
+
+  EXPECT_EQ(admission_control.admitted_heavy_query_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(AdmissionControlTest, LimitsConcurrentHeavyQueries) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto& admission_control = AdmissionControl::get();
+  admission_control.set_heavy_query_row_count(0);
+  admission_control.set_max_concurrent_heavy_queries(1);
+
+  constexpr auto num_threads = 4u;
+  std::atomic_uint max_admitted_count{0};
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = 0u; thread_idx < num_threads; ++thread_idx) {
+    threads.emplace_back([&]() {
+      auto get_table = std::make_shared<GetTable>("table_b");
+      auto tasks = OperatorTask::make_tasks_from_operator(get_table);
+      // Executed as part of the query, i.e., while it is admitted
+      tasks.back()->set_done_callback([&]() {
+        const auto admitted_count = static_cast<unsigned>(admission_control.admitted_heavy_query_count());
+        auto previous_max = max_admitted_count.load();
+        while (admitted_count > previous_max &&
+               !max_admitted_count.compare_exchange_weak(previous_max, admitted_count)) {
+        }
+      });
+
+      admission_control.schedule_and_wait_for_query(tasks);
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(max_admitted_count, 1u);
+  EXPECT_EQ(admission_control.admitted_heavy_query_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+}
+
+}  // namespace opossum
@@ -0,0 +1,155 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "operators/product.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/parallel_for.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class CancellationTokenTest : public BaseTest {};
+
+TEST_F(CancellationTokenTest, Cancel) {
+  CancellationToken cancellation_token;
+  EXPECT_FALSE(cancellation_token.is_cancelled());
+  EXPECT_NO_THROW(cancellation_token.check());
+
+  cancellation_token.cancel();
+  EXPECT_TRUE(cancellation_token.is_cancelled());
+  EXPECT_THROW(cancellation_token.check(), QueryCancelledException);
+}
+
+TEST_F(CancellationTokenTest, Timeout) {
+  CancellationToken cancellation_token;
+
+  cancellation_token.cancel_after(std::chrono::milliseconds{60'000});
+  EXPECT_FALSE(cancellation_token.is_cancelled());
+
+  cancellation_token.cancel_after(std::chrono::milliseconds{0});
+  EXPECT_TRUE(cancellation_token.is_cancelled());
+  EXPECT_THROW(cancellation_token.check(), QueryCancelledException);
+}
+
+TEST_F(CancellationTokenTest, LongTimeoutsDoNotOverflow) {
+  CancellationToken cancellation_token;
+
+  cancellation_token.cancel_after(std::chrono::milliseconds::max());
+  EXPECT_FALSE(cancellation_token.is_cancelled());
+
+  cancellation_token.cancel_after(CancellationToken::MAX_TIMEOUT);
+  EXPECT_FALSE(cancellation_token.is_cancelled());
+  EXPECT_NO_THROW(cancellation_token.check());
+}
+
+TEST_F(CancellationTokenTest, CancelledTasksAreSkipped) {
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  cancellation_token->cancel();
+
+  auto executed_count = 0u;
+  auto task1 = std::make_shared<JobTask>([&]() { ++executed_count; });
+  auto task2 = std::make_shared<JobTask>([&]() { ++executed_count; });
+  task1->set_as_predecessor_of(task2);
+  task1->set_cancellation_token(cancellation_token);
+  task2->set_cancellation_token(cancellation_token);
+
+  task1->schedule();
+  task2->schedule();
+
+  EXPECT_EQ(executed_count, 0u);
+  EXPECT_TRUE(task1->is_done());
+  EXPECT_TRUE(task2->is_done());
+  EXPECT_TRUE(task1->was_cancelled());
+  EXPECT_TRUE(task2->was_cancelled());
+}
+
+TEST_F(CancellationTokenTest, TasksCancelledAfterExecutionAreComplete) {
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+
+  auto task = std::make_shared<JobTask>([]() {});
+  task->set_cancellation_token(cancellation_token);
+  task->schedule();
+
+  // E.g., the statement timeout passed after the last operator finished
+  cancellation_token->cancel();
+  EXPECT_TRUE(task->is_done());
+  EXPECT_FALSE(task->was_cancelled());
+}
+
+TEST_F(CancellationTokenTest, ScheduledTasksInheritToken) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  auto inherited_cancellation_token = std::shared_ptr<CancellationToken>{};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    EXPECT_EQ(AbstractTask::this_thread_cancellation_token(), cancellation_token);
+
+    auto job = std::make_shared<JobTask>([]() {});
+    job->schedule();
+    inherited_cancellation_token = job->cancellation_token();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<JobTask>>{job});
+  });
+  task->set_cancellation_token(cancellation_token);
+  task->schedule();
+  task->join();
+
+  EXPECT_EQ(inherited_cancellation_token, cancellation_token);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(CancellationTokenTest, OperatorsStopWhenCancelled) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int.tbl", 1));
+  table_wrapper->execute();
+  auto product = std::make_shared<Product>(table_wrapper, table_wrapper);
+
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  auto task = std::make_shared<JobTask>([&]() {
+    cancellation_token->cancel();
+    EXPECT_THROW(product->execute(), QueryCancelledException);
+  });
+  task->set_cancellation_token(cancellation_token);
+  task->schedule();
+
+  EXPECT_TRUE(task->is_done());
+  EXPECT_EQ(product->get_output(), nullptr);
+}
+
+TEST_F(CancellationTokenTest, ParallelForStopsWhenCancelled) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  constexpr auto loop_size = size_t{10'000};
+  std::atomic<size_t> call_count{0};
+  auto loop_was_cancelled = false;
+
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  auto task = std::make_shared<JobTask>([&]() {
+    try {
+      parallel_for(size_t{0}, loop_size, [&](const size_t index) {
+        if (index == 10) cancellation_token->cancel();
+        ++call_count;
+      });
+    } catch (const QueryCancelledException&) {
+      loop_was_cancelled = true;
+    }
+  });
+  task->set_cancellation_token(cancellation_token);
+  task->schedule();
+  task->join();
+
+  EXPECT_TRUE(loop_was_cancelled);
+  EXPECT_LT(call_count, loop_size);
+
+  CurrentScheduler::get()->finish();
+}
+
+}  // namespace opossum
@@ -1,4 +1,7 @@
+#include <chrono>
 #include <memory>
+#include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -10,7 +13,11 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/parallel_for.hpp"
+#include "scheduler/task_deque.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
+#include "scheduler/worker.hpp"
 #include "storage/storage_manager.hpp"
 
 namespace opossum {
@@ -203,4 +210,345 @@ TEST_F(SchedulerTest, MultipleOperators) {
   EXPECT_TABLE_EQ_UNORDERED(ts->get_output(), expected_result);
 }
 
+TEST_F(SchedulerTest, TaskDequePullsLifoAndStealsFifo) {
+  auto deque = TaskDeque{NodeID{1}};
+  EXPECT_TRUE(deque.empty());
+
+  // More tasks than the initial capacity, so that the deque has to grow
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_idx = 0; task_idx < 100; ++task_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    deque.push(tasks.back());
+  }
+
+  // A task is only enqueued once
+  deque.push(tasks.front());
+
+  EXPECT_FALSE(deque.empty());
+  EXPECT_EQ(tasks.front()->node_id(), NodeID{1});
+
+  EXPECT_EQ(deque.pull(), tasks[99]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pull(), tasks[98]);
+  EXPECT_EQ(deque.steal(), tasks[1]);
+
+  for (auto task_idx = 2; task_idx < 98; ++task_idx) {
+    EXPECT_EQ(deque.steal(), tasks[task_idx]);
+  }
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pull(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(SchedulerTest, TaskDequeHandsOutEveryTaskOnce) {
+  auto deque = TaskDeque{NodeID{0}};
+
+  constexpr auto num_tasks = 10'000u;
+  constexpr auto num_thieves = 4u;
+
+  std::atomic_uint counter{0};
+  std::atomic_bool done{false};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_idx = 0u; thief_idx < num_thieves; ++thief_idx) {
+    thieves.emplace_back([&]() {
+      while (!done) {
+        auto task = deque.steal();
+        if (task) task->execute();
+      }
+    });
+  }
+
+  for (auto task_idx = 0u; task_idx < num_tasks; ++task_idx) {
+    deque.push(std::make_shared<JobTask>([&]() { counter++; }));
+    if (task_idx % 3 == 0) {
+      auto task = deque.pull();
+      if (task) task->execute();
+    }
+  }
+
+  while (auto task = deque.pull()) {
+    task->execute();
+  }
+
+  done = true;
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  EXPECT_EQ(counter, num_tasks);
+}
+
+TEST_F(SchedulerTest, TaskQueueServesSessionsRoundRobin) {
+  auto queue = TaskQueue{NodeID{0}};
+
+  auto create_task = [](const SessionID session_id) {
+    auto task = std::make_shared<JobTask>([]() {});
+    task->set_session_id(session_id);
+    return task;
+  };
+
+  // Session 1 schedules three tasks before session 2 schedules its first one
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{create_task(1), create_task(1), create_task(1),
+                                                          create_task(2), create_task(2)};
+  for (const auto& task : tasks) {
+    queue.push(task, static_cast<uint32_t>(SchedulePriority::Normal));
+  }
+
+  auto high_priority_task = create_task(3);
+  queue.push(high_priority_task, static_cast<uint32_t>(SchedulePriority::High));
+
+  EXPECT_EQ(queue.pull(), high_priority_task);
+  EXPECT_EQ(queue.pull(), tasks[0]);
+  EXPECT_EQ(queue.pull(), tasks[3]);
+  EXPECT_EQ(queue.steal(), tasks[1]);
+  EXPECT_EQ(queue.pull(), tasks[4]);
+  EXPECT_EQ(queue.pull(), tasks[2]);
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.pull(), nullptr);
+}
+
+TEST_F(SchedulerTest, TasksInheritSession) {
+  auto job_session_id = INVALID_SESSION_ID;
+  auto job = std::make_shared<JobTask>([]() {});
+
+  auto task = std::make_shared<JobTask>([&]() {
+    job->schedule();
+    job_session_id = job->session_id();
+  });
+  task->set_session_id(5);
+  task->schedule();
+
+  EXPECT_EQ(job_session_id, 5u);
+
+  // Tasks scheduled outside of tasks belong to no session
+  auto other_task = std::make_shared<JobTask>([]() {});
+  other_task->schedule();
+  EXPECT_EQ(other_task->session_id(), INVALID_SESSION_ID);
+}
+
+TEST_F(SchedulerTest, JobsOfSessionsAreServedRoundRobin) {
+  // With a single worker, nobody else takes the jobs before they are checked
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(1)));
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto schedule_job = [&](const bool expect_in_deque) {
+    const auto worker = Worker::get_this_thread_worker();
+    auto job = std::make_shared<JobTask>([]() {});
+    job->schedule();
+    jobs.emplace_back(job);
+
+    // Jobs of a session go to the TaskQueue, so that they do not take the worker from the other sessions
+    EXPECT_EQ(worker->deque().empty(), !expect_in_deque);
+    EXPECT_EQ(worker->queue()->empty(), expect_in_deque);
+  };
+
+  auto session_task = std::make_shared<JobTask>([&]() { schedule_job(false); });
+  session_task->set_session_id(1);
+  session_task->schedule();
+  session_task->join();
+
+  auto task = std::make_shared<JobTask>([&]() { schedule_job(true); });
+  task->schedule();
+  task->join();
+
+  CurrentScheduler::wait_for_tasks(jobs);
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, JobsOfWorkersAreStolen) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  std::atomic_uint counter{0};
+
+  // The jobs end up in the deque of the worker that executes the task. They must be executed (i.e., stolen by the
+  // worker that replaces it while it waits) for the task to finish.
+  auto task = std::make_shared<JobTask>([&]() {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto job_idx = 0; job_idx < 100; ++job_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([&]() { counter++; }));
+    }
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+  });
+  task->schedule();
+  task->join();
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_EQ(counter, 100u);
+}
+
+TEST_F(SchedulerTest, ParallelForWithoutScheduler) {
+  auto visited = std::vector<ChunkID>{};
+  parallel_for(ChunkID{2}, ChunkID{5}, [&](const ChunkID chunk_id) { visited.emplace_back(chunk_id); });
+  EXPECT_EQ(visited, std::vector<ChunkID>({ChunkID{2}, ChunkID{3}, ChunkID{4}}));
+
+  parallel_for(ChunkID{5}, ChunkID{5}, [&](const ChunkID) { FAIL(); });
+}
+
+TEST_F(SchedulerTest, ParallelForWithScheduler) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  // Every index is processed exactly once, also when loops are nested within tasks and other loops
+  auto visit_counts = std::vector<std::atomic_uint>(1'000);
+  auto task = std::make_shared<JobTask>([&]() {
+    parallel_for(size_t{0}, size_t{10}, [&](const size_t outer_index) {
+      parallel_for(size_t{0}, size_t{100},
+                   [&](const size_t inner_index) { ++visit_counts[outer_index * 100 + inner_index]; });
+    });
+  });
+  task->schedule();
+
+  parallel_for(size_t{0}, visit_counts.size(), [&](const size_t index) { ++visit_counts[index]; });
+  task->join();
+
+  for (const auto& visit_count : visit_counts) {
+    EXPECT_EQ(visit_count, 2u);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ParallelForRethrowsExceptions) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto this_thread_id = std::this_thread::get_id();
+  std::atomic_bool calling_thread_called{false};
+  EXPECT_THROW(parallel_for(size_t{0}, size_t{100},
+                            [&](const size_t) {
+                              if (std::this_thread::get_id() == this_thread_id) {
+                                calling_thread_called = true;
+                                throw std::logic_error("Failure");
+                              }
+                              // Otherwise, the helpers might process all indices before the calling thread gets one
+                              while (!calling_thread_called) std::this_thread::yield();
+                            }),
+               std::logic_error);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ParallelForRethrowsExceptionsOfHelpers) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto this_thread_id = std::this_thread::get_id();
+  std::atomic_bool helper_threw{false};
+  EXPECT_THROW(parallel_for(size_t{0}, size_t{100},
+                            [&](const size_t) {
+                              if (std::this_thread::get_id() != this_thread_id) {
+                                helper_threw = true;
+                                throw std::logic_error("Failure");
+                              }
+                              // The calling thread keeps its first index until a helper failed
+                              while (!helper_threw) std::this_thread::yield();
+                            }),
+               std::logic_error);
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ParallelForMorselsWithoutScheduler) {
+  // Without a scheduler, units are neither split nor grouped, and empty units are skipped
+  auto visited = std::vector<std::tuple<size_t, size_t, size_t>>{};
+  parallel_for_morsels({3, 0, 100'000}, true, [&](const size_t unit, const size_t begin, const size_t end) {
+    visited.emplace_back(unit, begin, end);
+  });
+
+  const auto expected = std::vector<std::tuple<size_t, size_t, size_t>>{{0, 0, 3}, {2, 0, 100'000}};
+  EXPECT_EQ(visited, expected);
+}
+
+TEST_F(SchedulerTest, ParallelForMorselsWithScheduler) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto unit_sizes = std::vector<size_t>{0, 250'000, 7, 0, 3, 40'000, 1, 0};
+
+  for (const auto split_units : {false, true}) {
+    auto visit_counts = std::vector<std::vector<std::atomic_uint>>{};
+    for (const auto unit_size : unit_sizes) {
+      visit_counts.emplace_back(unit_size);
+    }
+
+    auto split_unit_count = std::atomic_uint{0};
+    parallel_for_morsels(unit_sizes, split_units, [&](const size_t unit, const size_t begin, const size_t end) {
+      ASSERT_LT(begin, end);
+      ASSERT_LE(end, unit_sizes[unit]);
+      if (end - begin != unit_sizes[unit]) ++split_unit_count;
+
+      for (auto row = begin; row < end; ++row) {
+        ++visit_counts[unit][row];
+      }
+    });
+
+    // Every row is processed exactly once, and units are only split if this is allowed (and useful, i.e., if there
+    // is more than one CPU)
+    for (const auto& unit_visit_counts : visit_counts) {
+      for (const auto& visit_count : unit_visit_counts) {
+        EXPECT_EQ(visit_count, 1u);
+      }
+    }
+    EXPECT_EQ(split_unit_count > 0, split_units && CurrentScheduler::get()->topology()->num_cpus() > 1);
+  }
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, IdleWorkersPark) {
+  const auto scheduler = std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4));
+  CurrentScheduler::set(scheduler);
+
+  const auto wait_until_all_workers_parked = [&]() {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (scheduler->num_parked_workers() < scheduler->processing_units().size() &&
+           std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    return scheduler->num_parked_workers() == scheduler->processing_units().size();
+  };
+
+  EXPECT_TRUE(wait_until_all_workers_parked());
+
+  // Scheduling tasks wakes up parked workers
+  std::atomic_uint counter{0};
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  for (auto task_idx = 0u; task_idx < 100; ++task_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() { ++counter; }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  EXPECT_EQ(counter, 100u);
+
+  EXPECT_TRUE(wait_until_all_workers_parked());
+
+  CurrentScheduler::get()->finish();
+}
+
+TEST_F(SchedulerTest, ParkedWorkersRampUpForBursts) {
+  const auto scheduler = std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4));
+  CurrentScheduler::set(scheduler);
+
+  const auto num_workers = static_cast<unsigned>(scheduler->processing_units().size());
+
+  // Each task only finishes once all tasks run at the same time, i.e., once all workers are woken up
+  std::atomic_uint running_count{0};
+  std::atomic_uint all_running_count{0};
+  auto tasks = std::vector<std::shared_ptr<JobTask>>{};
+  for (auto task_idx = 0u; task_idx < num_workers; ++task_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([&]() {
+      ++running_count;
+      const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+      while (running_count < num_workers && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+      }
+      if (running_count == num_workers) ++all_running_count;
+    }));
+  }
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  EXPECT_EQ(all_running_count, num_workers);
+
+  CurrentScheduler::get()->finish();
+}
+
 }  // namespace opossum
@@ -0,0 +1,117 @@
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/scheduler_tracer.hpp"
+#include "scheduler/topology.hpp"
+
+namespace opossum {
+
+class SchedulerTracerTest : public BaseTest {
+ protected:
+  std::vector<std::shared_ptr<JobTask>> _run_jobs(const size_t num_jobs) {
+    auto jobs = std::vector<std::shared_ptr<JobTask>>{};
+    for (auto job_idx = size_t{0}; job_idx < num_jobs; ++job_idx) {
+      jobs.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+
+    CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+    return jobs;
+  }
+};
+
+TEST_F(SchedulerTracerTest, DisabledByDefault) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  EXPECT_FALSE(SchedulerTracer::is_enabled());
+  _run_jobs(10);
+
+  CurrentScheduler::get()->finish();
+
+  EXPECT_TRUE(SchedulerTracer::get().events().empty());
+}
+
+TEST_F(SchedulerTracerTest, RecordsTaskExecutions) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  auto& tracer = SchedulerTracer::get();
+  tracer.enable();
+  const auto jobs = _run_jobs(100);
+  tracer.disable();
+
+  CurrentScheduler::get()->finish();
+
+  auto executed_task_ids = std::set<TaskID>{};
+  for (const auto& event : tracer.events()) {
+    if (event.type != SchedulerTraceEventType::TaskExecution) continue;
+
+    EXPECT_TRUE(executed_task_ids.emplace(event.task_id).second);
+    EXPECT_NE(event.worker_id, INVALID_WORKER_ID);
+    EXPECT_LT(event.node_id, NodeID{2});
+    EXPECT_LE(event.start_time, event.end_time);
+    EXPECT_GE(event.queue_wait, 0);
+    EXPECT_EQ(std::string{event.description}, "{Task with id: " + std::to_string(event.task_id) + "}");
+  }
+
+  auto expected_task_ids = std::set<TaskID>{};
+  for (const auto& job : jobs) {
+    expected_task_ids.emplace(job->id());
+  }
+  EXPECT_EQ(executed_task_ids, expected_task_ids);
+
+  // Nothing is recorded after tracing was disabled
+  const auto event_count = tracer.events().size();
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+  _run_jobs(10);
+  CurrentScheduler::get()->finish();
+  EXPECT_EQ(tracer.events().size(), event_count);
+}
+
+TEST_F(SchedulerTracerTest, RingBufferKeepsLatestEvents) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(1, 1)));
+
+  auto& tracer = SchedulerTracer::get();
+  tracer.enable(4);
+  const auto jobs = _run_jobs(20);
+  tracer.disable();
+
+  CurrentScheduler::get()->finish();
+
+  // The single Worker executes the jobs in the order in which they were scheduled
+  const auto events = tracer.events();
+  ASSERT_EQ(events.size(), 4u);
+  for (auto event_idx = size_t{0}; event_idx < events.size(); ++event_idx) {
+    EXPECT_EQ(events[event_idx].task_id, jobs[16 + event_idx]->id());
+  }
+}
+
+TEST_F(SchedulerTracerTest, ExportsChromeTrace) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(1, 1)));
+
+  auto& tracer = SchedulerTracer::get();
+  tracer.enable();
+  const auto jobs = _run_jobs(1);
+  tracer.disable();
+
+  CurrentScheduler::get()->finish();
+
+  auto stream = std::stringstream{};
+  tracer.export_chrome_trace(stream);
+  const auto trace = stream.str();
+
+  EXPECT_EQ(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+  EXPECT_NE(trace.find(R"({"name":"process_name","ph":"M","pid":0,"args":{"name":"Node 0"}})"), std::string::npos);
+  EXPECT_NE(trace.find(R"({"name":"{Task with id: )" + std::to_string(jobs[0]->id()) + R"(}","cat":"task","ph":"X")"),
+            std::string::npos);
+  EXPECT_NE(trace.find(R"("args":{"task_id":)" + std::to_string(jobs[0]->id()) + R"(,"queue_wait_us":)"),
+            std::string::npos);
+}
+
+}  // namespace opossum
@@ -334,6 +334,32 @@ TEST_F(ServerSessionTest, SessionHandlesLoadTableRequestInSimpleQueryCommand) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionHandlesSetStatementTimeoutInSimpleQueryCommand) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader request{NetworkMessageType::SimpleQueryCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(request))));
+
+  EXPECT_CALL(*_connection, receive_simple_query_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::string("SET statement_timeout = 1000;")))));
+
+  // The session schedules a CreatePipelineTask which is responsible for detecting the SET command
+  auto create_pipeline_result = std::make_unique<CreatePipelineResult>();
+  create_pipeline_result->statement_timeout = std::chrono::milliseconds{1000};
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<CreatePipelineTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(create_pipeline_result)))));
+
+  // No query is executed, the session only acknowledges the command
+  EXPECT_CALL(*_connection, send_command_complete("SET"));
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   InSequence s;
 
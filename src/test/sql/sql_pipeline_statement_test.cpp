@@ -482,6 +482,27 @@ TEST_F(SQLPipelineStatementTest, GetResultTableNoMVCC) {
   EXPECT_EQ(sql_pipeline.transaction_context(), nullptr);
 }
 
+TEST_F(SQLPipelineStatementTest, GetResultTableCancelled) {
+  auto context = TransactionManager::get().new_transaction_context();
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.with_transaction_context(context).create_pipeline_statement();
+
+  sql_pipeline.cancel();
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+
+  // The statement did not execute (completely), so its transaction was rolled back
+  EXPECT_EQ(context->phase(), TransactionPhase::RolledBack);
+}
+
+TEST_F(SQLPipelineStatementTest, GetResultTableWithStatementTimeout) {
+  auto sql_pipeline =
+      SQLPipelineBuilder{_join_query}.with_statement_timeout(std::chrono::minutes{1}).create_pipeline_statement();
+
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+  const auto& table = sql_pipeline.get_result_table();
+
+  EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
+}
+
 TEST_F(SQLPipelineStatementTest, GetTimes) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
 
@@ -575,6 +596,35 @@ TEST_F(SQLPipelineStatementTest, PreparedStatementMultiPlaceholderExecute) {
   EXPECT_TABLE_EQ_UNORDERED(table, expected);
 }
 
+TEST_F(SQLPipelineStatementTest, PreparedStatementSeesRowsInsertedIntoMutableChunks) {
+  auto prepared_statement_cache = std::make_shared<SQLQueryCache<SQLQueryPlan>>(5);
+
+  // The first Insert fills the second chunk, the second one creates a third chunk whose statistics only cover 200
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (100, 1.5)"}.create_pipeline_statement().get_result_table();
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (200, 2.5)"}.create_pipeline_statement().get_result_table();
+  ASSERT_EQ(_table_a->chunk_count(), 3u);
+  ASSERT_TRUE(_table_a->get_chunk(ChunkID{2})->statistics());
+
+  // The predicate on a is part of the prepared plan, only the one on b is a placeholder
+  auto prepare_sql_pipeline = SQLPipelineBuilder{"PREPARE x1 FROM 'SELECT * FROM table_a WHERE a = 201 AND b > ?'"}
+                                  .with_prepared_statement_cache(prepared_statement_cache)
+                                  .create_pipeline_statement();
+  prepare_sql_pipeline.get_result_table();
+
+  SQLPipelineBuilder{"INSERT INTO table_a VALUES (201, 3.5)"}.create_pipeline_statement().get_result_table();
+  ASSERT_EQ(_table_a->chunk_count(), 3u);
+
+  auto execute_sql_pipeline = SQLPipelineBuilder{"EXECUTE x1 (0.5)"}
+                                  .with_prepared_statement_cache(prepared_statement_cache)
+                                  .create_pipeline_statement();
+  const auto& table = execute_sql_pipeline.get_result_table();
+
+  auto expected = std::make_shared<Table>(_int_float_column_definitions, TableType::Data);
+  expected->append({201, 3.5f});
+
+  EXPECT_TABLE_EQ_UNORDERED(table, expected);
+}
+
 TEST_F(SQLPipelineStatementTest, MultiplePreparedStatementsExecute) {
   auto prepared_statement_cache = std::make_shared<SQLQueryCache<SQLQueryPlan>>(5);
 
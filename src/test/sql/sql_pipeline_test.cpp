@@ -340,6 +340,15 @@ TEST_F(SQLPipelineTest, GetResultTable) {
   EXPECT_TABLE_EQ_UNORDERED(table, _table_a)
 }
 
+TEST_F(SQLPipelineTest, GetResultTableWithPipelining) {
+  const auto query = "SELECT a, b * 2 AS b2 FROM table_a WHERE a > 1000";
+
+  auto sql_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+  auto pipelined_sql_pipeline = SQLPipelineBuilder{query}.with_pipelining(UsePipelining::Yes).create_pipeline();
+
+  EXPECT_TABLE_EQ_UNORDERED(pipelined_sql_pipeline.get_result_table(), sql_pipeline.get_result_table());
+}
+
 TEST_F(SQLPipelineTest, GetResultTableMultiple) {
   auto sql_pipeline = SQLPipelineBuilder{_multi_statement_query}.create_pipeline();
   const auto& table = sql_pipeline.get_result_table();
@@ -23,8 +23,9 @@ class AdaptiveRadixTreeIndexTest : public BaseTest {
     // Therefore we build an index and reset the root.
     dict_col1 = create_dict_column_by_type<std::string>(DataType::String, {"test"});
     index1 = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseColumn>>({dict_col1}));
-    index1->_root = nullptr;
+    index1->_root = ARTNodeReference{};
     index1->_chunk_offsets.clear();
+    index1->_nodes = ARTNodeArena{};
     /* root   childx    childxx  childxxx  leaf->chunk offsets
      * 01 --->  01 -----> 01 -----> 01 --> 0x00000001u, 0x00000007u
      * 02 -|    02 ---|   02 ---|   02 --> 0x00000002u
@@ -39,16 +40,38 @@ class AdaptiveRadixTreeIndexTest : public BaseTest {
     values1 = {0x00000001u, 0x00000002u, 0x00000003u, 0x00000004u, 0x00000005u, 0x00000006u, 0x00000007u};
 
     for (size_t i = 0; i < 7; ++i) {
-      auto bc = AdaptiveRadixTreeIndex::BinaryComparable(keys1[i]);
-      pairs.emplace_back(std::make_pair(bc, values1[i]));
+      pairs.emplace_back(std::make_pair(keys1[i], values1[i]));
     }
-    root = index1->_bulk_insert(pairs);
+    root = build_tree(pairs);
+  }
+
+  // Sorts the values by their ValueIDs into the _chunk_offsets of index1 and builds its tree from them
+  ARTNodeReference build_tree(std::vector<std::pair<ValueID, ChunkOffset>> values) {
+    std::stable_sort(values.begin(), values.end(),
+                     [](const auto& left, const auto& right) { return left.first < right.first; });
+
+    auto leaves = std::vector<std::pair<ValueID, ARTNodeReference>>{};
+    for (auto group_begin = size_t{0}; group_begin < values.size();) {
+      const auto value_id = values[group_begin].first;
+      const auto begin = static_cast<uint32_t>(index1->_chunk_offsets.size());
+
+      auto group_end = group_begin;
+      for (; group_end < values.size() && values[group_end].first == value_id; ++group_end) {
+        index1->_chunk_offsets.emplace_back(values[group_end].second);
+      }
+
+      const auto end = static_cast<uint32_t>(index1->_chunk_offsets.size());
+      leaves.emplace_back(value_id, index1->_nodes.add_leaf(value_id, begin, end));
+      group_begin = group_end;
+    }
+
+    return index1->_build_tree(std::move(leaves));
   }
 
   std::shared_ptr<AdaptiveRadixTreeIndex> index1 = nullptr;
   std::shared_ptr<BaseColumn> dict_col1 = nullptr;
-  std::shared_ptr<ARTNode> root = nullptr;
-  std::vector<std::pair<AdaptiveRadixTreeIndex::BinaryComparable, ChunkOffset>> pairs;
+  ARTNodeReference root;
+  std::vector<std::pair<ValueID, ChunkOffset>> pairs;
   std::vector<ValueID> keys1;
   std::vector<ChunkOffset> values1;
 };
@@ -63,56 +86,110 @@ TEST_F(AdaptiveRadixTreeIndexTest, BinaryComparableFromChunkOffset) {
   EXPECT_EQ(binary_comparable.size(), 4u);
 }
 
-TEST_F(AdaptiveRadixTreeIndexTest, BulkInsert) {
+TEST_F(AdaptiveRadixTreeIndexTest, BuildTree) {
   std::vector<ChunkOffset> expected_chunk_offsets = {0x00000001u, 0x00000007u, 0x00000002u, 0x00000003u,
                                                      0x00000004u, 0x00000005u, 0x00000006u};
-  EXPECT_FALSE(std::dynamic_pointer_cast<Leaf>(root));
   EXPECT_EQ(index1->_chunk_offsets, expected_chunk_offsets);
 
-  auto root4 = std::dynamic_pointer_cast<ARTNode4>(root);
-  EXPECT_EQ(root4->_partial_keys[0], static_cast<uint8_t>(0x01u));
-  EXPECT_EQ(root4->_partial_keys[1], static_cast<uint8_t>(0x02u));
-  EXPECT_EQ(root4->_partial_keys[2], static_cast<uint8_t>(0xffu));
-  EXPECT_EQ(root4->_partial_keys[3], static_cast<uint8_t>(0xffu));
-
-  auto child01 = std::dynamic_pointer_cast<ARTNode4>(root4->_children[0]);
-  EXPECT_EQ(child01->_partial_keys[0], static_cast<uint8_t>(0x01u));
-  EXPECT_EQ(child01->_partial_keys[1], static_cast<uint8_t>(0x02u));
-  EXPECT_EQ(child01->_partial_keys[2], static_cast<uint8_t>(0xffu));
-  EXPECT_EQ(child01->_partial_keys[3], static_cast<uint8_t>(0xffu));
-
-  auto child0101 = std::dynamic_pointer_cast<ARTNode4>(child01->_children[0]);
-  EXPECT_EQ(child0101->_partial_keys[0], static_cast<uint8_t>(0x01u));
-  EXPECT_EQ(child0101->_partial_keys[1], static_cast<uint8_t>(0x02u));
-  EXPECT_EQ(child0101->_partial_keys[2], static_cast<uint8_t>(0xffu));
-  EXPECT_EQ(child0101->_partial_keys[3], static_cast<uint8_t>(0xffu));
-
-  auto child010101 = std::dynamic_pointer_cast<ARTNode4>(child0101->_children[0]);
-  EXPECT_EQ(child0101->_partial_keys[0], static_cast<uint8_t>(0x01u));
-  EXPECT_EQ(child0101->_partial_keys[1], static_cast<uint8_t>(0x02u));
-  EXPECT_EQ(child0101->_partial_keys[2], static_cast<uint8_t>(0xffu));
-  EXPECT_EQ(child0101->_partial_keys[3], static_cast<uint8_t>(0xffu));
-
-  auto leaf01010101 = std::dynamic_pointer_cast<Leaf>(child010101->_children[0]);
-  EXPECT_EQ(*(leaf01010101->begin()), 0x00000001u);
-  EXPECT_EQ(*(leaf01010101->end()), 0x00000002u);
-  EXPECT_EQ(std::distance(leaf01010101->begin(), leaf01010101->end()), 2);
-  EXPECT_FALSE(std::find(leaf01010101->begin(), leaf01010101->end(), static_cast<uint8_t>(0x00000001u)) ==
-               leaf01010101->end());
-  EXPECT_FALSE(std::find(leaf01010101->begin(), leaf01010101->end(), static_cast<uint8_t>(0x00000007u)) ==
-               leaf01010101->end());
-
-  auto leaf01010102 = std::dynamic_pointer_cast<Leaf>(child010101->_children[1]);
-  EXPECT_EQ(*(leaf01010102->begin()), 0x00000002u);
-  EXPECT_EQ(*(leaf01010102->end()), 0x00000003u);
-  EXPECT_EQ(std::distance(leaf01010102->begin(), leaf01010102->end()), 1);
-  EXPECT_FALSE(std::find(leaf01010102->begin(), leaf01010102->end(), static_cast<uint8_t>(0x00000002u)) ==
-               leaf01010102->end());
-
-  auto leaf02 = std::dynamic_pointer_cast<Leaf>(root4->_children[1]);
-  EXPECT_EQ(std::distance(leaf02->begin(), leaf02->end()), 1);
-  EXPECT_EQ(*(leaf02->begin()), 0x00000006u);
-  EXPECT_FALSE(std::find(leaf02->begin(), leaf02->end(), static_cast<uint8_t>(0x00000006u)) == leaf02->end());
+  const auto& nodes = index1->_nodes;
+
+  ASSERT_EQ(root.type(), ARTNodeType::Node4);
+  const auto& root4 = nodes.node4(root);
+  EXPECT_EQ(root4.child_count, 2u);
+  EXPECT_EQ(root4.partial_keys[0], static_cast<uint8_t>(0x01u));
+  EXPECT_EQ(root4.partial_keys[1], static_cast<uint8_t>(0x02u));
+  EXPECT_EQ(root4.partial_keys[2], static_cast<uint8_t>(0xffu));
+  EXPECT_EQ(root4.partial_keys[3], static_cast<uint8_t>(0xffu));
+  EXPECT_EQ(nodes.begin(root), 0u);
+  EXPECT_EQ(nodes.end(root), 7u);
+
+  const auto& child01 = nodes.node4(root4.children[0]);
+  EXPECT_EQ(child01.child_count, 2u);
+  EXPECT_EQ(child01.partial_keys[0], static_cast<uint8_t>(0x01u));
+  EXPECT_EQ(child01.partial_keys[1], static_cast<uint8_t>(0x02u));
+
+  const auto& child0101 = nodes.node4(child01.children[0]);
+  EXPECT_EQ(child0101.child_count, 2u);
+  EXPECT_EQ(child0101.partial_keys[0], static_cast<uint8_t>(0x01u));
+  EXPECT_EQ(child0101.partial_keys[1], static_cast<uint8_t>(0x02u));
+
+  const auto& child010101 = nodes.node4(child0101.children[0]);
+  EXPECT_EQ(child010101.child_count, 2u);
+  EXPECT_EQ(child010101.partial_keys[0], static_cast<uint8_t>(0x01u));
+  EXPECT_EQ(child010101.partial_keys[1], static_cast<uint8_t>(0x02u));
+
+  // The only key with prefix 0x010102 is represented by a leaf directly below child0101
+  EXPECT_EQ(child0101.children[1].type(), ARTNodeType::Leaf);
+
+  const auto& leaf01010101 = nodes.leaf(child010101.children[0]);
+  EXPECT_EQ(leaf01010101.value_id, 0x01010101u);
+  EXPECT_EQ(index1->_chunk_offsets[leaf01010101.begin], 0x00000001u);
+  EXPECT_EQ(index1->_chunk_offsets[leaf01010101.end], 0x00000002u);
+  EXPECT_EQ(leaf01010101.end - leaf01010101.begin, 2u);
+
+  const auto& leaf01010102 = nodes.leaf(child010101.children[1]);
+  EXPECT_EQ(index1->_chunk_offsets[leaf01010102.begin], 0x00000002u);
+  EXPECT_EQ(index1->_chunk_offsets[leaf01010102.end], 0x00000003u);
+  EXPECT_EQ(leaf01010102.end - leaf01010102.begin, 1u);
+
+  ASSERT_EQ(root4.children[1].type(), ARTNodeType::Leaf);
+  const auto& leaf02 = nodes.leaf(root4.children[1]);
+  EXPECT_EQ(leaf02.value_id, 0x02010101u);
+  EXPECT_EQ(leaf02.end - leaf02.begin, 1u);
+  EXPECT_EQ(index1->_chunk_offsets[leaf02.begin], 0x00000006u);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, LowerBoundPosition) {
+  index1->_root = root;
+
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x00000000u}), 0u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x01010101u}), 0u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x01010102u}), 2u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x01010103u}), 3u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x01020102u}), 5u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x01ffffffu}), 6u);
+
+  // Keys with the prefix of a leaf that is located above the maximum depth
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x02000000u}), 6u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x02010102u}), 7u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0xffffffffu}), 7u);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, NodeTypes) {
+  index1->_chunk_offsets.clear();
+  index1->_nodes = ARTNodeArena{};
+
+  // 256 keys with prefix 0x000000, 30 keys with prefix 0x000001, and 10 keys with prefix 0x000002
+  auto values = std::vector<std::pair<ValueID, ChunkOffset>>{};
+  for (auto partial_key = 0u; partial_key < 256u; ++partial_key) values.emplace_back(ValueID{partial_key}, 0u);
+  for (auto partial_key = 0u; partial_key < 30u; ++partial_key) values.emplace_back(ValueID{0x0100 + partial_key}, 1u);
+  for (auto partial_key = 0u; partial_key < 10u; ++partial_key) values.emplace_back(ValueID{0x0200 + partial_key}, 2u);
+
+  index1->_root = build_tree(values);
+  const auto& nodes = index1->_nodes;
+
+  // Three levels of single-child nodes lead to the node that distinguishes the prefixes
+  auto node = index1->_root;
+  for (auto depth = 0u; depth < 2u; ++depth) {
+    ASSERT_EQ(node.type(), ARTNodeType::Node4);
+    EXPECT_EQ(nodes.node4(node).child_count, 1u);
+    node = nodes.node4(node).children[0];
+  }
+
+  ASSERT_EQ(node.type(), ARTNodeType::Node4);
+  const auto& node4 = nodes.node4(node);
+  EXPECT_EQ(node4.child_count, 3u);
+  EXPECT_EQ(node4.children[0].type(), ARTNodeType::Node256);
+  EXPECT_EQ(node4.children[1].type(), ARTNodeType::Node48);
+  EXPECT_EQ(node4.children[2].type(), ARTNodeType::Node16);
+
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x00ffu}), 255u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x0100u}), 256u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x011du}), 285u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x011eu}), 286u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x0205u}), 291u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x020au}), 296u);
+  EXPECT_EQ(index1->_lower_bound_position(ValueID{0x0300u}), 296u);
 }
 
 TEST_F(AdaptiveRadixTreeIndexTest, VectorOfRandomInts) {
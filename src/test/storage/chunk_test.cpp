@@ -1,4 +1,7 @@
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -9,6 +12,8 @@
 #include "../lib/storage/column_encoding_utils.hpp"
 #include "../lib/storage/index/group_key/composite_group_key_index.hpp"
 #include "../lib/storage/index/group_key/group_key_index.hpp"
+#include "../lib/storage/reference_column.hpp"
+#include "../lib/storage/table.hpp"
 #include "../lib/types.hpp"
 
 namespace opossum {
@@ -188,4 +193,80 @@ TEST_F(StorageChunkTest, RemoveIndex) {
   EXPECT_EQ(std::find(ind_col_0.cbegin(), ind_col_0.cend(), index_str), ind_col_0.cend());
 }
 
+TEST_F(StorageChunkTest, CreateIndicesWhileLookingThemUp) {
+  c = std::make_shared<Chunk>(ChunkColumns({dc_int, dc_str}));
+  constexpr auto index_count = size_t{100};
+
+  auto done = std::atomic_bool{false};
+  auto reader = std::thread([&]() {
+    while (!done) {
+      for (const auto& index : c->get_indices(std::vector<ColumnID>{ColumnID{0}})) {
+        EXPECT_TRUE(index);
+      }
+      c->get_index(ColumnIndexType::GroupKey, std::vector<ColumnID>{ColumnID{0}});
+    }
+  });
+
+  for (auto index_id = size_t{0}; index_id < index_count; ++index_id) {
+    c->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  done = true;
+  reader.join();
+
+  EXPECT_EQ(c->get_indices(std::vector<ColumnID>{ColumnID{0}}).size(), index_count);
+}
+
+TEST_F(StorageChunkTest, OrderedBy) {
+  c = std::make_shared<Chunk>(ChunkColumns({vc_int, vc_str}));
+  EXPECT_FALSE(c->ordered_by());
+
+  c->set_ordered_by(std::make_pair(ColumnID{1}, OrderByMode::Descending));
+  ASSERT_TRUE(c->ordered_by());
+  EXPECT_EQ(c->ordered_by()->first, ColumnID{1});
+  EXPECT_EQ(c->ordered_by()->second, OrderByMode::Descending);
+
+  // Appending rows invalidates the sort order
+  c->append({2, "two"});
+  EXPECT_FALSE(c->ordered_by());
+}
+
+TEST_F(StorageChunkTest, MemoryUsage) {
+  c = std::make_shared<Chunk>(ChunkColumns({vc_int, vc_str}));
+  const auto usage = c->memory_usage();
+
+  EXPECT_GE(usage.data, 3 * sizeof(int32_t) + 3 * sizeof(std::string));
+  EXPECT_EQ(usage.data, vc_int->memory_usage().data + vc_str->memory_usage().data);
+  EXPECT_EQ(usage.dictionaries, 0u);
+  EXPECT_EQ(usage.indices, 0u);
+  EXPECT_GE(usage.metadata, sizeof(Chunk));
+  EXPECT_EQ(usage.total(), usage.data + usage.metadata + usage.null_values);
+}
+
+TEST_F(StorageChunkTest, MemoryUsageIncludesIndices) {
+  c = std::make_shared<Chunk>(ChunkColumns({dc_int, dc_str}));
+  const auto usage_before = c->memory_usage();
+  EXPECT_GT(usage_before.dictionaries, 0u);
+  EXPECT_GT(usage_before.attribute_vectors, 0u);
+  EXPECT_EQ(usage_before.data, 0u);
+
+  const auto index = c->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  const auto usage_after = c->memory_usage();
+  EXPECT_GE(usage_after.indices, index->memory_consumption());
+  EXPECT_EQ(usage_after.total() - usage_after.indices, usage_before.total());
+}
+
+TEST_F(StorageChunkTest, MemoryUsageCountsSharedPosListOnce) {
+  auto referenced_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::String}}, TableType::Data);
+  referenced_table->append_chunk(ChunkColumns({vc_int, vc_str}));
+
+  auto pos_list = std::make_shared<PosList>(PosList{{ChunkID{0}, ChunkOffset{2}}, {ChunkID{0}, ChunkOffset{0}}});
+  const auto column_a = std::make_shared<ReferenceColumn>(referenced_table, ColumnID{0}, pos_list);
+  const auto column_b = std::make_shared<ReferenceColumn>(referenced_table, ColumnID{1}, pos_list);
+  c = std::make_shared<Chunk>(ChunkColumns({column_a, column_b}));
+
+  EXPECT_EQ(column_a->memory_usage().pos_lists, pos_list->capacity() * sizeof(RowID));
+  EXPECT_EQ(c->memory_usage().pos_lists, column_a->memory_usage().pos_lists);
+}
+
 }  // namespace opossum
@@ -8,6 +8,7 @@
 #include "storage/chunk_encoder.hpp"
 #include "storage/column_encoding_utils.hpp"
 #include "storage/dictionary_column.hpp"
+#include "storage/dictionary_column/dictionary_column_builder.hpp"
 #include "storage/value_column.hpp"
 #include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 
@@ -188,4 +189,56 @@ TEST_F(StorageDictionaryColumnTest, MemoryUsageEstimation) {
   EXPECT_GE(dictionary_column->estimate_memory_usage(), empty_memory_usage + 3 * size_of_attribute);
 }
 
+TEST_F(StorageDictionaryColumnTest, BuilderReusesSingleDictionary) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  vc_str->append("Alexander");
+  auto col = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(
+      encode_column(EncodingType::Dictionary, DataType::String, vc_str));
+
+  auto builder = DictionaryColumnBuilder<std::string>{};
+  EXPECT_TRUE(builder.append(col, ChunkOffset{1}));
+  builder.append_null();
+  EXPECT_TRUE(builder.append(col, ChunkOffset{0}));
+  EXPECT_FALSE(builder.append(vc_str, ChunkOffset{0}));
+  EXPECT_EQ(builder.size(), 3u);
+
+  const auto built_col = builder.build();
+  EXPECT_EQ(built_col->dictionary(), col->dictionary());
+  EXPECT_EQ(built_col->size(), 3u);
+  EXPECT_EQ((*built_col)[0], AllTypeVariant{"Steve"});
+  EXPECT_TRUE(variant_is_null((*built_col)[1]));
+  EXPECT_EQ((*built_col)[2], AllTypeVariant{"Bill"});
+}
+
+TEST_F(StorageDictionaryColumnTest, BuilderMergesDictionaries) {
+  vc_str->append("Bill");
+  vc_str->append("Steve");
+  auto col_a = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(
+      encode_column(EncodingType::Dictionary, DataType::String, vc_str));
+
+  auto vc_str_b = std::make_shared<ValueColumn<std::string>>(true);
+  vc_str_b->append("Alexander");
+  vc_str_b->append(NULL_VALUE);
+  vc_str_b->append("Steve");
+  vc_str_b->append("Zed");
+  auto col_b = std::dynamic_pointer_cast<DictionaryColumn<std::string>>(
+      encode_column(EncodingType::Dictionary, DataType::String, vc_str_b));
+
+  auto builder = DictionaryColumnBuilder<std::string>{};
+  EXPECT_TRUE(builder.append(col_b, ChunkOffset{2}));
+  EXPECT_TRUE(builder.append(col_a, ChunkOffset{1}));
+  EXPECT_TRUE(builder.append(col_b, ChunkOffset{1}));
+  EXPECT_TRUE(builder.append(col_b, ChunkOffset{0}));
+
+  const auto built_col = builder.build();
+
+  // Only the referenced values are part of the merged dictionary
+  EXPECT_EQ(*built_col->dictionary(), (pmr_vector<std::string>{"Alexander", "Steve"}));
+  EXPECT_EQ((*built_col)[0], AllTypeVariant{"Steve"});
+  EXPECT_EQ((*built_col)[1], AllTypeVariant{"Steve"});
+  EXPECT_TRUE(variant_is_null((*built_col)[2]));
+  EXPECT_EQ((*built_col)[3], AllTypeVariant{"Alexander"});
+}
+
 }  // namespace opossum
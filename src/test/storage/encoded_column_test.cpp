@@ -197,6 +197,39 @@ TEST_P(EncodedColumnTest, SequentiallyReadNullableIntColumnWithChunkOffsetsList)
   });
 }
 
+TEST_P(EncodedColumnTest, SequentiallyReadNullableIntColumnInRange) {
+  auto value_column = this->create_int_w_null_value_column();
+  auto base_encoded_column = this->encode_value_column(DataType::Int, value_column);
+
+  // The range neither starts nor ends at the border of a block or of a run
+  const auto begin_chunk_offset = static_cast<ChunkOffset>(row_count() / 3u + 5u);
+  const auto end_chunk_offset = static_cast<ChunkOffset>(row_count() - 7u);
+
+  resolve_encoded_column_type<int32_t>(*base_encoded_column, [&](const auto& encoded_column) {
+    auto value_column_iterable = create_iterable_from_column(*value_column);
+    auto encoded_column_iterable = create_iterable_from_column(encoded_column);
+
+    value_column_iterable.with_iterators(
+        begin_chunk_offset, end_chunk_offset, [&](auto value_column_it, auto value_column_end) {
+          encoded_column_iterable.with_iterators(
+              begin_chunk_offset, end_chunk_offset, [&](auto encoded_column_it, auto encoded_column_end) {
+                auto expected_chunk_offset = begin_chunk_offset;
+                for (; encoded_column_it != encoded_column_end; ++encoded_column_it, ++value_column_it) {
+                  EXPECT_EQ(encoded_column_it->chunk_offset(), expected_chunk_offset++);
+                  EXPECT_EQ(value_column_it->is_null(), encoded_column_it->is_null());
+
+                  if (!value_column_it->is_null()) {
+                    EXPECT_EQ(value_column_it->value(), encoded_column_it->value());
+                  }
+                }
+
+                EXPECT_EQ(expected_chunk_offset, end_chunk_offset);
+                EXPECT_EQ(value_column_it, value_column_end);
+              });
+        });
+  });
+}
+
 TEST_P(EncodedColumnTest, SequentiallyReadNullableIntColumnWithShuffledChunkOffsetsList) {
   auto value_column = this->create_int_w_null_value_column();
   auto base_encoded_column = this->encode_value_column(DataType::Int, value_column);
@@ -0,0 +1,99 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class PrimaryKeyIndexTest : public BaseTest {};
+
+TEST_F(PrimaryKeyIndexTest, InsertAndLookup) {
+  auto index = PrimaryKeyIndex<int32_t>{ColumnID{0}};
+  const auto column = ValueColumn<int32_t>{pmr_concurrent_vector<int32_t>{4, 7, 4, 9}};
+
+  index.insert(column, ChunkID{3}, ChunkOffset{0}, ChunkOffset{3});
+
+  EXPECT_EQ(index.size(), 3u);
+  EXPECT_EQ(index.lookup(7), (PosList{RowID{ChunkID{3}, 1}}));
+  EXPECT_EQ(index.lookup(4).size(), 2u);
+  EXPECT_TRUE(index.lookup(9).empty());
+  EXPECT_TRUE(index.lookup(NULL_VALUE).empty());
+}
+
+TEST_F(PrimaryKeyIndexTest, Erase) {
+  auto index = PrimaryKeyIndex<std::string>{ColumnID{0}};
+  const auto column = ValueColumn<std::string>{pmr_concurrent_vector<std::string>{"a", "b", "a"}};
+  index.insert(column, ChunkID{0}, ChunkOffset{0}, ChunkOffset{3});
+
+  index.erase("a", RowID{ChunkID{0}, 0});
+  index.erase("b", RowID{ChunkID{0}, 2});
+
+  EXPECT_EQ(index.size(), 2u);
+  EXPECT_EQ(index.lookup("a"), (PosList{RowID{ChunkID{0}, 2}}));
+  EXPECT_EQ(index.lookup("b"), (PosList{RowID{ChunkID{0}, 1}}));
+}
+
+TEST_F(PrimaryKeyIndexTest, EraseChunk) {
+  auto index = PrimaryKeyIndex<int32_t>{ColumnID{0}};
+  const auto column = ValueColumn<int32_t>{pmr_concurrent_vector<int32_t>{4, 7}};
+  index.insert(column, ChunkID{0}, ChunkOffset{0}, ChunkOffset{2});
+  index.insert(column, ChunkID{1}, ChunkOffset{0}, ChunkOffset{2});
+
+  index.erase_chunk(ChunkID{0});
+
+  EXPECT_EQ(index.size(), 2u);
+  EXPECT_EQ(index.lookup(4), (PosList{RowID{ChunkID{1}, 0}}));
+}
+
+TEST_F(PrimaryKeyIndexTest, PruneDeletedRows) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  table->create_primary_key_index(ColumnID{0});
+  const auto index = table->primary_key_index();
+
+  // 123 was deleted by the transaction with commit ID 5
+  table->get_chunk(ChunkID{0})->mvcc_columns()->end_cids[1] = CommitID{5};
+
+  // Transactions with the snapshot 4 can still see the row
+  EXPECT_EQ(index->prune(*table, CommitID{4}), 0u);
+  EXPECT_EQ(index->lookup(123).size(), 1u);
+
+  EXPECT_EQ(index->prune(*table, CommitID{5}), 1u);
+  EXPECT_TRUE(index->lookup(123).empty());
+  EXPECT_EQ(index->size(), 2u);
+}
+
+TEST_F(PrimaryKeyIndexTest, NullsAreNotIndexed) {
+  auto index = PrimaryKeyIndex<int32_t>{ColumnID{0}};
+  const auto column = ValueColumn<int32_t>{pmr_concurrent_vector<int32_t>{1, 0, 2},
+                                           pmr_concurrent_vector<bool>{false, true, false}};
+  index.insert(column, ChunkID{0}, ChunkOffset{0}, ChunkOffset{3});
+
+  EXPECT_EQ(index.size(), 2u);
+  EXPECT_TRUE(index.lookup(0).empty());
+}
+
+TEST_F(PrimaryKeyIndexTest, CreatedOnEncodedAndMutableChunks) {
+  const auto table = load_table("src/test/tables/int_float.tbl", 2);
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}});
+  table->create_primary_key_index(ColumnID{0});
+
+  const auto index = table->primary_key_index();
+  ASSERT_TRUE(index);
+  EXPECT_EQ(index->column_id(), ColumnID{0});
+  EXPECT_EQ(index->size(), 3u);
+  EXPECT_EQ(index->lookup(123), (PosList{RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(index->lookup(1234), (PosList{RowID{ChunkID{1}, 0}}));
+
+  EXPECT_GT(index->memory_consumption(), 0u);
+  EXPECT_GE(table->memory_usage().indices, index->memory_consumption());
+
+  EXPECT_THROW(table->create_primary_key_index(ColumnID{1}), std::logic_error);
+}
+
+}  // namespace opossum
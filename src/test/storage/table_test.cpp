@@ -1,3 +1,4 @@
+#include <fstream>
 #include <limits>
 #include <memory>
 #include <string>
@@ -8,6 +9,8 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/chunk_encoder.hpp"
+#include "../lib/storage/index/group_key/group_key_index.hpp"
 #include "../lib/storage/table.hpp"
 
 namespace opossum {
@@ -182,4 +185,58 @@ TEST_F(StorageTableTest, MemoryUsageEstimation) {
   EXPECT_GT(t->estimate_memory_usage(), empty_memory_usage + 2 * (sizeof(int) + sizeof(std::string)));
 }
 
+TEST_F(StorageTableTest, EvictChunk) {
+  auto table = load_table("src/test/tables/int_float.tbl", 2);
+  const auto expected_table = load_table("src/test/tables/int_float.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table);
+  table->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  const auto path = test_data_path + "evicted_chunk.chunk";
+  const auto chunk = table->get_chunk(ChunkID{0});
+  const auto memory_usage = table->memory_usage();
+
+  table->evict_chunk(ChunkID{0}, path);
+  EXPECT_TRUE(table->chunk_is_evicted(ChunkID{0}));
+  EXPECT_FALSE(table->chunk_is_evicted(ChunkID{1}));
+  EXPECT_TRUE(std::ifstream{path}.good());
+  EXPECT_LT(table->memory_usage().dictionaries, memory_usage.dictionaries);
+
+  // The chunk that holds the mapped columns replaces the evicted one, which stays valid for everyone still holding it
+  const auto evicted_chunk = table->get_chunk(ChunkID{0});
+  EXPECT_NE(evicted_chunk, chunk);
+  EXPECT_EQ(chunk->size(), 2u);
+  EXPECT_EQ(table->chunks()[0], evicted_chunk);
+  EXPECT_EQ(evicted_chunk->get_indices(std::vector<ColumnID>{ColumnID{0}}).size(), 1u);
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  // Evicting again does nothing
+  table->evict_chunk(ChunkID{0}, path);
+  EXPECT_EQ(table->get_chunk(ChunkID{0}), evicted_chunk);
+
+  // The file is removed once no column uses it anymore
+  table = nullptr;
+  EXPECT_TRUE(std::ifstream{path}.good());
+  const auto column = evicted_chunk->get_column(ColumnID{0});
+  EXPECT_EQ((*column)[1], AllTypeVariant{123});
+}
+
+TEST_F(StorageTableTest, EvictedChunkFileIsRemovedWithItsColumns) {
+  auto table = load_table("src/test/tables/int_float.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table);
+
+  const auto path = test_data_path + "evicted_chunk.chunk";
+  table->evict_chunk(ChunkID{0}, path);
+  EXPECT_TRUE(std::ifstream{path}.good());
+
+  table = nullptr;
+  EXPECT_FALSE(std::ifstream{path}.good());
+}
+
+TEST_F(StorageTableTest, UnencodedChunkCannotBeEvicted) {
+  t->append({4, "Hello,"});
+
+  EXPECT_THROW(t->evict_chunk(ChunkID{0}, test_data_path + "unencoded_chunk.chunk"), std::logic_error);
+  EXPECT_FALSE(t->chunk_is_evicted(ChunkID{0}));
+}
+
 }  // namespace opossum
@@ -1,17 +1,23 @@
 
 #include <array>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
 #include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "tasks/chunk_compression_task.hpp"
+#include "type_cast.hpp"
 
 namespace opossum {
 
@@ -110,4 +116,74 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, SortBeforeCompression) {
+  auto table = load_table("src/test/tables/compression_input.tbl", 12u);
+  StorageManager::get().add_table("table", table);
+
+  auto table_sorted = load_table("src/test/tables/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table_sorted", table_sorted);
+
+  auto compression =
+      std::make_unique<ChunkCompressionTask>("table_sorted", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}, ColumnID{1});
+  compression->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(table_sorted, table);
+
+  const auto expected_ordered_by = std::make_optional(std::make_pair(ColumnID{1}, OrderByMode::Ascending));
+  for (auto chunk_id = ChunkID{0}; chunk_id < table_sorted->chunk_count(); ++chunk_id) {
+    const auto chunk = table_sorted->get_chunk(chunk_id);
+    EXPECT_EQ(chunk->ordered_by(), expected_ordered_by);
+
+    const auto column = chunk->get_column(ColumnID{1});
+    ASSERT_NE(std::dynamic_pointer_cast<const BaseDictionaryColumn>(column), nullptr);
+    for (auto chunk_offset = ChunkOffset{1}; chunk_offset < chunk->size(); ++chunk_offset) {
+      EXPECT_LE(type_cast<int32_t>((*column)[chunk_offset - 1]), type_cast<int32_t>((*column)[chunk_offset]));
+    }
+  }
+
+  // The MVCC columns have to be sorted along with the data
+  auto get_table = std::make_shared<GetTable>("table_sorted");
+  get_table->execute();
+  auto validate = std::make_shared<Validate>(get_table);
+  auto context = TransactionManager::get().new_transaction_context();
+  validate->set_transaction_context(context);
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 12u);
+}
+
+TEST_F(ChunkCompressionTaskTest, SortUpdatesPrimaryKeyIndex) {
+  auto table = load_table("src/test/tables/int_float.tbl", 3u);
+  table->create_primary_key_index(ColumnID{0});
+  StorageManager::get().add_table("table", table);
+
+  auto compression = std::make_unique<ChunkCompressionTask>("table", ChunkID{0}, ColumnID{1});
+  compression->execute();
+
+  const auto index = table->primary_key_index();
+  EXPECT_EQ(index->size(), 3u);
+  EXPECT_EQ(index->lookup(123), (PosList{RowID{ChunkID{0}, 0}}));
+  EXPECT_EQ(index->lookup(1234), (PosList{RowID{ChunkID{0}, 1}}));
+  EXPECT_EQ(index->lookup(12345), (PosList{RowID{ChunkID{0}, 2}}));
+}
+
+TEST_F(ChunkCompressionTaskTest, PrunesPrimaryKeyIndex) {
+  auto table = load_table("src/test/tables/int_float.tbl", 2u);
+  table->create_primary_key_index(ColumnID{0});
+  StorageManager::get().add_table("table", table);
+
+  // Deleted rows that a running transaction can still see are kept
+  auto mvcc_columns = table->get_chunk(ChunkID{1})->mvcc_columns();
+  mvcc_columns->end_cids[0] = TransactionManager::get().last_commit_id() + 1;
+  TransactionManager::get().set_last_commit_id(mvcc_columns->end_cids[0]);
+  auto context = TransactionManager::get().new_transaction_context();
+  table->get_chunk(ChunkID{0})->mvcc_columns()->end_cids[0] = context->snapshot_commit_id() + 1;
+
+  std::make_unique<ChunkCompressionTask>("table", ChunkID{0})->execute();
+
+  const auto index = table->primary_key_index();
+  EXPECT_EQ(index->size(), 2u);
+  EXPECT_TRUE(index->lookup(1234).empty());
+  EXPECT_EQ(index->lookup(12345), (PosList{RowID{ChunkID{0}, 0}}));
+}
+
 }  // namespace opossum
@@ -0,0 +1,43 @@
+#include <memory>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk_access_counter.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/storage_manager.hpp"
+#include "tasks/chunk_eviction_task.hpp"
+
+namespace opossum {
+
+class ChunkEvictionTaskTest : public BaseTest {};
+
+TEST_F(ChunkEvictionTaskTest, EvictsColdChunks) {
+  const auto source_table = load_table("src/test/tables/int_float.tbl", 1);
+  ChunkEncoder::encode_all_chunks(source_table);
+
+  // Only chunks with an access counter are considered
+  auto table = std::make_shared<Table>(source_table->column_definitions(), TableType::Data);
+  auto hot_counter = std::make_shared<ChunkAccessCounter>(PolymorphicAllocator<uint64_t>{});
+  hot_counter->process();
+  hot_counter->increment(100u);
+  hot_counter->process();
+  auto cold_counter = std::make_shared<ChunkAccessCounter>(PolymorphicAllocator<uint64_t>{});
+
+  table->append_chunk(source_table->get_chunk(ChunkID{0})->columns(), std::nullopt, hot_counter);
+  table->append_chunk(source_table->get_chunk(ChunkID{1})->columns(), std::nullopt, cold_counter);
+  table->append_chunk(source_table->get_chunk(ChunkID{2})->columns());
+  StorageManager::get().add_table("table", table);
+
+  auto task = std::make_shared<ChunkEvictionTask>("table", test_data_path, 2u);
+  task->execute();
+
+  EXPECT_FALSE(table->chunk_is_evicted(ChunkID{0}));
+  EXPECT_TRUE(table->chunk_is_evicted(ChunkID{1}));
+  EXPECT_FALSE(table->chunk_is_evicted(ChunkID{2}));
+
+  EXPECT_TABLE_EQ_ORDERED(table, source_table);
+}
+
+}  // namespace opossum
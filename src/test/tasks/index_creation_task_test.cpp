@@ -0,0 +1,68 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "tasks/index_creation_task.hpp"
+
+namespace opossum {
+
+class IndexCreationTaskTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_float.tbl", 1);
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}, ChunkID{1}});
+    StorageManager::get().add_table("table", _table);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(IndexCreationTaskTest, CreatesIndexOnEncodedChunks) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(4, 2)));
+
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}};
+  auto task = std::make_shared<IndexCreationTask>("table", column_ids, ColumnIndexType::GroupKey, "index_a");
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+
+  EXPECT_NE(_table->get_chunk(ChunkID{0})->get_index(ColumnIndexType::GroupKey, column_ids), nullptr);
+  EXPECT_NE(_table->get_chunk(ChunkID{1})->get_index(ColumnIndexType::GroupKey, column_ids), nullptr);
+  const auto other_column_ids = std::vector<ColumnID>{ColumnID{1}};
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->get_index(ColumnIndexType::GroupKey, other_column_ids), nullptr);
+
+  // The last chunk is not encoded yet
+  EXPECT_TRUE(_table->get_chunk(ChunkID{2})->get_indices(column_ids).empty());
+
+  const auto indexes = _table->get_indexes();
+  ASSERT_EQ(indexes.size(), 1u);
+  EXPECT_EQ(indexes[0].name, "index_a");
+  EXPECT_EQ(indexes[0].type, ColumnIndexType::GroupKey);
+  EXPECT_EQ(indexes[0].column_ids, column_ids);
+}
+
+TEST_F(IndexCreationTaskTest, CreatesIndexWhenChunkIsEncoded) {
+  const auto column_ids = std::vector<ColumnID>{ColumnID{0}, ColumnID{1}};
+  auto task = std::make_shared<IndexCreationTask>("table", column_ids, ColumnIndexType::CompositeGroupKey);
+  task->execute();
+
+  EXPECT_EQ(_table->get_chunk(ChunkID{2})->get_index(ColumnIndexType::CompositeGroupKey, column_ids), nullptr);
+
+  ChunkEncoder::encode_chunks(_table, {ChunkID{2}});
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto chunk = _table->get_chunk(chunk_id);
+    EXPECT_NE(chunk->get_index(ColumnIndexType::CompositeGroupKey, column_ids), nullptr);
+    EXPECT_EQ(chunk->get_indices(column_ids).size(), 1u);
+  }
+}
+
+}  // namespace opossum
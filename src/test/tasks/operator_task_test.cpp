@@ -8,7 +8,11 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/get_table.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/operator_pipeline.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
 #include "scheduler/operator_task.hpp"
 #include "storage/storage_manager.hpp"
@@ -96,4 +100,97 @@ TEST_F(OperatorTaskTest, MakeDiamondShape) {
   std::vector<std::shared_ptr<AbstractTask>> expected_successors_4{};
   EXPECT_EQ(tasks[4]->successors(), expected_successors_4);
 }
+
+TEST_F(OperatorTaskTest, PipelinedTasksFromOperatorTest) {
+  auto gt = std::make_shared<GetTable>("table_a");
+  auto scan_a = std::make_shared<TableScan>(gt, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::LessThan, 458);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(scan_b, UsePipelining::Yes);
+
+  ASSERT_EQ(tasks.size(), 2u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt);
+  EXPECT_EQ(tasks[0]->get_pipeline(), nullptr);
+  EXPECT_EQ(tasks[1]->get_operator(), scan_b);
+  ASSERT_NE(tasks[1]->get_pipeline(), nullptr);
+
+  const auto expected_operators = std::vector<std::shared_ptr<AbstractOperator>>{scan_a, scan_b};
+  EXPECT_EQ(tasks[1]->get_pipeline()->operators(), expected_operators);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  auto expected_result = load_table("src/test/tables/int_float_filtered.tbl", 2);
+  EXPECT_TABLE_EQ_UNORDERED(expected_result, tasks.back()->get_operator()->get_output());
+}
+
+TEST_F(OperatorTaskTest, DiamondShapeIsNotPipelined) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto scan_a = std::make_shared<TableScan>(gt_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 1234);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::LessThan, 1000);
+  auto scan_c = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::GreaterThan, 2000);
+  auto union_positions = std::make_shared<UnionPositions>(scan_b, scan_c);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(union_positions, UsePipelining::Yes);
+
+  // scan_a has two consumers and thus has to be materialized
+  ASSERT_EQ(tasks.size(), 5u);
+  for (const auto& task : tasks) {
+    EXPECT_EQ(task->get_pipeline(), nullptr);
+  }
+}
+
+TEST_F(OperatorTaskTest, LongestCriticalPathFirst) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto gt_b = std::make_shared<GetTable>("table_b");
+  auto scan_a = std::make_shared<TableScan>(gt_b, ColumnID{0}, PredicateCondition::GreaterThanEquals, 123);
+  auto scan_b = std::make_shared<TableScan>(scan_a, ColumnID{1}, PredicateCondition::LessThan, 458);
+  auto join = std::make_shared<JoinHash>(gt_a, scan_b, JoinMode::Inner, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                         PredicateCondition::Equals);
+
+  auto tasks = OperatorTask::make_tasks_from_operator(join);
+
+  // The right input of the join takes longer to reach the join, so it is started first
+  ASSERT_EQ(tasks.size(), 5u);
+  EXPECT_EQ(tasks[0]->get_operator(), gt_b);
+  EXPECT_EQ(tasks[1]->get_operator(), scan_a);
+  EXPECT_EQ(tasks[2]->get_operator(), gt_a);
+  EXPECT_EQ(tasks[3]->get_operator(), scan_b);
+  EXPECT_EQ(tasks[4]->get_operator(), join);
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  EXPECT_EQ(tasks.back()->get_operator()->get_output()->row_count(), 2u);
+}
+
+TEST_F(OperatorTaskTest, SubselectsPrecedeProjection) {
+  auto gt_a = std::make_shared<GetTable>("table_a");
+  auto subselect_a = std::make_shared<TableWrapper>(load_table("src/test/tables/int_single.tbl", 1));
+  auto subselect_b = std::make_shared<TableWrapper>(load_table("src/test/tables/int_single.tbl", 1));
+  auto projection = std::make_shared<Projection>(
+      gt_a, Projection::ColumnExpressions{PQPExpression::create_subselect(subselect_a, {"a"}),
+                                          PQPExpression::create_subselect(subselect_b, {"b"})});
+
+  auto tasks = OperatorTask::make_tasks_from_operator(projection);
+
+  // The subselects do not depend on the input of the projection and can be executed concurrently to it
+  ASSERT_EQ(tasks.size(), 4u);
+  EXPECT_EQ(tasks.back()->get_operator(), projection);
+  for (auto task_idx = size_t{0}; task_idx < 3u; ++task_idx) {
+    std::vector<std::shared_ptr<AbstractTask>> expected_successors({tasks.back()});
+    EXPECT_EQ(tasks[task_idx]->successors(), expected_successors);
+  }
+
+  for (auto& task : tasks) {
+    task->schedule();
+  }
+
+  const auto output = projection->get_output();
+  EXPECT_EQ(output->row_count(), 3u);
+  EXPECT_EQ(output->column_count(), 2u);
+  EXPECT_EQ(output->get_value<int32_t>(ColumnID{1}, 0u), 123);
+}
 }  // namespace opossum
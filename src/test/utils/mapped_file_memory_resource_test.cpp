@@ -0,0 +1,43 @@
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "types.hpp"
+#include "utils/mapped_file_memory_resource.hpp"
+
+namespace opossum {
+
+class MappedFileMemoryResourceTest : public BaseTest {
+ protected:
+  const std::string _path = test_data_path + "mapped_file_memory_resource_test.bin";
+};
+
+TEST_F(MappedFileMemoryResourceTest, AllocatesInFile) {
+  {
+    auto memory_resource = MappedFileMemoryResource{_path, 4096};
+    const auto allocator = PolymorphicAllocator<size_t>(&memory_resource);
+
+    auto values = pmr_vector<uint32_t>(256, allocator);
+    std::iota(values.begin(), values.end(), 0u);
+    EXPECT_EQ(memory_resource.mapped_bytes(), 256 * sizeof(uint32_t));
+    EXPECT_TRUE(std::ifstream{_path}.good());
+
+    // The values stay accessible after they are written back and released from the process
+    memory_resource.release_to_file();
+    EXPECT_EQ(values[0], 0u);
+    EXPECT_EQ(values[255], 255u);
+
+    // Allocations that exceed the capacity are placed on the heap
+    const auto large_values = pmr_vector<uint32_t>(4096, 7u, allocator);
+    EXPECT_EQ(memory_resource.mapped_bytes(), 256 * sizeof(uint32_t));
+    EXPECT_EQ(large_values[4095], 7u);
+  }
+
+  EXPECT_FALSE(std::ifstream{_path}.good());
+}
+
+}  // namespace opossum